@@ -0,0 +1,82 @@
+#pragma once
+// Small helpers shared by the benchmark executables (not part of the app).
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace slippygl::bench
+{
+    /// Nearest-rank percentile (p in [0,100]); sorts a copy
+    inline double percentile(std::vector<double> v, double p)
+    {
+        if (v.empty()) return 0.0;
+        std::sort(v.begin(), v.end());
+        const double rank = p / 100.0 * static_cast<double>(v.size() - 1);
+        const std::size_t lo = static_cast<std::size_t>(rank);
+        const std::size_t hi = std::min(lo + 1, v.size() - 1);
+        return v[lo] + (v[hi] - v[lo]) * (rank - static_cast<double>(lo));
+    }
+
+    /// Median (average of the middle pair for even sizes); sorts a copy
+    inline double median(std::vector<double> v)
+    {
+        if (v.empty()) return 0.0;
+        std::sort(v.begin(), v.end());
+        const std::size_t mid = v.size() / 2;
+        return (v.size() % 2) ? v[mid] : 0.5 * (v[mid - 1] + v[mid]);
+    }
+
+    /// Median absolute deviation around the median (robust spread, unscaled)
+    inline double mad(const std::vector<double>& v)
+    {
+        const double m = median(v);
+        std::vector<double> dev;
+        dev.reserve(v.size());
+        for (const double x : v) dev.push_back(x < m ? m - x : x - m);
+        return median(std::move(dev));
+    }
+
+    /// Keeps a computed value alive so the optimizer can't drop the work
+    template <class T>
+    inline void doNotOptimize(const T& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "g"(&value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * Minimal "--name=value" argument lookup
+     * @return value, or fallback when the flag is absent
+     */
+    inline std::string argValue(int argc, char** argv, const char* name, const std::string& fallback)
+    {
+        const std::size_t n = std::strlen(name);
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strncmp(argv[i], name, n) == 0 && argv[i][n] == '=') return argv[i] + n + 1;
+        }
+        return fallback;
+    }
+
+    inline double argDouble(int argc, char** argv, const char* name, double fallback)
+    {
+        const std::string v = argValue(argc, argv, name, "");
+        return v.empty() ? fallback : std::atof(v.c_str());
+    }
+
+    inline bool argFlag(int argc, char** argv, const char* name)
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            if (std::strcmp(argv[i], name) == 0) return true;
+        }
+        return false;
+    }
+
+} // namespace slippygl::bench
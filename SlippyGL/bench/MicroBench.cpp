@@ -0,0 +1,607 @@
+// Microbenchmarks for CPU hot paths (cache, visible-tile math, projections,
+// PNG decode, BC1 encode, header parsing, text layout).
+//
+// Each case is warmed up, its batch size calibrated so one repetition takes
+// about --rep-ms, then timed for --reps repetitions. The report gives the
+// median time per operation and its median absolute deviation (MAD); compare
+// medians across commits and treat differences within a few MADs as noise.
+// Cases that also measure quality (BC1 PSNR) report it in a note column.
+//
+// usage: slippygl_bench [--reps=N] [--warmup-ms=N] [--rep-ms=N]
+//          [--filter=substr] [--corpus=<archive>] [--zoom=N] [--no-gl] [--json]
+#include <glad/glad.h>
+#include <spdlog/spdlog.h>
+#include <zlib.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "core/ContentHash.hpp"
+#include "core/TileMath.hpp"
+#include "decode/Bc1Encoder.hpp"
+#include "decode/PngCodec.hpp"
+#include "decode/PixelKernels.hpp"
+#include "decode/PngStreamDecoder.hpp"
+#include "net/HttpTypes.hpp"
+#include "render/Camera2D.hpp"
+#include "render/GlBootstrap.hpp"
+#include "render/TextRenderer.hpp"
+#include "tile/TileCache.hpp"
+#include "tile/TileGrid.hpp"
+#include "tile/TileSource.hpp"
+
+using namespace slippygl;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+    using Bytes = std::vector<std::uint8_t>;
+
+    struct CaseResult
+    {
+        std::string name;
+        double medianNs = 0.0;    // per operation
+        double madNs = 0.0;
+        int reps = 0;
+        std::uint64_t iters = 0;  // operations per repetition
+        std::string skipped;      // reason, empty if run
+        std::string note;         // extra measurement (e.g. encoder quality)
+    };
+
+    class Harness
+    {
+    public:
+        Harness(int reps, double warmupMs, double repMs, std::string filter)
+            : reps_(reps), warmupMs_(warmupMs), repMs_(repMs), filter_(std::move(filter)) {}
+
+        bool selected(const char* name) const
+        {
+            return filter_.empty() || std::string_view(name).find(filter_) != std::string_view::npos;
+        }
+
+        /**
+         * Time fn(iters), which must perform `iters` operations
+         */
+        template <class Fn>
+        void run(const char* name, Fn&& fn)
+        {
+            if (!selected(name)) return;
+
+            // Warmup + calibration: grow the batch until it fills one repetition
+            std::uint64_t iters = 1;
+            const auto warmupEnd = Clock::now() + std::chrono::duration<double, std::milli>(warmupMs_);
+            for (;;)
+            {
+                const double ms = timeMs(fn, iters);
+                if (ms >= repMs_ || iters >= (std::uint64_t{ 1 } << 32))
+                {
+                    if (Clock::now() >= warmupEnd) break;
+                    continue;   // batch size settled; keep warming up
+                }
+                iters = ms > 0.01 ? std::max(iters + 1, static_cast<std::uint64_t>(iters * repMs_ / ms))
+                                  : iters * 10;
+            }
+
+            std::vector<double> perOp;
+            perOp.reserve(static_cast<std::size_t>(reps_));
+            for (int r = 0; r < reps_; ++r)
+            {
+                perOp.push_back(timeMs(fn, iters) * 1e6 / static_cast<double>(iters));
+            }
+
+            CaseResult res;
+            res.name = name;
+            res.medianNs = bench::median(perOp);
+            res.madNs = bench::mad(perOp);
+            res.reps = reps_;
+            res.iters = iters;
+            results_.push_back(std::move(res));
+        }
+
+        void skip(const char* name, const std::string& why)
+        {
+            if (!selected(name)) return;
+            CaseResult res;
+            res.name = name;
+            res.skipped = why;
+            results_.push_back(std::move(res));
+        }
+
+        /**
+         * Attach a note to the most recent result of a case (no-op if it didn't run)
+         */
+        void note(const char* name, std::string text)
+        {
+            for (auto it = results_.rbegin(); it != results_.rend(); ++it)
+            {
+                if (it->name == name)
+                {
+                    it->note = std::move(text);
+                    return;
+                }
+            }
+        }
+
+        const std::vector<CaseResult>& results() const noexcept { return results_; }
+        int reps() const noexcept { return reps_; }
+        double warmupMs() const noexcept { return warmupMs_; }
+        double repMs() const noexcept { return repMs_; }
+
+    private:
+        template <class Fn>
+        static double timeMs(Fn& fn, std::uint64_t iters)
+        {
+            const auto t0 = Clock::now();
+            fn(iters);
+            return std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+        }
+
+        int reps_;
+        double warmupMs_;
+        double repMs_;
+        std::string filter_;
+        std::vector<CaseResult> results_;
+    };
+
+    // ---- Synthetic PNG corpus (used when no --corpus archive is given) ----
+
+    void putBE32(Bytes& b, std::uint32_t v)
+    {
+        for (int s = 24; s >= 0; s -= 8) b.push_back(static_cast<std::uint8_t>(v >> s));
+    }
+
+    void putChunk(Bytes& png, const char* type, const Bytes& data)
+    {
+        putBE32(png, static_cast<std::uint32_t>(data.size()));
+        const std::size_t start = png.size();
+        png.insert(png.end(), type, type + 4);
+        png.insert(png.end(), data.begin(), data.end());
+        putBE32(png, static_cast<std::uint32_t>(crc32(0, png.data() + start, static_cast<uInt>(png.size() - start))));
+    }
+
+    // 256x256 tile resembling a raster map tile: flat areas, a few roads and
+    // some noise. colorType 3 = 8-bit palette (typical OSM), 2 = RGB.
+    Bytes makeTilePng(int colorType, std::uint32_t seed)
+    {
+        constexpr int kSize = 256;
+        std::mt19937 rng(seed);
+        const int channels = colorType == 3 ? 1 : 3;
+        Bytes raw;
+        raw.reserve(static_cast<std::size_t>(kSize) * (kSize * channels + 1));
+        for (int y = 0; y < kSize; ++y)
+        {
+            raw.push_back(0);   // filter: none (the encoder below picks nothing smarter)
+            for (int x = 0; x < kSize; ++x)
+            {
+                int v = ((x / 64) + (y / 64)) % 3 * 40 + 100;        // land-use blocks
+                if ((x + seed) % 53 < 3 || (y * 3 + seed) % 71 < 4) v = 250;   // roads
+                if (rng() % 16 == 0) v += static_cast<int>(rng() % 9);          // texture
+                for (int c = 0; c < channels; ++c)
+                {
+                    raw.push_back(static_cast<std::uint8_t>(channels == 1 ? v % 256 : (v + c * 17) % 256));
+                }
+            }
+        }
+
+        Bytes png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        Bytes ihdr;
+        putBE32(ihdr, kSize);
+        putBE32(ihdr, kSize);
+        ihdr.insert(ihdr.end(), { 8, static_cast<std::uint8_t>(colorType), 0, 0, 0 });
+        putChunk(png, "IHDR", ihdr);
+        if (colorType == 3)
+        {
+            Bytes plte;
+            for (int i = 0; i < 256; ++i) plte.insert(plte.end(), { static_cast<std::uint8_t>(i),
+                static_cast<std::uint8_t>(255 - i / 2), static_cast<std::uint8_t>(i / 3 + 80) });
+            putChunk(png, "PLTE", plte);
+        }
+        uLongf zlen = compressBound(static_cast<uLong>(raw.size()));
+        Bytes z(zlen);
+        compress2(z.data(), &zlen, raw.data(), static_cast<uLong>(raw.size()), 6);
+        z.resize(zlen);
+        putChunk(png, "IDAT", z);
+        putChunk(png, "IEND", {});
+        return png;
+    }
+
+    std::vector<Bytes> loadCorpus(const std::string& path, int zoom, std::string* err)
+    {
+        std::vector<Bytes> tiles;
+        auto source = tile::openTileSource(path, err);
+        if (!source) return tiles;
+
+        // Up to 64 tiles from a block around Seoul at the requested zoom
+        const auto center = core::TileMath::lonlatToTileID(126.9780, 37.5665, zoom);
+        for (int dy = -8; dy < 8 && tiles.size() < 64; ++dy)
+        {
+            for (int dx = -8; dx < 8 && tiles.size() < 64; ++dx)
+            {
+                core::ByteSpan span;
+                if (source->find(tile::TileKey(zoom, center.x() + dx, center.y() + dy), span))
+                {
+                    tiles.emplace_back(span.data(), span.data() + span.size());
+                }
+            }
+        }
+        if (tiles.empty() && err) *err = "no tiles near Seoul at z" + std::to_string(zoom) + " in " + path;
+        return tiles;
+    }
+
+    void printReport(const Harness& h, const std::string& corpus, bool json)
+    {
+        if (json)
+        {
+            std::printf("{\"config\":{\"reps\":%d,\"warmup_ms\":%.0f,\"rep_ms\":%.0f,\"corpus\":\"%s\"},\"benchmarks\":[",
+                        h.reps(), h.warmupMs(), h.repMs(), corpus.c_str());
+            bool first = true;
+            for (const auto& r : h.results())
+            {
+                if (!r.skipped.empty())
+                {
+                    std::printf("%s{\"name\":\"%s\",\"skipped\":\"%s\"}", first ? "" : ",", r.name.c_str(), r.skipped.c_str());
+                }
+                else
+                {
+                    std::printf("%s{\"name\":\"%s\",\"median_ns\":%.3f,\"mad_ns\":%.3f,\"mad_pct\":%.2f,\"reps\":%d,\"iters\":%llu",
+                                first ? "" : ",", r.name.c_str(), r.medianNs, r.madNs,
+                                r.medianNs > 0.0 ? 100.0 * r.madNs / r.medianNs : 0.0, r.reps,
+                                static_cast<unsigned long long>(r.iters));
+                    if (!r.note.empty()) std::printf(",\"note\":\"%s\"", r.note.c_str());
+                    std::printf("}");
+                }
+                first = false;
+            }
+            std::printf("]}\n");
+            return;
+        }
+
+        std::printf("%-28s %14s %12s %7s %12s\n", "benchmark", "median ns/op", "MAD ns", "MAD %", "iters/rep");
+        for (const auto& r : h.results())
+        {
+            if (!r.skipped.empty())
+            {
+                std::printf("%-28s skipped: %s\n", r.name.c_str(), r.skipped.c_str());
+                continue;
+            }
+            std::printf("%-28s %14.2f %12.2f %6.2f%% %12llu  %s\n", r.name.c_str(), r.medianNs, r.madNs,
+                        r.medianNs > 0.0 ? 100.0 * r.madNs / r.medianNs : 0.0,
+                        static_cast<unsigned long long>(r.iters), r.note.c_str());
+        }
+        std::printf("(%d reps, corpus: %s)\n", h.reps(), corpus.c_str());
+    }
+}
+
+int main(int argc, char** argv)
+{
+    spdlog::set_level(spdlog::level::err);
+
+    const int reps        = std::max(3, static_cast<int>(bench::argDouble(argc, argv, "--reps", 15)));
+    const double warmupMs = bench::argDouble(argc, argv, "--warmup-ms", 200);
+    const double repMs    = std::max(1.0, bench::argDouble(argc, argv, "--rep-ms", 20));
+    const int zoom        = static_cast<int>(bench::argDouble(argc, argv, "--zoom", 14));
+    const bool json       = bench::argFlag(argc, argv, "--json");
+    const bool noGl       = bench::argFlag(argc, argv, "--no-gl");
+    Harness h(reps, warmupMs, repMs, bench::argValue(argc, argv, "--filter", ""));
+
+    // ---- TileCache (texture handle 0: pure bookkeeping, no GL calls) ----
+    {
+        constexpr std::size_t kTileBytes = 256 * 256 * 4;
+        constexpr int kResident = 256;
+        tile::TileCache cache(kResident * kTileBytes);
+        std::vector<tile::TileKey> hot, cold;
+        for (int i = 0; i < kResident; ++i)
+        {
+            hot.emplace_back(14, 13900 + i % 16, 6300 + i / 16);
+            cold.emplace_back(15, i, i);
+            cache.put(hot.back(), 0, kTileBytes);
+        }
+
+        h.run("tilecache.get_hit", [&](std::uint64_t n) {
+            render::TexHandle tex = 0;
+            for (std::uint64_t i = 0; i < n; ++i) bench::doNotOptimize(cache.get(hot[i % kResident], tex));
+        });
+        h.run("tilecache.get_miss", [&](std::uint64_t n) {
+            render::TexHandle tex = 0;
+            for (std::uint64_t i = 0; i < n; ++i) bench::doNotOptimize(cache.get(cold[i % kResident], tex));
+        });
+
+        // Every put evicts the LRU tile (keys never repeat)
+        std::uint32_t next = 0;
+        h.run("tilecache.put_evict", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i, ++next)
+            {
+                cache.put(tile::TileKey(18, static_cast<int>(next & 0x3FFFF), static_cast<int>(next >> 18)), 0, kTileBytes);
+            }
+        });
+    }
+
+    // ---- TileGrid (1920x1080 viewport over Seoul at z14) ----
+    {
+        render::Camera2D cam;
+        const auto seoul = core::TileMath::lonlatToTileID(126.9780, 37.5665, 14);
+        cam.setWorldOrigin(glm::dvec2(seoul.x() * 256.0, seoul.y() * 256.0));
+        cam.setScale(1.3f);
+        h.run("tilegrid.visible_range", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                cam.pan(static_cast<float>(i & 7) - 3.5f, 0.0f);
+                bench::doNotOptimize(tile::TileGrid::computeVisibleRange(cam, 1920, 1080, 14));
+            }
+        });
+        const auto range = tile::TileGrid::computeVisibleRange(cam, 1920, 1080, 14);
+        h.run("tilegrid.range_to_keys", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) bench::doNotOptimize(tile::TileGrid::rangeToKeys(range));
+        });
+    }
+
+    // ---- TileMath projections ----
+    {
+        std::vector<double> lons, lats;
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<double> lon(-180.0, 180.0), lat(-85.0, 85.0);
+        for (int i = 0; i < 1024; ++i)
+        {
+            lons.push_back(lon(rng));
+            lats.push_back(lat(rng));
+        }
+        h.run("tilemath.lonlat_to_px", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                const std::size_t k = i & 1023;
+                bench::doNotOptimize(core::TileMath::lonToXpx(lons[k], 14) + core::TileMath::latToYpx(lats[k], 14));
+            }
+        });
+        h.run("tilemath.lonlat_to_tile", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                const std::size_t k = i & 1023;
+                bench::doNotOptimize(core::TileMath::lonlatToTileID(lons[k], lats[k], 14));
+            }
+        });
+    }
+
+    // ---- PNG decode ----
+    std::string corpusName = "synthetic";
+    {
+        std::vector<Bytes> tiles;
+        const std::string corpusPath = bench::argValue(argc, argv, "--corpus", "");
+        if (!corpusPath.empty())
+        {
+            std::string err;
+            tiles = loadCorpus(corpusPath, zoom, &err);
+            if (tiles.empty())
+            {
+                spdlog::error("{}", err);
+                return 1;
+            }
+            corpusName = corpusPath;
+        }
+        else
+        {
+            for (std::uint32_t i = 0; i < 8; ++i) tiles.push_back(makeTilePng(i % 2 ? 2 : 3, i));
+        }
+
+        // Time the success path only: a corpus the decoders reject would
+        // otherwise benchmark the error branch
+        decode::Image img;
+        std::string err;
+        if (!decode::PngCodec::decode(tiles[0].data(), tiles[0].size(), img, 4, &err))
+        {
+            h.skip("png.decode", "decode failed: " + err);
+        }
+        else h.run("png.decode", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                const Bytes& t = tiles[i % tiles.size()];
+                decode::PngCodec::decode(t.data(), t.size(), img, 4);
+                bench::doNotOptimize(img.pixels.data());
+            }
+        });
+        decode::PngStreamDecoder dec;
+        dec.feed(tiles[0].data(), tiles[0].size());
+        if (!dec.finish(img, &err))
+        {
+            h.skip("png.stream_decode", "decode failed: " + err);
+        }
+        else h.run("png.stream_decode", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                const Bytes& t = tiles[i % tiles.size()];
+                dec.reset();
+                dec.feed(t.data(), t.size());
+                dec.finish(img);
+                bench::doNotOptimize(img.pixels.data());
+            }
+        });
+
+        // Dedup key of one tile body (TileCache::putShared)
+        h.run("hash.tile_body", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                const Bytes& t = tiles[i % tiles.size()];
+                bench::doNotOptimize(core::ContentHash::hash(t.data(), t.size()));
+            }
+        });
+
+        // ---- BC1 encode (per 256x256 tile) + quality against the decoded source ----
+        std::vector<decode::Image> images;
+        for (const Bytes& t : tiles)
+        {
+            decode::Image decoded;
+            if (decode::PngCodec::decode(t.data(), t.size(), decoded, 4)) images.push_back(std::move(decoded));
+        }
+        if (images.empty())
+        {
+            h.skip("bc1.encode", "no decodable tiles");
+            h.skip("bc1.encode_mips", "no decodable tiles");
+        }
+        else
+        {
+            Bytes blocks;
+            h.run("bc1.encode", [&](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    decode::Bc1Encoder::encode(images[i % images.size()], blocks);
+                    bench::doNotOptimize(blocks.data());
+                }
+            });
+            h.run("bc1.encode_mips", [&](std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    decode::Bc1Encoder::encode(images[i % images.size()], blocks, true);
+                    bench::doNotOptimize(blocks.data());
+                }
+            });
+
+            // PSNR over RGB of level 0, all tiles pooled
+            double se = 0.0;
+            std::size_t samples = 0;
+            decode::Image back;
+            for (const auto& src : images)
+            {
+                decode::Bc1Encoder::encode(src, blocks);
+                decode::Bc1Encoder::decode(blocks.data(), blocks.size(), src.width, src.height, back);
+                for (std::size_t k = 0; k < src.pixels.size(); ++k)
+                {
+                    if (k % 4 == 3) continue;
+                    const double d = static_cast<double>(src.pixels[k]) - back.pixels[k];
+                    se += d * d;
+                    ++samples;
+                }
+            }
+            const double mse = samples ? se / static_cast<double>(samples) : 0.0;
+            const double psnr = mse > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mse) : 99.0;
+            char buf[64];
+            std::snprintf(buf, sizeof(buf), "psnr=%.2fdB", psnr);
+            h.note("bc1.encode", buf);
+        }
+    }
+
+    // ---- Pixel kernels (per 256x256 tile) on every path this CPU runs ----
+    {
+        using Isa = decode::PixelKernels::Isa;
+        constexpr std::size_t kPixels = 256 * 256;
+        std::mt19937 rng(7);
+        Bytes rgba(kPixels * 4), rgb(kPixels * 3), work(kPixels * 4);
+        for (auto& b : rgba) b = static_cast<std::uint8_t>(rng());
+        for (auto& b : rgb) b = static_cast<std::uint8_t>(rng());
+        for (std::size_t i = 0; i < kPixels; ++i) rgba[i * 4 + 3] = 255;   // allOpaque scans the whole tile
+        std::vector<std::uint16_t> packed(kPixels);
+
+        const char* kernels[] = { "rgb_to_rgba", "premultiply", "rgb565", "downsample", "all_opaque" };
+        for (Isa isa : { Isa::kScalar, Isa::kSSE2, Isa::kAVX2, Isa::kNEON })
+        {
+            if (!decode::PixelKernels::supported(isa)) continue;
+            decode::PixelKernels::force(isa);
+            const std::string suffix = std::string(".") + decode::PixelKernels::name(isa);
+            for (int k = 0; k < 5; ++k)
+            {
+                const std::string name = std::string("pixel.") + kernels[k] + suffix;
+                h.run(name.c_str(), [&](std::uint64_t n) {
+                    for (std::uint64_t i = 0; i < n; ++i)
+                    {
+                        switch (k)
+                        {
+                        case 0: decode::PixelKernels::expandRGBtoRGBA(rgb.data(), work.data(), kPixels); break;
+                        case 1: decode::PixelKernels::premultiplyAlpha(work.data(), kPixels); break;   // branch-free: data doesn't matter
+                        case 2: decode::PixelKernels::packRGB565(rgba.data(), packed.data(), kPixels); break;
+                        case 3: decode::PixelKernels::downsample2x2(rgba.data(), 256, 256, work.data()); break;
+                        default: bench::doNotOptimize(decode::PixelKernels::allOpaque(rgba.data(), kPixels)); break;
+                        }
+                        bench::doNotOptimize(work.data());
+                        bench::doNotOptimize(packed.data());
+                    }
+                });
+
+                // Speedup over the scalar path
+                if (isa == Isa::kScalar) continue;
+                double scalarNs = 0.0, ns = 0.0;
+                for (const CaseResult& r : h.results())
+                {
+                    if (r.name == std::string("pixel.") + kernels[k] + ".scalar") scalarNs = r.medianNs;
+                    if (r.name == name) ns = r.medianNs;
+                }
+                if (scalarNs > 0.0 && ns > 0.0)
+                {
+                    char buf[32];
+                    std::snprintf(buf, sizeof(buf), "x%.1f vs scalar", scalarNs / ns);
+                    h.note(name.c_str(), buf);
+                }
+            }
+        }
+        decode::PixelKernels::reset();
+    }
+
+    // ---- Response header parsing (one typical tile response per op) ----
+    {
+        const std::vector<std::string> lines = {
+            "HTTP/2 200\r\n",
+            "server: Apache/2.4.54 (Ubuntu)\r\n",
+            "content-type: image/png\r\n",
+            "content-length: 18733\r\n",
+            "etag: \"a3f1c9e07d2b5a1e\"\r\n",
+            "last-modified: Tue, 14 Oct 2025 08:12:44 GMT\r\n",
+            "cache-control: max-age=86400, stale-while-revalidate=604800\r\n",
+            "expires: Wed, 15 Oct 2025 08:12:44 GMT\r\n",
+            "access-control-allow-origin: *\r\n",
+            "x-cache: HIT from tile-cache-3\r\n",
+            "age: 5123\r\n",
+            "via: 1.1 varnish\r\n",
+            "strict-transport-security: max-age=31536000\r\n",
+            "\r\n",
+        };
+        h.run("http.parse_headers", [&](std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i)
+            {
+                net::ResponseHeaders hdr;
+                for (const auto& l : lines) hdr.parseLine(l);
+                bench::doNotOptimize(hdr);
+            }
+        });
+    }
+
+    // ---- Text layout (needs a GL context for the glyph atlas) ----
+    if (h.selected("text.measure"))
+    {
+        render::GlBootstrap gl;
+        render::TextRenderer text;
+        render::WindowConfig cfg{ 64, 64, "slippygl_bench", false };
+        if (noGl)
+        {
+            h.skip("text.measure", "--no-gl");
+        }
+        else if (!gl.init(cfg))
+        {
+            h.skip("text.measure", "no OpenGL context");
+        }
+        else if (!text.init())
+        {
+            h.skip("text.measure", "no font");
+        }
+        else
+        {
+            const std::string strings[] = { "\xC2\xA9 OpenStreetMap contributors", "14/13971/6344", "frame 16.67 ms" };
+            h.run("text.measure", [&](std::uint64_t n) {
+                float w = 0.0f, hgt = 0.0f;
+                for (std::uint64_t i = 0; i < n; ++i)
+                {
+                    text.measure(strings[i % 3], w, hgt);
+                    bench::doNotOptimize(w);
+                }
+            });
+            text.shutdown();
+        }
+        gl.shutdown();
+    }
+
+    printReport(h, corpusName, json);
+    return 0;
+}
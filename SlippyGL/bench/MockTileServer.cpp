@@ -0,0 +1,326 @@
+#include "MockTileServer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace slippygl::bench
+{
+namespace
+{
+#ifdef _WIN32
+    using NativeSocket = SOCKET;
+    void closeSocket(std::intptr_t s) { ::closesocket(static_cast<SOCKET>(s)); }
+    constexpr int kShutBoth = SD_BOTH;
+
+    // Winsock needs a process-wide WSAStartup before the first socket call
+    struct WinsockInit
+    {
+        WinsockInit() { WSADATA d; WSAStartup(MAKEWORD(2, 2), &d); }
+        ~WinsockInit() { WSACleanup(); }
+    };
+#else
+    using NativeSocket = int;
+    void closeSocket(std::intptr_t s) { ::close(static_cast<int>(s)); }
+    constexpr int kShutBoth = SHUT_RDWR;
+#endif
+
+    NativeSocket native(std::intptr_t s) { return static_cast<NativeSocket>(s); }
+
+    // Peer resets must not raise SIGPIPE in the benchmark process
+#ifdef MSG_NOSIGNAL
+    constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+    constexpr int kSendFlags = 0;
+#endif
+
+    bool iequalsPrefix(const std::string& line, const char* prefix)
+    {
+        const std::size_t n = std::strlen(prefix);
+        if (line.size() < n) return false;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (std::tolower(static_cast<unsigned char>(line[i])) != prefix[i]) return false;
+        }
+        return true;
+    }
+}
+
+MockTileServer::MockTileServer(MockServerConfig cfg)
+    : cfg_(cfg), rng_(cfg.seed)
+{
+#ifdef _WIN32
+    static WinsockInit winsock;
+#endif
+}
+
+MockTileServer::~MockTileServer()
+{
+    stop();
+}
+
+bool MockTileServer::start(std::string* err)
+{
+    if (running_) return true;
+
+    const NativeSocket ls = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+#ifdef _WIN32
+    if (ls == INVALID_SOCKET)
+#else
+    if (ls < 0)
+#endif
+    {
+        if (err) *err = "socket() failed";
+        return false;
+    }
+
+    int one = 1;
+    ::setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&one), sizeof(one));
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(static_cast<std::uint16_t>(cfg_.port));
+    if (::bind(ls, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 || ::listen(ls, 128) != 0)
+    {
+        if (err) *err = "bind/listen failed on port " + std::to_string(cfg_.port);
+        closeSocket(static_cast<std::intptr_t>(ls));
+        return false;
+    }
+
+    socklen_t len = sizeof(addr);
+    ::getsockname(ls, reinterpret_cast<sockaddr*>(&addr), &len);
+    port_ = ntohs(addr.sin_port);
+
+    listenSock_ = static_cast<Socket>(ls);
+    running_ = true;
+    acceptThread_ = std::thread(&MockTileServer::acceptLoop, this);
+    return true;
+}
+
+void MockTileServer::stop()
+{
+    if (!running_.exchange(false)) return;
+
+    // Unblock accept() and every recv()
+    ::shutdown(native(listenSock_), kShutBoth);
+    closeSocket(listenSock_);
+    if (acceptThread_.joinable()) acceptThread_.join();
+
+    std::vector<std::thread> workers;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        for (Socket c : clients_) ::shutdown(native(c), kShutBoth);
+        workers.swap(workers_);
+    }
+    for (auto& t : workers) t.join();
+    listenSock_ = -1;
+}
+
+void MockTileServer::acceptLoop()
+{
+    while (running_)
+    {
+        const NativeSocket c = ::accept(native(listenSock_), nullptr, nullptr);
+#ifdef _WIN32
+        if (c == INVALID_SOCKET) continue;
+#else
+        if (c < 0) continue;
+#endif
+        if (!running_)
+        {
+            closeSocket(static_cast<Socket>(c));
+            break;
+        }
+
+        int one = 1;
+        ::setsockopt(c, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&one), sizeof(one));
+
+        ++connections_;
+        std::lock_guard<std::mutex> lock(mu_);
+        clients_.insert(static_cast<Socket>(c));
+        workers_.emplace_back(&MockTileServer::serveConnection, this, static_cast<Socket>(c));
+    }
+}
+
+void MockTileServer::serveConnection(Socket s)
+{
+    std::string buf;
+    char chunk[4096];
+    bool keepAlive = true;
+
+    while (running_ && keepAlive)
+    {
+        // Requests may arrive pipelined; handle every complete header block
+        std::size_t end = buf.find("\r\n\r\n");
+        if (end == std::string::npos)
+        {
+            const int n = static_cast<int>(::recv(native(s), chunk, sizeof(chunk), 0));
+            if (n <= 0) break;
+            buf.append(chunk, static_cast<std::size_t>(n));
+            continue;
+        }
+
+        const std::string head = buf.substr(0, end);
+        buf.erase(0, end + 4);
+
+        // Request line: "GET /z/x/y.png HTTP/1.1"
+        const std::size_t lineEnd = head.find("\r\n");
+        const std::string requestLine = head.substr(0, lineEnd);
+        const std::size_t sp1 = requestLine.find(' ');
+        const std::size_t sp2 = requestLine.rfind(' ');
+        const std::string path = (sp1 != std::string::npos && sp2 > sp1)
+            ? requestLine.substr(sp1 + 1, sp2 - sp1 - 1) : std::string();
+        bool requestKeepAlive = requestLine.find("HTTP/1.1") != std::string::npos;
+
+        std::size_t pos = (lineEnd == std::string::npos) ? head.size() : lineEnd + 2;
+        while (pos < head.size())
+        {
+            std::size_t next = head.find("\r\n", pos);
+            if (next == std::string::npos) next = head.size();
+            const std::string line = head.substr(pos, next - pos);
+            if (iequalsPrefix(line, "connection:"))
+            {
+                requestKeepAlive = line.find("close") == std::string::npos;
+            }
+            pos = next + 2;
+        }
+
+        const std::string resp = buildResponse(path, keepAlive, requestKeepAlive);
+        if (!sendAll(s, resp.data(), resp.size())) break;
+        ++requests_;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        clients_.erase(s);
+    }
+    closeSocket(s);
+}
+
+std::string MockTileServer::buildResponse(const std::string& path, bool& keepAliveOut, bool requestKeepAlive)
+{
+    int delayMs = 0;
+    bool injectError = false;
+    bool injectThrottle = false;
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        delayMs = cfg_.latencyMs;
+        if (cfg_.jitterMs > 0)
+        {
+            std::uniform_int_distribution<int> jitter(-cfg_.jitterMs, cfg_.jitterMs);
+            delayMs += jitter(rng_);
+        }
+        if (cfg_.errorRate > 0.0)
+        {
+            injectError = std::uniform_real_distribution<double>(0.0, 1.0)(rng_) < cfg_.errorRate;
+        }
+        if (!injectError && cfg_.throttleRate > 0.0)
+        {
+            injectThrottle = std::uniform_real_distribution<double>(0.0, 1.0)(rng_) < cfg_.throttleRate;
+        }
+    }
+    if (delayMs > 0) std::this_thread::sleep_for(std::chrono::milliseconds(delayMs));
+
+    keepAliveOut = requestKeepAlive;
+    const char* conn = requestKeepAlive ? "keep-alive" : "close";
+
+    auto reply = [&](int status, const char* reason, const std::uint8_t* body, std::size_t size) {
+        std::string r = "HTTP/1.1 " + std::to_string(status) + " " + reason + "\r\n"
+                        "Content-Type: image/png\r\n";
+        if (status == 429 && cfg_.retryAfterSec >= 0)
+        {
+            r += "Retry-After: " + std::to_string(cfg_.retryAfterSec) + "\r\n";
+        }
+        r += "Content-Length: " + std::to_string(size) + "\r\n"
+             "Connection: " + conn + "\r\n\r\n";
+        if (size) r.append(reinterpret_cast<const char*>(body), size);
+        return r;
+    };
+
+    if (injectError)
+    {
+        ++errors_;
+        return reply(503, "Service Unavailable", nullptr, 0);
+    }
+    if (injectThrottle)
+    {
+        ++throttled_;
+        return reply(429, "Too Many Requests", nullptr, 0);
+    }
+
+    int z = 0, x = 0, y = 0;
+    if (std::sscanf(path.c_str(), "/%d/%d/%d.png", &z, &x, &y) != 3)
+    {
+        return reply(404, "Not Found", nullptr, 0);
+    }
+
+    if (cfg_.corpus)
+    {
+        // Spans stay valid while the source is open; only the lookup needs the lock
+        core::ByteSpan bytes;
+        bool found = false;
+        {
+            std::lock_guard<std::mutex> lock(cfg_.corpusMutex ? *cfg_.corpusMutex : corpusMu_);
+            found = cfg_.corpus->find(tile::TileKey(z, x, y), bytes);
+        }
+        if (!found)
+        {
+            return reply(404, "Not Found", nullptr, 0);
+        }
+        return reply(200, "OK", bytes.data(), bytes.size());
+    }
+
+    // Synthetic body: deterministic per tile so responses are cache-comparable
+    std::string body(cfg_.syntheticBodyBytes, '\0');
+    std::uint32_t h = static_cast<std::uint32_t>(z * 73856093) ^ static_cast<std::uint32_t>(x * 19349663)
+                    ^ static_cast<std::uint32_t>(y * 83492791);
+    for (auto& c : body)
+    {
+        h = h * 1664525u + 1013904223u;
+        c = static_cast<char>(h >> 24);
+    }
+    return reply(200, "OK", reinterpret_cast<const std::uint8_t*>(body.data()), body.size());
+}
+
+bool MockTileServer::sendAll(Socket s, const char* data, std::size_t size)
+{
+    // Bandwidth cap: send in slices and sleep so the per-connection rate stays under the cap
+    const std::size_t slice = cfg_.bandwidthBytesPerSec > 0.0 ? 8 * 1024 : size;
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t sent = 0;
+
+    while (sent < size)
+    {
+        const std::size_t want = std::min(slice, size - sent);
+        const int n = static_cast<int>(::send(native(s), data + sent, static_cast<int>(want), kSendFlags));
+        if (n <= 0) return false;
+        sent += static_cast<std::size_t>(n);
+        bytesSent_ += static_cast<std::uint64_t>(n);
+
+        if (cfg_.bandwidthBytesPerSec > 0.0)
+        {
+            const auto due = start + std::chrono::duration<double>(sent / cfg_.bandwidthBytesPerSec);
+            std::this_thread::sleep_until(due);
+        }
+    }
+    return true;
+}
+
+} // namespace slippygl::bench
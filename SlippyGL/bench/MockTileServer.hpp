@@ -0,0 +1,91 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+#include "tile/TileSource.hpp"
+
+namespace slippygl::bench
+{
+    /**
+     * Mock server behavior (all delays in milliseconds)
+     */
+    struct MockServerConfig
+    {
+        int port = 0;                       // 0 = ephemeral port
+        int latencyMs = 0;                  // base delay before each response
+        int jitterMs = 0;                   // uniform +/- jitter on top of latency
+        double errorRate = 0.0;             // fraction of requests answered with 503
+        double throttleRate = 0.0;          // fraction of requests answered with 429
+        int retryAfterSec = 1;              // Retry-After sent with 429 (-1 = omit header)
+        double bandwidthBytesPerSec = 0.0;  // per-connection send cap (0 = unlimited)
+        std::size_t syntheticBodyBytes = 16 * 1024;  // body size when no corpus is set
+        tile::TileSource* corpus = nullptr; // optional archive to serve (not owned)
+        // Serializes corpus->find() (TileSource isn't thread-safe). Servers sharing
+        // one corpus must share this mutex too; null = a per-server lock.
+        std::mutex* corpusMutex = nullptr;
+        std::uint32_t seed = 1234;          // RNG seed (reproducible runs)
+    };
+
+    /**
+     * Loopback HTTP/1.1 tile server for reproducible network tests/benchmarks
+     * - Serves GET /{z}/{x}/{y}.png from a TileSource corpus, or synthetic bytes
+     * - Keep-alive + pipelining, one thread per connection
+     * - Injects latency, jitter, 503 errors, 429 throttling and per-connection bandwidth caps
+     * - Counts accepted connections so connection reuse can be measured
+     */
+    class MockTileServer
+    {
+    public:
+        explicit MockTileServer(MockServerConfig cfg = {});
+        ~MockTileServer();
+
+        MockTileServer(const MockTileServer&) = delete;
+        MockTileServer& operator=(const MockTileServer&) = delete;
+
+        /// Bind 127.0.0.1 and start accepting. Returns false on socket errors.
+        bool start(std::string* err = nullptr);
+        void stop();
+
+        int port() const noexcept { return port_; }
+        std::string baseUrl() const { return "http://127.0.0.1:" + std::to_string(port_); }
+
+        std::uint64_t connectionsAccepted() const noexcept { return connections_.load(); }
+        std::uint64_t requestsServed() const noexcept { return requests_.load(); }
+        std::uint64_t errorsInjected() const noexcept { return errors_.load(); }
+        std::uint64_t throttled() const noexcept { return throttled_.load(); }
+        std::uint64_t bytesSent() const noexcept { return bytesSent_.load(); }
+
+    private:
+        using Socket = std::intptr_t;
+
+        MockServerConfig cfg_;
+        Socket listenSock_ = -1;
+        int port_ = 0;
+        std::atomic<bool> running_{ false };
+        std::thread acceptThread_;
+
+        std::mutex mu_;                          // guards workers_, clients_, rng_
+        std::mutex corpusMu_;                    // corpus lock when cfg_.corpusMutex is null
+        std::vector<std::thread> workers_;
+        std::unordered_set<Socket> clients_;
+        std::mt19937 rng_;
+
+        std::atomic<std::uint64_t> connections_{ 0 };
+        std::atomic<std::uint64_t> requests_{ 0 };
+        std::atomic<std::uint64_t> errors_{ 0 };
+        std::atomic<std::uint64_t> throttled_{ 0 };
+        std::atomic<std::uint64_t> bytesSent_{ 0 };
+
+        void acceptLoop();
+        void serveConnection(Socket s);
+        bool sendAll(Socket s, const char* data, std::size_t size);
+        std::string buildResponse(const std::string& path, bool& keepAliveOut, bool requestKeepAlive);
+    };
+
+} // namespace slippygl::bench
@@ -0,0 +1,197 @@
+// Network download-path benchmark against the loopback MockTileServer.
+//
+// Drives TileDownloader -> HttpClient -> libcurl through a reproducible
+// server (latency/jitter/errors/bandwidth) and reports throughput, latency
+// percentiles and how many TCP connections were opened.
+//
+// usage: slippygl_netbench [--tiles=N] [--threads=N] [--latency-ms=N]
+//          [--jitter-ms=N] [--error-rate=F] [--bandwidth-kbps=N]
+//          [--body-bytes=N] [--corpus=<archive>] [--zoom=N] [--json]
+//          [--throttle-rate=F] [--rps=F] [--max-conns=N]
+//          [--mirrors=N] [--slow-mirror-ms=N] [--bad-mirror-error-rate=F]
+//          [--no-share]
+#include <spdlog/spdlog.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "BenchUtil.hpp"
+#include "MockTileServer.hpp"
+#include "net/HttpClient.hpp"
+#include "net/TileEndpoint.hpp"
+#include "tile/TileDownloader.hpp"
+#include "tile/TileSource.hpp"
+
+using namespace slippygl;
+
+int main(int argc, char** argv)
+{
+    spdlog::set_level(spdlog::level::err);
+
+    const int tiles   = static_cast<int>(bench::argDouble(argc, argv, "--tiles", 500));
+    const int threads = std::max(1, static_cast<int>(bench::argDouble(argc, argv, "--threads", 1)));
+    const int zoom    = static_cast<int>(bench::argDouble(argc, argv, "--zoom", 12));
+    const bool json   = bench::argFlag(argc, argv, "--json");
+
+    bench::MockServerConfig scfg;
+    scfg.latencyMs  = static_cast<int>(bench::argDouble(argc, argv, "--latency-ms", 20));
+    scfg.jitterMs   = static_cast<int>(bench::argDouble(argc, argv, "--jitter-ms", 5));
+    scfg.errorRate  = bench::argDouble(argc, argv, "--error-rate", 0.0);
+    scfg.throttleRate = bench::argDouble(argc, argv, "--throttle-rate", 0.0);
+    scfg.bandwidthBytesPerSec = bench::argDouble(argc, argv, "--bandwidth-kbps", 0) * 1024.0;
+    scfg.syntheticBodyBytes = static_cast<std::size_t>(bench::argDouble(argc, argv, "--body-bytes", 16 * 1024));
+
+    std::unique_ptr<tile::TileSource> corpus;
+    std::mutex corpusMu;   // one lock for every mirror serving the corpus
+    const std::string corpusPath = bench::argValue(argc, argv, "--corpus", "");
+    if (!corpusPath.empty()) {
+        std::string err;
+        corpus = tile::openTileSource(corpusPath, &err);
+        if (!corpus) {
+            spdlog::error("{}", err);
+            return 1;
+        }
+        scfg.corpus = corpus.get();
+        scfg.corpusMutex = &corpusMu;
+    }
+
+    // Mirrors: N identical servers behind one "{s}/{z}/{x}/{y}.png" template.
+    // Mirror 0 can be degraded (extra latency / errors) to exercise host weighting.
+    const int mirrors = std::max(1, static_cast<int>(bench::argDouble(argc, argv, "--mirrors", 1)));
+    std::vector<std::unique_ptr<bench::MockTileServer>> servers;
+    std::vector<std::string> hosts;
+    for (int m = 0; m < mirrors; ++m) {
+        bench::MockServerConfig mcfg = scfg;
+        mcfg.seed += static_cast<std::uint32_t>(m);
+        if (m == 0 && mirrors > 1) {
+            mcfg.latencyMs += static_cast<int>(bench::argDouble(argc, argv, "--slow-mirror-ms", 0));
+            mcfg.errorRate = bench::argDouble(argc, argv, "--bad-mirror-error-rate", mcfg.errorRate);
+        }
+        servers.push_back(std::make_unique<bench::MockTileServer>(mcfg));
+        std::string err;
+        if (!servers.back()->start(&err)) {
+            spdlog::error("Mock server failed: {}", err);
+            return 1;
+        }
+        hosts.push_back(servers.back()->baseUrl());
+    }
+    auto total = [&](std::uint64_t (bench::MockTileServer::*counter)() const noexcept) {
+        unsigned long long sum = 0;
+        for (const auto& sv : servers) sum += ((*sv).*counter)();
+        return sum;
+    };
+
+    net::TileEndpoint endpoint("{s}/{z}/{x}/{y}.png");
+    endpoint.setHosts(hosts);
+
+    // Tiles walk a square around a fixed origin so every request is distinct
+    const int side = 1 << std::min(zoom, 15);
+    std::atomic<int> next{ 0 };
+    std::atomic<int> ok{ 0 }, failed{ 0 };
+    std::mutex latMu;
+    std::vector<double> latenciesMs;
+    latenciesMs.reserve(static_cast<std::size_t>(tiles));
+
+    // One governor shared by all clients so the per-host limits hold across threads
+    net::GovernorConfig gcfg;
+    gcfg.setRequestsPerSec(bench::argDouble(argc, argv, "--rps", 0.0))
+        .setMaxConnectionsPerHost(static_cast<int>(bench::argDouble(argc, argv, "--max-conns", threads)));
+    auto governor = std::make_shared<net::HostGovernor>(gcfg);
+    // Shared DNS/TLS-session cache unless --no-share (cold-handshake baseline).
+    // Connections stay per client: libcurl's shared connection cache is not thread-safe.
+    auto share = bench::argFlag(argc, argv, "--no-share") ? nullptr : std::make_shared<net::CurlShare>();
+
+    // Clients are created up front: curl global init is not thread-safe on older libcurl
+    auto telemetry = std::make_shared<net::NetTelemetry>(static_cast<std::size_t>(std::max(tiles, 1)));
+    std::vector<std::unique_ptr<net::HttpClient>> clients;
+    for (int t = 0; t < threads; ++t) {
+        net::NetConfig cfg;
+        cfg.setUserAgent("SlippyGL-netbench/0.1").setHttp2(true).setPoliteness(gcfg);
+        // Without a shared handle each client still gets its own (per-client reuse only)
+        clients.push_back(std::make_unique<net::HttpClient>(cfg, governor, share));
+        clients.back()->setTelemetry(telemetry);
+    }
+
+    const auto t0 = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t] {
+            tile::TileDownloader downloader(*clients[t], endpoint);
+            std::vector<double> local;
+            for (int i = next++; i < tiles; i = next++) {
+                const core::TileID id(zoom, i % side, (i / side) % side);
+                const auto s = std::chrono::steady_clock::now();
+                const auto r = downloader.ensureRaster(id);
+                const auto e = std::chrono::steady_clock::now();
+                local.push_back(std::chrono::duration<double, std::milli>(e - s).count());
+                if (r.ok()) ++ok; else ++failed;
+            }
+            std::lock_guard<std::mutex> lock(latMu);
+            latenciesMs.insert(latenciesMs.end(), local.begin(), local.end());
+        });
+    }
+    for (auto& w : workers) w.join();
+    const double wallSec = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+    for (auto& sv : servers) sv->stop();
+
+    const double p50 = bench::percentile(latenciesMs, 50.0);
+    const double p99 = bench::percentile(latenciesMs, 99.0);
+    const double tilesPerSec = wallSec > 0.0 ? ok.load() / wallSec : 0.0;
+    net::HostStats hs;
+    for (const auto& [host, st] : governor->snapshot()) {
+        hs.waited += st.waited;
+        hs.totalWaitMs += st.totalWaitMs;
+        hs.maxWaitMs = std::max(hs.maxWaitMs, st.maxWaitMs);
+        hs.throttled += st.throttled;
+    }
+    const auto health = endpoint.health();
+
+    if (json) {
+        std::printf("{\"bench\":\"net\",\"tiles\":%d,\"threads\":%d,\"ok\":%d,\"failed\":%d,"
+                    "\"wall_s\":%.3f,\"tiles_per_s\":%.1f,\"p50_ms\":%.2f,\"p99_ms\":%.2f,"
+                    "\"connections\":%llu,\"requests\":%llu,\"errors_injected\":%llu,\"bytes\":%llu,"
+                    "\"throttled\":%llu,\"governor_waits\":%llu,\"governor_wait_ms\":%.1f,\"governor_max_wait_ms\":%.1f,"
+                    "\"mirror_requests\":[",
+                    tiles, threads, ok.load(), failed.load(), wallSec, tilesPerSec, p50, p99,
+                    total(&bench::MockTileServer::connectionsAccepted),
+                    total(&bench::MockTileServer::requestsServed),
+                    total(&bench::MockTileServer::errorsInjected),
+                    total(&bench::MockTileServer::bytesSent),
+                    static_cast<unsigned long long>(hs.throttled),
+                    static_cast<unsigned long long>(hs.waited), hs.totalWaitMs, hs.maxWaitMs);
+        for (std::size_t m = 0; m < health.size(); ++m) {
+            std::printf("%s%llu", m ? "," : "", static_cast<unsigned long long>(health[m].requests));
+        }
+        std::printf("],\"telemetry\":%s}\n", telemetry->toJson().c_str());
+    } else {
+        std::printf("tiles       : %d ok / %d failed (%d threads)\n", ok.load(), failed.load(), threads);
+        std::printf("throughput  : %.1f tiles/s over %.2f s\n", tilesPerSec, wallSec);
+        std::printf("latency     : p50 %.2f ms, p99 %.2f ms\n", p50, p99);
+        std::printf("connections : %llu for %llu requests (%llu errors injected)\n",
+                    total(&bench::MockTileServer::connectionsAccepted),
+                    total(&bench::MockTileServer::requestsServed),
+                    total(&bench::MockTileServer::errorsInjected));
+        std::printf("governor    : %llu waits, %.1f ms total, %.1f ms max, %llu throttled\n",
+                    static_cast<unsigned long long>(hs.waited), hs.totalWaitMs, hs.maxWaitMs,
+                    static_cast<unsigned long long>(hs.throttled));
+        const auto ns = telemetry->summary();
+        std::printf("requests    : %llu (%llu on reused connections), ttfb p50 %.2f ms / p99 %.2f ms\n",
+                    static_cast<unsigned long long>(ns.requests),
+                    static_cast<unsigned long long>(ns.reusedConnections), ns.ttfbP50, ns.ttfbP99);
+        if (health.size() > 1) {
+            for (const auto& h : health) {
+                std::printf("mirror      : %s  %llu req, ewma %.1f ms, fail %.2f, weight %.2f\n",
+                            h.host.c_str(), static_cast<unsigned long long>(h.requests),
+                            h.latencyMs, h.failureRate, h.weight);
+            }
+        }
+    }
+    return failed.load() == 0 ? 0 : 3;
+}
@@ -1,7 +1,16 @@
 #include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
 
 #include <spdlog/spdlog.h>
 
+#include "core/FrameStats.hpp"
+#include "core/Profiler.hpp"
 #include "core/TileMath.hpp"
 #include "core/Types.hpp"
 #include "net/HttpClient.hpp"
@@ -12,10 +21,64 @@
 #include "render/QuadRenderer.hpp"
 #include "render/TextRenderer.hpp"
 #include "render/Camera2D.hpp"
+#include "render/CameraPath.hpp"
 #include "render/InputHandler.hpp"
+#include "render/ZoomBlend.hpp"
 #include "tile/TileCache.hpp"
 #include "tile/TileRenderer.hpp"
 #include "tile/TileKey.hpp"
+#include "tile/TileSource.hpp"
+
+/**
+ * 실행 옵션 (main의 명령줄 인자에서 채운다)
+ */
+struct DemoOptions
+{
+    const char* archivePath = nullptr;   // .pmtiles / 타일 팩
+    const char* tracePath = nullptr;     // --profile[=trace.json]
+
+    // 입력 기록/재생 (InputLog 이진 포맷)
+    const char* recordPath = nullptr;    // --record=session.input
+    const char* replayPath = nullptr;    // --replay=session.input
+
+    // 리플레이 벤치마크 (--bench[=path.txt]). --replay와 함께 쓰면 입력 로그가 카메라를 움직인다.
+    bool bench = false;
+    const char* benchPath = nullptr;     // 카메라 경로 스크립트, nullptr = 내장 시나리오
+    int benchFrames = 0;                 // --frames=N, 0 = 경로/로그 한 바퀴
+    const char* benchOut = nullptr;      // --bench-out=result.json, nullptr = stdout
+
+    bool continuous = false;             // --continuous: 변화가 없어도 매 프레임 다시 그린다
+    bool mipmaps = true;                 // --no-mipmaps: 축소 시 trilinear 대신 NEAREST (타일 메모리 3/4)
+    bool bc1 = false;                    // --bc1: 불투명 타일을 BC1로 압축해 저장 (타일 메모리 1/8)
+    // --tile-format=rgba8|lossless|compact: 타일 텍스처 포맷 정책 (기본 rgba8, 팔레트 R8은 --no-mipmaps일 때만)
+    slippygl::tile::TileRenderer::TileStorage storage = slippygl::tile::TileRenderer::TileStorage::kRGBA8;
+};
+
+/**
+ * 화면 내용을 결정하는 상태. 직전에 그린 프레임과 같으면 다시 그리지 않는다.
+ */
+struct ViewState
+{
+    glm::dvec2 origin{ 0.0 };
+    float scale = 0.0f;
+    int tileZoom = -1;
+    int fadeFromZoom = -1;               // 줌 크로스페이드 중인 이전 레벨
+    float fadeIn = 1.0f;
+    int fbW = 0;
+    int fbH = 0;
+    bool debug = false;
+    bool profiler = false;
+    std::uint64_t cacheGeneration = 0;   // 상주 타일 집합 (로드/축출 시 변경)
+
+    bool operator==(const ViewState& o) const noexcept
+    {
+        return origin == o.origin && scale == o.scale && tileZoom == o.tileZoom
+            && fadeFromZoom == o.fadeFromZoom && fadeIn == o.fadeIn
+            && fbW == o.fbW && fbH == o.fbH && debug == o.debug && profiler == o.profiler
+            && cacheGeneration == o.cacheGeneration;
+    }
+    bool operator!=(const ViewState& o) const noexcept { return !(*this == o); }
+};
 
 /**
  * OpenGL 멀티 타일 렌더링 데모
@@ -24,21 +87,55 @@
  *
  * 캐시는 인메모리 LRU(TileCache)만 사용한다. 타일을 디스크에 저장하지 않는다.
  * (OSM 타일 정책 준수)
+ *
+ * archivePath가 주어지면 로컬 아카이브(PMTiles 또는 타일 팩, 오프라인 배포용)를
+ * 메모리 맵으로 열어 우선 사용하고, 아카이브에 없는 타일만 네트워크로 받는다.
+ *
+ * tracePath가 주어지면 프로파일러를 켠 채로 실행하고, 종료 시 링 버퍼에 남은
+ * 구간들을 Chrome trace JSON(chrome://tracing, Perfetto)으로 저장한다.
+ *
+ * bench 모드는 카메라 경로(스크립트 또는 내장 시나리오)를 프레임 단위로 재생해
+ * 고정 프레임 수만큼 그린 뒤 프레임 시간 백분위·타일 처리량·캐시 적중률을 JSON으로
+ * 출력한다. 결과가 네트워크에 좌우되지 않도록 로컬 아카이브만 사용하고 VSync를 끈다.
+ *
+ * --record는 세션의 입력 이벤트와 프레임 dt를 로그로 남기고, --replay는 라이브 입력
+ * 대신 그 로그를 재생한다 (현장에서 받은 세션으로 끊김 재현).
+ *
+ * 카메라·뷰포트·오버레이 모드·상주 타일이 그대로면 프레임을 그리지 않고 이벤트를
+ * 기다린다 (하루 종일 켜 두는 키오스크/노트북에서 정지 화면의 CPU·GPU 사용량 ~0%).
+ * 아직 placeholder로 그린 타일이 있으면 짧은 timeout으로 깨어나 다시 시도한다.
  */
-void RunTileRenderDemo()
+int RunTileRenderDemo(const DemoOptions& opts)
 {
     using namespace slippygl;
+    const char* archivePath = opts.archivePath;
+    const char* tracePath = opts.tracePath;
+
+    // 디버깅을 위해 로그 레벨 설정 (벤치마크는 로그 비용이 측정에 섞이지 않게 warn)
+    spdlog::set_level(opts.bench ? spdlog::level::warn : spdlog::level::debug);
 
-    // 디버깅을 위해 로그 레벨 설정
-    spdlog::set_level(spdlog::level::debug);
+    render::CameraPath benchPath;
+    if (opts.bench) {
+        if (!archivePath) {
+            spdlog::error("--bench needs a local tile archive (.pmtiles / tile pack)");
+            return 2;
+        }
+        std::string err;
+        if (!opts.benchPath) {
+            benchPath = render::CameraPath::builtin();
+        } else if (!render::CameraPath::load(opts.benchPath, benchPath, &err)) {
+            spdlog::error("Camera path: {}", err);
+            return 2;
+        }
+    }
 
     // 1) OpenGL 컨텍스트/윈도우 초기화
     render::GlBootstrap gl;
-    render::WindowConfig winCfg{ 800, 600, "SlippyGL - Multi-Tile Render (WASD/Drag=Pan, Scroll=Zoom, R=Reset, F3=Debug)" };
+    render::WindowConfig winCfg{ 800, 600, "SlippyGL - Multi-Tile Render (WASD/Drag=Pan, Scroll=Zoom, R=Reset, F2=Profiler, F3=Debug)" };
 
     if (!gl.init(winCfg)) {
         spdlog::error("OpenGL initialization failed");
-        return;
+        return 1;
     }
 
     // 2) 렌더링 모듈 초기화
@@ -47,7 +144,7 @@ void RunTileRenderDemo()
 
     if (!quadRenderer.init()) {
         spdlog::error("QuadRenderer initialization failed");
-        return;
+        return 1;
     }
 
     // 저작자 표시 오버레이 (OSM 정책 필수). 폰트 로드 실패해도 앱은 계속 동작.
@@ -72,8 +169,30 @@ void RunTileRenderDemo()
     tile::TileDownloader downloader(http, endpoint);
 
     // 5) TileRenderer 초기화 (인메모리 LRU 텍스처 캐시 포함)
-    tile::TileCache texCache(128 * 1024 * 1024); // 128MB texture budget
+    // 128MB texture budget. 제거는 TextureManager를 거쳐 포맷 표에서도 빠지게 한다 (texMgr가 더 오래 산다)
+    tile::TileCache texCache(128 * 1024 * 1024,
+                             [&texMgr](render::TexHandle tex) { texMgr.destroy(tex); });
     tile::TileRenderer tileRenderer(texCache, downloader, texMgr);
+    tileRenderer.setMipmaps(opts.mipmaps);
+    tileRenderer.setCompression(opts.bc1);
+    tileRenderer.setStorage(opts.storage);
+
+    // (선택) 로컬 타일 아카이브 (.pmtiles / 타일 팩)
+    std::unique_ptr<tile::TileSource> archive;
+    if (archivePath) {
+        std::string err;
+        archive = tile::openTileSource(archivePath, &err);
+        if (archive) {
+            tileRenderer.setTileSource(archive.get());
+            spdlog::info("Using tile archive {} (z{}-{})",
+                archivePath, archive->minZoom(), archive->maxZoom());
+        } else if (opts.bench) {
+            spdlog::error("Tile archive: {}", err);
+            return 2;
+        } else {
+            spdlog::warn("Tile archive disabled: {}", err);
+        }
+    }
 
     // 6) 초기 카메라 위치 설정 (서울시청 근처, 줌 12)
     constexpr double lat = 37.5665;
@@ -89,44 +208,103 @@ void RunTileRenderDemo()
         seoulTile.toString(), worldPos.x, worldPos.y);
 
     // 카메라를 서울시청 타일 중심으로 이동
-    camera.setWorldOrigin(glm::vec2(
-        worldPos.x + tile::kTileSizePx / 2.0f,
-        worldPos.y + tile::kTileSizePx / 2.0f));
+    camera.setWorldOrigin(glm::dvec2(
+        worldPos.x + tile::kTileSizePx / 2.0,
+        worldPos.y + tile::kTileSizePx / 2.0));
 
     // 8) 렌더 루프
     spdlog::info("Entering render loop");
-    spdlog::info("Controls: WASD/Arrows or Drag=Pan, Scroll=Zoom, R=Reset, F3=Debug overlay, ESC=Exit");
+    spdlog::info("Controls: WASD/Arrows or Drag=Pan, Scroll=Zoom, R=Reset, F2=Profiler, F3=Debug overlay, ESC=Exit");
     spdlog::info("Visible tiles will be loaded dynamically");
 
     int frameCount = 0;
     int tileZoom = initialZoom;       // 현재 타일 줌 레벨(프레임 간 유지되는 상태)
     int lastZoomLevel = initialZoom;  // 로그 출력용 직전 값
+    render::ZoomBlend zoomBlend;      // 레벨 전환 히스테리시스 + 크로스페이드
+    zoomBlend.reset(tileZoom);
+
+    // 프로파일러: --profile이면 처음부터 기록, 아니면 F2로 켤 때만 기록
+    core::Profiler::setThreadName("main");
+    core::Profiler::setEnabled(tracePath != nullptr);
+
+    // 입력 재생/기록은 초기 카메라가 정해진 뒤에 시작한다
+    if (opts.replayPath) {
+        std::string err;
+        if (!inputHandler.startPlayback(opts.replayPath, &err)) {
+            spdlog::error("Input replay: {}", err);
+            return 2;
+        }
+    } else if (opts.recordPath) {
+        std::string err;
+        if (!inputHandler.startRecording(opts.recordPath, &err)) {
+            spdlog::warn("Input recording disabled: {}", err);
+        }
+    }
+
+    // 벤치마크: 네트워크 없이 아카이브만, VSync 없이 최대 속도로
+    core::FrameStats benchStats;
+    const bool benchReplay = opts.bench && opts.replayPath;
+    const char* benchScenario = benchReplay ? opts.replayPath : (opts.benchPath ? opts.benchPath : "builtin");
+    int benchFrames = 0;
+    if (opts.bench) {
+        const int pass = static_cast<int>(benchReplay ? inputHandler.playbackTotalFrames() : benchPath.frameCount());
+        benchFrames = opts.benchFrames > 0 ? opts.benchFrames : pass;
+        if (benchReplay) benchFrames = std::min(benchFrames, pass);   // 로그 너머는 재생할 수 없다
+        tileRenderer.setNetworkFetch(false);
+        gl.setVSync(false);
+        benchStats.reserve(static_cast<std::size_t>(benchFrames));
+        spdlog::warn("Benchmark: {} frames of {} ({} frames per pass)", benchFrames, benchScenario, pass);
+    }
+
+    // 유휴 프레임 생략: 벤치마크는 모든 프레임을 그려야 측정이 된다
+    constexpr double kIdleWaitSec = 1.0;    // 변화 없음: 이벤트가 올 때까지 (안전용 상한)
+    constexpr double kRetryWaitSec = 0.25;  // 로드 실패한 타일이 남음: 재시도 간격
+    const bool skipIdle = !opts.bench && !opts.continuous;
+    ViewState drawn;
+    bool drewLastIteration = true;
+    auto lastDraw = std::chrono::steady_clock::now();
+    auto lastFade = lastDraw;
+    // 벤치마크는 크로스페이드 길이가 프레임 시간에 흔들리지 않도록 고정 스텝으로 진행한다
+    constexpr double kBenchFadeDt = 1.0 / 60.0;
 
     while (!gl.shouldClose()) {
-        gl.poll();
+        // 직전 반복에서 아무것도 바뀌지 않았으면 입력/타이머까지 블록한다.
+        // 재생 중에는 실제 이벤트가 오지 않으므로 기다리지 않는다.
+        const bool idle = skipIdle && !drewLastIteration && !inputHandler.isPlaying();
+        if (idle) {
+            gl.waitEvents(tileRenderer.lastPendingTiles() > 0 ? kRetryWaitSec : kIdleWaitSec);
+            inputHandler.resetFrameClock();
+        }
 
-        // WASD(+방향키) 패닝 — 부드러운 가속/감속
-        inputHandler.update();
+        const auto frameStart = std::chrono::steady_clock::now();
+        {
+            SLIPPYGL_ZONE("frame.input");
+            if (!idle) gl.poll();
 
-        gl.beginFrame(0.2f, 0.2f, 0.3f);  // 진한 파란색 배경
+            // WASD(+방향키) 패닝 — 부드러운 가속/감속 (재생 중이면 로그의 입력)
+            // 경로 벤치마크는 CameraPath가 카메라를 결정하므로 입력을 쓰지 않는다
+            if (!opts.bench || benchReplay) inputHandler.update();
+        }
+        core::Profiler::setEnabled(tracePath != nullptr || inputHandler.profilerMode());
 
         // 프레임버퍼 크기 가져오기
         const int fbW = gl.width();
         const int fbH = gl.height();
 
-        // 카메라 스케일이 임계치를 넘으면 타일 줌 레벨을 한 단계 바꾸고
-        // 카메라 좌표계를 재매핑한다(화면 뷰는 그대로 보존). 월드 픽셀 좌표계가
-        // 항상 현재 타일 줌과 일치하도록 유지해야 타일이 정상 표시된다.
-        // (scale이 두 배가 되면 한 레벨 인, 절반이 되면 한 레벨 아웃)
-        constexpr int kMinZoom = 0;
-        constexpr int kMaxZoom = 19;
-        while (camera.scale() > 2.0f && tileZoom < kMaxZoom) {
-            ++tileZoom;
-            camera.applyZoomStep(2.0f);   // worldOrigin*2, scale/2
+        if (opts.bench && !benchReplay) {
+            render::CameraPath::apply(benchPath.pose(benchStats.frames()), camera, tileZoom, fbW, fbH);
         }
-        while (camera.scale() < 0.5f && tileZoom > kMinZoom) {
-            --tileZoom;
-            camera.applyZoomStep(0.5f);   // worldOrigin/2, scale*2
+
+        // 카메라 스케일이 임계치를 넘으면 타일 줌 레벨을 바꾸고 카메라 좌표계를
+        // 재매핑한다(화면 뷰는 그대로 보존). 월드 픽셀 좌표계가 항상 현재 타일 줌과
+        // 일치하도록 유지해야 타일이 정상 표시된다. 임계치(2^±0.6)에 히스테리시스가
+        // 있어 경계에서 흔들려도 레벨이 왔다 갔다 하지 않고, 한 레벨 전환은 이전 레벨
+        // 위로 새 레벨이 타일이 도착하는 만큼 페이드 인된다.
+        // 월드 좌표는 double이라 z22(2^30 px)에서도 흔들림이 없다. z19 너머는 오버줌.
+        constexpr int kMinZoom = 0;
+        constexpr int kMaxZoom = 22;
+        if (zoomBlend.update(camera, tileZoom, kMinZoom, kMaxZoom)) {
+            lastFade = frameStart;   // 페이드 시간은 전환 시점부터
         }
 
         // 줌 레벨이 바뀌면 로그 출력
@@ -136,30 +314,136 @@ void RunTileRenderDemo()
             lastZoomLevel = tileZoom;
         }
 
-        // TileRenderer로 화면에 보이는 모든 타일 렌더링
-        const int tilesRendered = tileRenderer.drawTiles(quadRenderer, camera, tileZoom, fbW, fbH);
-
-        // 디버그 오버레이(F3 토글): 타일 경계 + z/x/y
-        if (inputHandler.debugMode()) {
-            tileRenderer.drawDebugOverlay(overlay, camera, tileZoom, fbW, fbH);
+        // 손상 추적: 그릴 내용이 바뀌었을 때만 렌더링한다.
+        // 로드 실패로 placeholder가 남았으면 kRetryWaitSec마다 다시 그려 재시도한다.
+        ViewState view;
+        view.origin = camera.worldOrigin();
+        view.scale = camera.scale();
+        view.tileZoom = tileZoom;
+        view.fadeFromZoom = zoomBlend.fromZoom();
+        view.fadeIn = zoomBlend.blend();
+        view.fbW = fbW;
+        view.fbH = fbH;
+        view.debug = inputHandler.debugMode();
+        view.profiler = inputHandler.profilerMode();
+        view.cacheGeneration = texCache.generation();
+
+        const bool retryDue = tileRenderer.lastPendingTiles() > 0
+            && std::chrono::duration<double>(frameStart - lastDraw).count() >= kRetryWaitSec;
+        const bool refresh = gl.consumeRefresh();
+        drewLastIteration = !skipIdle || view != drawn || retryDue || refresh;
+        if (!drewLastIteration) {
+            continue;
         }
+        drawn = view;
+        lastDraw = frameStart;
+
+        gl.beginFrame(0.2f, 0.2f, 0.3f);  // 진한 파란색 배경
 
-        // 저작자 표시(우하단 상시 노출) — 항상 최상단에 그린다
-        overlay.drawAttribution(fbW, fbH);
+        // TileRenderer로 화면에 보이는 모든 타일 렌더링
+        const int tilesRendered = tileRenderer.drawTiles(quadRenderer, camera, tileZoom, fbW, fbH,
+            zoomBlend.fromZoom(), zoomBlend.blend());
+
+        // 다음 프레임의 페이드: 시간만큼 진행하되 새 레벨 타일이 도착한 비율을 넘지 않는다
+        const double fadeDt = opts.bench ? kBenchFadeDt
+                                         : std::chrono::duration<double>(frameStart - lastFade).count();
+        zoomBlend.advance(fadeDt, tileRenderer.lastCoverage());
+        lastFade = frameStart;
+
+        {
+            SLIPPYGL_ZONE("frame.overlay");
+
+            // 오버레이 전체(디버그 격자, 프로파일러, 저작자 표시)를 한 배치로 모아 드로우 한 번에 그린다
+            overlay.beginBatch(fbW, fbH);
+
+            // 디버그 오버레이(F3 토글): 타일 경계 + z/x/y
+            if (inputHandler.debugMode()) {
+                tileRenderer.drawDebugOverlay(overlay, camera, tileZoom, fbW, fbH);
+            }
+
+            // 프로파일러 오버레이(F2 토글): 프레임당 평균 시간 상위 구간 (좌상단)
+            if (inputHandler.profilerMode()) {
+                char line[128];
+                std::snprintf(line, sizeof(line), "frame %.2f ms", core::Profiler::avgFrameMs());
+                float y = 8.0f;
+                const glm::vec4 fg(1.0f), bg(0.0f, 0.0f, 0.0f, 0.6f);
+                overlay.drawTextBoxed(line, 8.0f, y, fg, bg, 4.0f, fbW, fbH);
+                const auto zones = core::Profiler::summary();
+                for (std::size_t i = 0; i < zones.size() && i < 8; ++i) {
+                    std::snprintf(line, sizeof(line), "%-14s %6.2f ms  max %6.2f  x%.1f",
+                        zones[i].name, zones[i].avgMsPerFrame, zones[i].maxMs, zones[i].callsPerFrame);
+                    y += 22.0f;
+                    overlay.drawTextBoxed(line, 8.0f, y, fg, bg, 4.0f, fbW, fbH);
+                }
+            }
+
+            // 저작자 표시(우하단 상시 노출) — 항상 최상단에 그린다
+            overlay.drawAttribution(fbW, fbH);
+            overlay.endBatch();
+        }
 
         // 프레임 카운터 (주기적으로 통계 출력)
         if (++frameCount % 60 == 0) {
-            spdlog::debug("Frame {}: rendered {} tiles, cache: {} MB / {} MB",
+            spdlog::debug("Frame {}: rendered {} tiles, cache: {} MB / {} MB, {} tiles in {} textures",
                 frameCount, tilesRendered,
                 texCache.usedBytes() / (1024 * 1024),
-                texCache.budgetBytes() / (1024 * 1024));
+                texCache.budgetBytes() / (1024 * 1024),
+                texCache.size(), texCache.textureCount());
+            const auto net = http.telemetry()->summary();
+            if (net.requests > 0) {
+                spdlog::debug("Network: {} req ({} reused), ttfb p50 {:.1f} ms / p99 {:.1f} ms, total p99 {:.1f} ms",
+                    net.requests, net.reusedConnections, net.ttfbP50, net.ttfbP99, net.totalP99);
+            }
+        }
+
+        {
+            SLIPPYGL_ZONE("frame.swap");
+            gl.endFrame();
+        }
+        core::Profiler::endFrame();
+
+        if (opts.bench) {
+            core::FrameSample sample;
+            sample.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+            sample.tilesDrawn = tileRenderer.lastTileCount();
+            sample.cacheHits = tileRenderer.lastCacheHits();
+            sample.tilesLoaded = tileRenderer.lastLocalLoads() + tileRenderer.lastDownloads();
+            sample.bytesFetched = tileRenderer.lastBytesFetched();
+            benchStats.add(sample);
+            if (static_cast<int>(benchStats.frames()) >= benchFrames) break;
         }
+    }
 
-        gl.endFrame();
+    // 벤치마크 결과 (한 줄 JSON)
+    int exitCode = 0;
+    if (opts.bench) {
+        const std::string json = benchStats.toJson(benchScenario);
+        if (static_cast<int>(benchStats.frames()) < benchFrames) {
+            spdlog::error("Benchmark aborted after {} of {} frames", benchStats.frames(), benchFrames);
+            exitCode = 3;
+        }
+        if (!opts.benchOut) {
+            std::printf("%s\n", json.c_str());
+        } else if (std::FILE* f = std::fopen(opts.benchOut, "wb")) {
+            std::fprintf(f, "%s\n", json.c_str());
+            std::fclose(f);
+        } else {
+            spdlog::error("Cannot write benchmark result: {}", opts.benchOut);
+            exitCode = 1;
+        }
     }
 
     // 9) 리소스 정리
     spdlog::info("Shutting down...");
+    spdlog::info("Network telemetry: {}", http.telemetry()->toJson());
+    if (tracePath) {
+        std::string err;
+        if (core::Profiler::writeChromeTrace(tracePath, &err)) {
+            spdlog::info("Profiler trace written to {}", tracePath);
+        } else {
+            spdlog::warn("Profiler trace not written: {}", err);
+        }
+    }
     inputHandler.detach();
     texCache.clear();
     overlay.shutdown();
@@ -167,12 +451,53 @@ void RunTileRenderDemo()
     gl.shutdown();
 
     spdlog::info("Done.");
+    return exitCode;
 }
 
-int main()
+int main(int argc, char** argv)
 {
     // OpenGL 타일 렌더링 데모 실행
-    RunTileRenderDemo();
+    // 인자: [.pmtiles / 타일 팩 경로] [--profile[=trace.json]]
+    //       [--record=session.input | --replay=session.input]
+    //       [--bench[=path.txt] [--frames=N] [--bench-out=result.json]]
+    //       [--continuous] [--no-mipmaps] [--bc1] [--tile-format=rgba8|lossless|compact]
+    using TileStorage = slippygl::tile::TileRenderer::TileStorage;
+    DemoOptions opts;
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        if (std::strcmp(a, "--profile") == 0) {
+            opts.tracePath = "slippygl_trace.json";
+        } else if (std::strncmp(a, "--profile=", 10) == 0) {
+            opts.tracePath = a + 10;
+        } else if (std::strcmp(a, "--bench") == 0) {
+            opts.bench = true;
+        } else if (std::strncmp(a, "--bench=", 8) == 0) {
+            opts.bench = true;
+            opts.benchPath = a + 8;
+        } else if (std::strncmp(a, "--frames=", 9) == 0) {
+            opts.benchFrames = std::max(0, std::atoi(a + 9));
+        } else if (std::strncmp(a, "--record=", 9) == 0) {
+            opts.recordPath = a + 9;
+        } else if (std::strncmp(a, "--replay=", 9) == 0) {
+            opts.replayPath = a + 9;
+        } else if (std::strncmp(a, "--bench-out=", 12) == 0) {
+            opts.benchOut = a + 12;
+        } else if (std::strcmp(a, "--continuous") == 0) {
+            opts.continuous = true;
+        } else if (std::strcmp(a, "--no-mipmaps") == 0) {
+            opts.mipmaps = false;
+        } else if (std::strcmp(a, "--bc1") == 0) {
+            opts.bc1 = true;
+        } else if (std::strcmp(a, "--tile-format=rgba8") == 0) {
+            opts.storage = TileStorage::kRGBA8;
+        } else if (std::strcmp(a, "--tile-format=lossless") == 0) {
+            opts.storage = TileStorage::kLossless;
+        } else if (std::strcmp(a, "--tile-format=compact") == 0) {
+            opts.storage = TileStorage::kCompact;
+        } else {
+            opts.archivePath = a;
+        }
+    }
 
-    return 0;
+    return RunTileRenderDemo(opts);
 }
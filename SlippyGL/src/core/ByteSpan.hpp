@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace slippygl::core
+{
+
+// 소유하지 않는 읽기 전용 바이트 뷰 (C++17에는 std::span이 없으므로 최소 구현)
+// 메모리 맵 아카이브 등에서 타일 바이트를 복사 없이 넘길 때 사용한다.
+class ByteSpan
+{
+public:
+    ByteSpan() = default;
+    ByteSpan(const std::uint8_t* data, const std::size_t size) noexcept : data_(data), size_(size) {}
+    explicit ByteSpan(const std::vector<std::uint8_t>& v) noexcept : data_(v.data()), size_(v.size()) {}
+
+    const std::uint8_t* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+
+    const std::uint8_t* begin() const noexcept { return data_; }
+    const std::uint8_t* end() const noexcept { return data_ + size_; }
+    std::uint8_t operator[](const std::size_t i) const noexcept { return data_[i]; }
+
+    // [offset, offset+count) 부분 뷰. 범위를 벗어나면 빈 뷰를 반환한다.
+    ByteSpan subspan(const std::size_t offset, const std::size_t count) const noexcept
+    {
+        if (offset > size_ || count > size_ - offset) return {};
+        return ByteSpan(data_ + offset, count);
+    }
+
+private:
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace slippygl::core
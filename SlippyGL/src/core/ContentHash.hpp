@@ -0,0 +1,111 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace slippygl::core
+{
+
+// 타일 본문(PNG 바이트)용 64비트 비암호 해시 — XXH64 알고리즘과 같은 값을 낸다.
+// 바다/빈 땅처럼 바이트 단위로 똑같은 타일을 찾아 텍스처를 공유하는 데 쓴다.
+// 32바이트 스트라이프를 4개 누산기로 처리하므로 타일 하나(수십 KB)에 수 µs.
+class ContentHash
+{
+public:
+    static std::uint64_t hash(const std::uint8_t* data, const std::size_t size, const std::uint64_t seed = 0) noexcept
+    {
+        const std::uint8_t* p = data;
+        const std::uint8_t* const end = data + size;
+        std::uint64_t h;
+
+        if (size >= 32)
+        {
+            std::uint64_t v1 = seed + kP1 + kP2;
+            std::uint64_t v2 = seed + kP2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - kP1;
+            do
+            {
+                v1 = round(v1, read64(p));
+                v2 = round(v2, read64(p + 8));
+                v3 = round(v3, read64(p + 16));
+                v4 = round(v4, read64(p + 24));
+                p += 32;
+            } while (end - p >= 32);
+
+            h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+            h = mergeRound(h, v1);
+            h = mergeRound(h, v2);
+            h = mergeRound(h, v3);
+            h = mergeRound(h, v4);
+        }
+        else
+        {
+            h = seed + kP5;
+        }
+        h += static_cast<std::uint64_t>(size);
+
+        // 남은 꼬리: 8 / 4 / 1바이트 단위
+        for (; end - p >= 8; p += 8)
+        {
+            h ^= round(0, read64(p));
+            h = rotl(h, 27) * kP1 + kP4;
+        }
+        if (end - p >= 4)
+        {
+            h ^= static_cast<std::uint64_t>(read32(p)) * kP1;
+            h = rotl(h, 23) * kP2 + kP3;
+            p += 4;
+        }
+        for (; p < end; ++p)
+        {
+            h ^= *p * kP5;
+            h = rotl(h, 11) * kP1;
+        }
+
+        // 마지막 섞기(avalanche)
+        h ^= h >> 33;
+        h *= kP2;
+        h ^= h >> 29;
+        h *= kP3;
+        h ^= h >> 32;
+        return h;
+    }
+
+private:
+    static constexpr std::uint64_t kP1 = 0x9E3779B185EBCA87ull;
+    static constexpr std::uint64_t kP2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr std::uint64_t kP3 = 0x165667B19E3779F9ull;
+    static constexpr std::uint64_t kP4 = 0x85EBCA77C2B2CA63ull;
+    static constexpr std::uint64_t kP5 = 0x27D4EB2F165667C5ull;
+
+    static std::uint64_t rotl(const std::uint64_t v, const int r) noexcept { return (v << r) | (v >> (64 - r)); }
+
+    // 정렬 불필요 읽기 (대상 플랫폼은 모두 리틀 엔디언: x86, ARM)
+    static std::uint64_t read64(const std::uint8_t* p) noexcept
+    {
+        std::uint64_t v;
+        std::memcpy(&v, p, 8);
+        return v;
+    }
+    static std::uint32_t read32(const std::uint8_t* p) noexcept
+    {
+        std::uint32_t v;
+        std::memcpy(&v, p, 4);
+        return v;
+    }
+
+    static std::uint64_t round(std::uint64_t acc, const std::uint64_t input) noexcept
+    {
+        acc += input * kP2;
+        acc = rotl(acc, 31);
+        return acc * kP1;
+    }
+    static std::uint64_t mergeRound(std::uint64_t acc, const std::uint64_t v) noexcept
+    {
+        acc ^= round(0, v);
+        return acc * kP1 + kP4;
+    }
+};
+
+} // namespace slippygl::core
@@ -0,0 +1,82 @@
+#include "FrameStats.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace slippygl::core
+{
+
+void FrameStats::add(const FrameSample& s)
+{
+    samples_.push_back(s.ms);
+    totalMs_ += s.ms;
+    tilesDrawn_ += static_cast<std::uint64_t>(std::max(s.tilesDrawn, 0));
+    cacheHits_ += static_cast<std::uint64_t>(std::max(s.cacheHits, 0));
+    tilesLoaded_ += static_cast<std::uint64_t>(std::max(s.tilesLoaded, 0));
+    bytesFetched_ += s.bytesFetched;
+}
+
+void FrameStats::clear() noexcept
+{
+    samples_.clear();
+    totalMs_ = 0.0;
+    tilesDrawn_ = cacheHits_ = tilesLoaded_ = bytesFetched_ = 0;
+}
+
+double FrameStats::percentileMs(const double p) const
+{
+    if (samples_.empty()) return 0.0;
+    std::vector<double> sorted(samples_);
+    const double rank = std::clamp(p, 0.0, 100.0) / 100.0 * static_cast<double>(sorted.size() - 1);
+    const std::size_t k = static_cast<std::size_t>(std::llround(rank));
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(k), sorted.end());
+    return sorted[k];
+}
+
+double FrameStats::meanMs() const
+{
+    return samples_.empty() ? 0.0 : totalMs_ / static_cast<double>(samples_.size());
+}
+
+double FrameStats::maxMs() const
+{
+    return samples_.empty() ? 0.0 : *std::max_element(samples_.begin(), samples_.end());
+}
+
+double FrameStats::tilesLoadedPerSec() const noexcept
+{
+    return totalMs_ > 0.0 ? static_cast<double>(tilesLoaded_) * 1000.0 / totalMs_ : 0.0;
+}
+
+double FrameStats::cacheHitRatio() const noexcept
+{
+    return tilesDrawn_ ? static_cast<double>(cacheHits_) / static_cast<double>(tilesDrawn_) : 0.0;
+}
+
+std::string FrameStats::toJson(const std::string& scenario) const
+{
+    // 시나리오 이름은 파일 경로일 수 있으니 따옴표/역슬래시만 이스케이프
+    std::string name;
+    for (const char c : scenario)
+    {
+        if (c == '"' || c == '\\') name += '\\';
+        name += c;
+    }
+
+    char buf[512];
+    std::snprintf(buf, sizeof(buf),
+                  "{\"scenario\":\"%s\",\"frames\":%zu,\"total_ms\":%.3f,"
+                  "\"frame_ms\":{\"mean\":%.3f,\"p50\":%.3f,\"p95\":%.3f,\"p99\":%.3f,\"max\":%.3f},"
+                  "\"tiles_drawn\":%llu,\"tiles_loaded\":%llu,\"tiles_per_sec\":%.2f,"
+                  "\"cache_hit_ratio\":%.4f,\"bytes_fetched\":%llu}",
+                  name.c_str(), samples_.size(), totalMs_,
+                  meanMs(), percentileMs(50.0), percentileMs(95.0), percentileMs(99.0), maxMs(),
+                  static_cast<unsigned long long>(tilesDrawn_),
+                  static_cast<unsigned long long>(tilesLoaded_),
+                  tilesLoadedPerSec(), cacheHitRatio(),
+                  static_cast<unsigned long long>(bytesFetched_));
+    return buf;
+}
+
+} // namespace slippygl::core
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace slippygl::core
+{
+
+// 프레임 단위 샘플 (리플레이 벤치마크용)
+struct FrameSample
+{
+    double ms = 0.0;                 // wall time of the frame incl. swap
+    int tilesDrawn = 0;
+    int cacheHits = 0;
+    int tilesLoaded = 0;             // local loads + downloads
+    std::uint64_t bytesFetched = 0;  // compressed tile bytes read this frame
+};
+
+// 고정 길이 실행의 프레임 통계 집계 + JSON 보고서
+// 회귀 판정에 쓰도록 모든 프레임을 보관하고 조회 시 정렬한다.
+class FrameStats
+{
+public:
+    void reserve(std::size_t frames) { samples_.reserve(frames); }
+    void add(const FrameSample& s);
+    void clear() noexcept;
+
+    std::size_t frames() const noexcept { return samples_.size(); }
+    double percentileMs(double p) const;     // 0..100, 0 if empty
+    double meanMs() const;
+    double maxMs() const;
+    double totalMs() const noexcept { return totalMs_; }
+
+    std::uint64_t tilesDrawn() const noexcept { return tilesDrawn_; }
+    std::uint64_t tilesLoaded() const noexcept { return tilesLoaded_; }
+    std::uint64_t bytesFetched() const noexcept { return bytesFetched_; }
+    double tilesLoadedPerSec() const noexcept;
+    double cacheHitRatio() const noexcept;   // hits / tiles drawn
+
+    // {"scenario":..,"frames":..,"frame_ms":{"p50":..,"p95":..,"p99":..},...}
+    std::string toJson(const std::string& scenario) const;
+
+private:
+    std::vector<double> samples_;
+    double totalMs_ = 0.0;
+    std::uint64_t tilesDrawn_ = 0;
+    std::uint64_t cacheHits_ = 0;
+    std::uint64_t tilesLoaded_ = 0;
+    std::uint64_t bytesFetched_ = 0;
+};
+
+} // namespace slippygl::core
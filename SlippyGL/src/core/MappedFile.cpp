@@ -0,0 +1,134 @@
+#include "MappedFile.hpp"
+
+#include <filesystem>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace slippygl::core;
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+MappedFile::MappedFile(MappedFile&& o) noexcept
+{
+    *this = std::move(o);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& o) noexcept
+{
+    if (this != &o)
+    {
+        close();
+        data_ = std::exchange(o.data_, nullptr);
+        size_ = std::exchange(o.size_, 0);
+#ifdef _WIN32
+        file_ = std::exchange(o.file_, nullptr);
+        mapping_ = std::exchange(o.mapping_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path, std::string* err)
+{
+    close();
+
+#ifdef _WIN32
+    // UTF-8 경로를 와이드 문자열로 변환해 CreateFileW 사용
+    const std::wstring wpath = std::filesystem::u8path(path).wstring();
+    HANDLE file = CreateFileW(wpath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        if (err) *err = "Cannot open file: " + path;
+        return false;
+    }
+
+    LARGE_INTEGER sz{};
+    if (!GetFileSizeEx(file, &sz) || sz.QuadPart <= 0)
+    {
+        if (err) *err = "Empty or unreadable file: " + path;
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        if (err) *err = "CreateFileMapping failed: " + path;
+        CloseHandle(file);
+        return false;
+    }
+
+    const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        if (err) *err = "MapViewOfFile failed: " + path;
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    file_ = file;
+    mapping_ = mapping;
+    data_ = static_cast<const std::uint8_t*>(view);
+    size_ = static_cast<std::size_t>(sz.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        if (err) *err = "Cannot open file: " + path;
+        return false;
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        if (err) *err = "Empty or unreadable file: " + path;
+        ::close(fd);
+        return false;
+    }
+
+    void* view = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd); // 매핑은 fd를 닫아도 유지된다
+    if (view == MAP_FAILED)
+    {
+        if (err) *err = "mmap failed: " + path;
+        return false;
+    }
+    // 타일 조회는 임의 접근 패턴
+    ::madvise(view, static_cast<std::size_t>(st.st_size), MADV_RANDOM);
+
+    data_ = static_cast<const std::uint8_t*>(view);
+    size_ = static_cast<std::size_t>(st.st_size);
+#endif
+    return true;
+}
+
+void MappedFile::close() noexcept
+{
+#ifdef _WIN32
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_) CloseHandle(static_cast<HANDLE>(mapping_));
+    if (file_) CloseHandle(static_cast<HANDLE>(file_));
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    if (data_) ::munmap(const_cast<std::uint8_t*>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "ByteSpan.hpp"
+
+namespace slippygl::core
+{
+
+// 읽기 전용 메모리 맵 파일 (RAII)
+// Windows: CreateFileMapping/MapViewOfFile, POSIX: mmap(PROT_READ)
+// 매핑 이후의 읽기는 시스템 콜 없이 페이지 캐시에서 바로 이루어진다.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& o) noexcept;
+    MappedFile& operator=(MappedFile&& o) noexcept;
+
+    // 파일 전체를 매핑한다. 실패 시 false (err에 사유)
+    bool open(const std::string& path, std::string* err = nullptr);
+    void close() noexcept;
+
+    bool isOpen() const noexcept { return data_ != nullptr; }
+    const std::uint8_t* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    ByteSpan bytes() const noexcept { return ByteSpan(data_, size_); }
+
+private:
+    const std::uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+#ifdef _WIN32
+    void* file_ = nullptr;     // HANDLE
+    void* mapping_ = nullptr;  // HANDLE
+#endif
+};
+
+} // namespace slippygl::core
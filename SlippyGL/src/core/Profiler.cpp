@@ -0,0 +1,252 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+
+using namespace slippygl::core;
+
+namespace
+{
+    constexpr std::size_t kRingSize = 1u << 16;   // events per thread (~1.5 MB)
+    constexpr double kEwmaAlpha = 0.1;
+
+    struct Event
+    {
+        const char* name;
+        std::uint64_t start;
+        std::uint64_t end;
+    };
+
+    // 스레드별 링 버퍼. 쓰기는 소유 스레드만, 읽기(집계/내보내기)는 메인 스레드.
+    // mutex는 거의 항상 비경합이라 구간당 비용은 수십 ns 수준.
+    // 링은 첫 구간 기록 시에 할당한다 (프로파일링을 끈 채 setThreadName만 부른 스레드는 비용 없음).
+    // 스레드가 종료되면 버퍼는 반납되고 다음에 생성되는 스레드가 재사용한다.
+    struct ThreadBuffer
+    {
+        std::mutex mu;
+        std::vector<Event> ring;
+        std::uint64_t head = 0;         // events ever written
+        std::uint64_t aggregated = 0;   // events already folded into stats
+        std::uint64_t traceFrom = 0;    // first event owned by the current thread
+        std::uint32_t tid = 0;
+        std::string name;
+        bool live = true;
+    };
+
+    struct Registry
+    {
+        std::mutex mu;
+        std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+        std::uint32_t nextTid = 0;
+        // 같은 이름이 여러 번역 단위에서 다른 포인터로 올 수 있어 내용으로 묶는다
+        std::unordered_map<std::string_view, Profiler::ZoneStats> stats;
+        double avgFrameMs = 0.0;
+        std::uint64_t lastFrameNs = 0;
+    };
+
+    // 종료 시 소멸 순서 문제를 피하려고 의도적으로 해제하지 않는다
+    Registry& registry()
+    {
+        static Registry* r = new Registry();
+        return *r;
+    }
+
+    // 스레드 종료 시 버퍼를 반납한다 (레지스트리는 해제되지 않으므로 항상 유효)
+    struct BufferLease
+    {
+        ThreadBuffer* tb = nullptr;
+        ~BufferLease()
+        {
+            if (!tb) return;
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mu);
+            std::lock_guard<std::mutex> bl(tb->mu);
+            tb->live = false;
+        }
+    };
+
+    ThreadBuffer& localBuffer()
+    {
+        thread_local BufferLease lease;
+        if (!lease.tb)
+        {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mu);
+            for (auto& tb : r.buffers)
+            {
+                std::lock_guard<std::mutex> bl(tb->mu);
+                if (tb->live) continue;
+                // 이전 스레드의 미집계 구간은 통계에 그대로 반영되고, trace에서만 빠진다
+                tb->live = true;
+                tb->traceFrom = tb->head;
+                tb->name.clear();
+                tb->tid = ++r.nextTid;
+                lease.tb = tb.get();
+                break;
+            }
+            if (!lease.tb)
+            {
+                auto owned = std::make_unique<ThreadBuffer>();
+                owned->tid = ++r.nextTid;
+                lease.tb = owned.get();
+                r.buffers.push_back(std::move(owned));
+            }
+        }
+        return *lease.tb;
+    }
+
+    const std::chrono::steady_clock::time_point kEpoch = std::chrono::steady_clock::now();
+}
+
+std::atomic<bool> Profiler::enabled_{ false };
+
+std::uint64_t Profiler::nowNs() noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kEpoch).count());
+}
+
+void Profiler::record(const char* name, const std::uint64_t startNs, const std::uint64_t endNs)
+{
+    ThreadBuffer& tb = localBuffer();
+    std::lock_guard<std::mutex> lock(tb.mu);
+    if (tb.ring.empty()) tb.ring.resize(kRingSize);
+    tb.ring[tb.head % kRingSize] = Event{ name, startNs, endNs };
+    ++tb.head;
+}
+
+void Profiler::setThreadName(const char* name)
+{
+    ThreadBuffer& tb = localBuffer();
+    std::lock_guard<std::mutex> lock(tb.mu);
+    tb.name = name ? name : "";
+}
+
+void Profiler::endFrame()
+{
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+
+    const std::uint64_t now = nowNs();
+    const double frameMs = r.lastFrameNs ? static_cast<double>(now - r.lastFrameNs) / 1e6 : 0.0;
+    r.lastFrameNs = now;
+    if (!enabled()) return;
+
+    struct Accum { double total = 0.0; double max = 0.0; int calls = 0; };
+    std::unordered_map<std::string_view, Accum> frame;
+    for (auto& tb : r.buffers)
+    {
+        std::lock_guard<std::mutex> bl(tb->mu);
+        const std::uint64_t from = std::max(tb->aggregated, tb->head > kRingSize ? tb->head - kRingSize : 0);
+        for (std::uint64_t i = from; i < tb->head; ++i)
+        {
+            const Event& e = tb->ring[i % kRingSize];
+            const double ms = static_cast<double>(e.end - e.start) / 1e6;
+            Accum& a = frame[e.name];
+            a.total += ms;
+            a.max = std::max(a.max, ms);
+            ++a.calls;
+        }
+        tb->aggregated = tb->head;
+    }
+
+    r.avgFrameMs = r.avgFrameMs > 0.0 ? r.avgFrameMs + kEwmaAlpha * (frameMs - r.avgFrameMs) : frameMs;
+    for (const auto& [name, a] : frame)
+    {
+        if (r.stats.find(name) != r.stats.end()) continue;
+        Profiler::ZoneStats z;      // first sighting seeds the average
+        z.name = name.data();
+        z.avgMsPerFrame = a.total;
+        z.callsPerFrame = a.calls;
+        r.stats.emplace(name, z);
+    }
+    // 이번 프레임에 나타나지 않은 구간은 0으로 감쇠
+    for (auto& [name, z] : r.stats)
+    {
+        const auto f = frame.find(name);
+        const bool seen = f != frame.end();
+        z.maxMs = seen ? f->second.max : 0.0;
+        z.avgMsPerFrame += kEwmaAlpha * ((seen ? f->second.total : 0.0) - z.avgMsPerFrame);
+        z.callsPerFrame += kEwmaAlpha * ((seen ? f->second.calls : 0.0) - z.callsPerFrame);
+    }
+}
+
+std::vector<Profiler::ZoneStats> Profiler::summary()
+{
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+    std::vector<ZoneStats> out;
+    out.reserve(r.stats.size());
+    for (const auto& [name, z] : r.stats) out.push_back(z);
+    std::sort(out.begin(), out.end(),
+              [](const ZoneStats& a, const ZoneStats& b) { return a.avgMsPerFrame > b.avgMsPerFrame; });
+    return out;
+}
+
+double Profiler::avgFrameMs() noexcept
+{
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+    return r.avgFrameMs;
+}
+
+bool Profiler::writeChromeTrace(const std::string& path, std::string* err)
+{
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (!f)
+    {
+        if (err) *err = "Cannot open trace file: " + path;
+        return false;
+    }
+
+    std::fputs("{\"traceEvents\":[\n", f);
+    bool first = true;
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+    for (auto& tb : r.buffers)
+    {
+        std::lock_guard<std::mutex> bl(tb->mu);
+        if (!tb->name.empty())
+        {
+            std::fprintf(f, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                         first ? "" : ",\n", tb->tid, tb->name.c_str());
+            first = false;
+        }
+        const std::uint64_t from = std::max(tb->traceFrom, tb->head > kRingSize ? tb->head - kRingSize : 0);
+        for (std::uint64_t i = from; i < tb->head; ++i)
+        {
+            const Event& e = tb->ring[i % kRingSize];
+            std::fprintf(f, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+                         first ? "" : ",\n", e.name, tb->tid,
+                         static_cast<double>(e.start) / 1000.0, static_cast<double>(e.end - e.start) / 1000.0);
+            first = false;
+        }
+    }
+    std::fputs("\n],\"displayTimeUnit\":\"ms\"}\n", f);
+
+    const bool ok = std::fflush(f) == 0;
+    std::fclose(f);
+    if (!ok && err) *err = "Failed to write trace file: " + path;
+    return ok;
+}
+
+void Profiler::reset()
+{
+    Registry& r = registry();
+    std::lock_guard<std::mutex> lock(r.mu);
+    for (auto& tb : r.buffers)
+    {
+        std::lock_guard<std::mutex> bl(tb->mu);
+        tb->head = 0;
+        tb->aggregated = 0;
+        tb->traceFrom = 0;
+    }
+    r.stats.clear();
+    r.avgFrameMs = 0.0;
+    r.lastFrameNs = 0;
+}
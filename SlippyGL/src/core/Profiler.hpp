@@ -0,0 +1,85 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace slippygl::core
+{
+
+// 경량 CPU 프로파일러
+// - SLIPPYGL_ZONE("name")으로 스코프 구간을 기록 (RAII)
+// - 스레드별 링 버퍼에 기록하고, 프레임 경계마다 구간별 통계를 롤링 집계
+// - Chrome trace_event JSON으로 내보내기 (chrome://tracing, Perfetto)
+// - 런타임 비활성 시 구간 하나당 atomic load 한 번,
+//   SLIPPYGL_ENABLE_PROFILER 미정의 시 매크로가 완전히 사라진다
+// 구간 이름은 문자열 리터럴(정적 수명)이어야 한다.
+class Profiler
+{
+public:
+    struct ZoneStats
+    {
+        const char* name = nullptr;
+        double avgMsPerFrame = 0.0;   // EWMA of per-frame total
+        double maxMs = 0.0;           // longest single zone in the last frame
+        double callsPerFrame = 0.0;   // EWMA
+    };
+
+    static void setEnabled(bool on) noexcept { enabled_.store(on, std::memory_order_relaxed); }
+    static bool enabled() noexcept { return enabled_.load(std::memory_order_relaxed); }
+
+    // 현재 스레드 이름 (trace의 thread_name 메타데이터)
+    static void setThreadName(const char* name);
+
+    // 프레임 경계 (메인 스레드). 지난 프레임 이후 모든 스레드의 구간을 집계한다.
+    static void endFrame();
+
+    // 구간별 롤링 통계, 프레임당 평균 시간 내림차순
+    static std::vector<ZoneStats> summary();
+    static double avgFrameMs() noexcept;
+
+    // 링 버퍼에 남아 있는 구간들을 Chrome trace JSON으로 저장
+    static bool writeChromeTrace(const std::string& path, std::string* err = nullptr);
+
+    // 모든 스레드 버퍼와 통계를 비운다
+    static void reset();
+
+    static std::uint64_t nowNs() noexcept;
+    static void record(const char* name, std::uint64_t startNs, std::uint64_t endNs);
+
+private:
+    static std::atomic<bool> enabled_;
+};
+
+// RAII 구간
+class ProfileZone
+{
+public:
+    explicit ProfileZone(const char* name) noexcept
+        : name_(Profiler::enabled() ? name : nullptr)
+        , start_(name_ ? Profiler::nowNs() : 0)
+    {
+    }
+    ~ProfileZone()
+    {
+        if (name_) Profiler::record(name_, start_, Profiler::nowNs());
+    }
+
+    // Non-copyable
+    ProfileZone(const ProfileZone&) = delete;
+    ProfileZone& operator=(const ProfileZone&) = delete;
+
+private:
+    const char* name_;
+    std::uint64_t start_;
+};
+
+} // namespace slippygl::core
+
+#if defined(SLIPPYGL_ENABLE_PROFILER)
+#define SLIPPYGL_ZONE_CONCAT2(a, b) a##b
+#define SLIPPYGL_ZONE_CONCAT(a, b) SLIPPYGL_ZONE_CONCAT2(a, b)
+#define SLIPPYGL_ZONE(name) ::slippygl::core::ProfileZone SLIPPYGL_ZONE_CONCAT(slippyglZone_, __LINE__)(name)
+#else
+#define SLIPPYGL_ZONE(name) ((void)0)
+#endif
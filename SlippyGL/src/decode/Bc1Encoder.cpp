@@ -0,0 +1,322 @@
+#include "Bc1Encoder.hpp"
+#include "PixelKernels.hpp"
+#include "../core/Profiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SLIPPYGL_BC1_SSE2 1
+#endif
+
+namespace slippygl::decode
+{
+
+namespace
+{
+    int to565(int r, int g, int b) noexcept
+    {
+        return (((r * 31 + 127) / 255) << 11) | (((g * 63 + 127) / 255) << 5) | ((b * 31 + 127) / 255);
+    }
+
+    void from565(int c, int* rgb) noexcept
+    {
+        const int r = (c >> 11) & 31, g = (c >> 5) & 63, b = c & 31;
+        rgb[0] = (r << 3) | (r >> 2);
+        rgb[1] = (g << 2) | (g >> 4);
+        rgb[2] = (b << 3) | (b >> 2);
+    }
+
+    // Per-channel min/max over the 16 pixels (alpha lanes are ignored by the caller)
+    void blockBounds(const std::uint8_t* rgba, int* mn, int* mx) noexcept
+    {
+#if SLIPPYGL_BC1_SSE2
+        const __m128i* p = reinterpret_cast<const __m128i*>(rgba);
+        const __m128i a = _mm_loadu_si128(p), b = _mm_loadu_si128(p + 1);
+        const __m128i c = _mm_loadu_si128(p + 2), d = _mm_loadu_si128(p + 3);
+        __m128i lo = _mm_min_epu8(_mm_min_epu8(a, b), _mm_min_epu8(c, d));
+        __m128i hi = _mm_max_epu8(_mm_max_epu8(a, b), _mm_max_epu8(c, d));
+        lo = _mm_min_epu8(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(1, 0, 3, 2)));
+        hi = _mm_max_epu8(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(1, 0, 3, 2)));
+        lo = _mm_min_epu8(lo, _mm_shuffle_epi32(lo, _MM_SHUFFLE(2, 3, 0, 1)));
+        hi = _mm_max_epu8(hi, _mm_shuffle_epi32(hi, _MM_SHUFFLE(2, 3, 0, 1)));
+        const std::uint32_t l = static_cast<std::uint32_t>(_mm_cvtsi128_si32(lo));
+        const std::uint32_t h = static_cast<std::uint32_t>(_mm_cvtsi128_si32(hi));
+        for (int c3 = 0; c3 < 3; ++c3)
+        {
+            mn[c3] = static_cast<int>((l >> (8 * c3)) & 0xFF);
+            mx[c3] = static_cast<int>((h >> (8 * c3)) & 0xFF);
+        }
+#else
+        for (int c = 0; c < 3; ++c)
+        {
+            mn[c] = 255;
+            mx[c] = 0;
+        }
+        for (int i = 0; i < 16; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                mn[c] = std::min(mn[c], static_cast<int>(rgba[i * 4 + c]));
+                mx[c] = std::max(mx[c], static_cast<int>(rgba[i * 4 + c]));
+            }
+        }
+#endif
+    }
+
+    void put16(std::uint8_t* p, int v) noexcept
+    {
+        p[0] = static_cast<std::uint8_t>(v & 0xFF);
+        p[1] = static_cast<std::uint8_t>((v >> 8) & 0xFF);
+    }
+
+    // Next mip level (2x2 box filter)
+    void halve(const Image& src, Image& dst)
+    {
+        dst.width = std::max(1, src.width / 2);
+        dst.height = std::max(1, src.height / 2);
+        dst.channels = 4;
+        dst.pixels.resize(static_cast<std::size_t>(dst.width) * dst.height * 4);
+        PixelKernels::downsample2x2(src.pixels.data(), src.width, src.height, dst.pixels.data());
+    }
+
+    // One level: gather each 4x4 block (clamping at partial edges) and encode it
+    void encodeLevel(const Image& img, std::uint8_t* out) noexcept
+    {
+        alignas(16) std::uint8_t block[64];
+        const int bw = (img.width + 3) / 4, bh = (img.height + 3) / 4;
+        for (int by = 0; by < bh; ++by)
+        {
+            for (int bx = 0; bx < bw; ++bx)
+            {
+                for (int py = 0; py < 4; ++py)
+                {
+                    const int y = std::min(by * 4 + py, img.height - 1);
+                    const std::uint8_t* row = &img.pixels[static_cast<std::size_t>(y) * img.width * 4];
+                    if (bx * 4 + 3 < img.width)
+                    {
+                        std::memcpy(block + py * 16, row + bx * 16, 16);
+                        continue;
+                    }
+                    for (int px = 0; px < 4; ++px)
+                    {
+                        const int x = std::min(bx * 4 + px, img.width - 1);
+                        std::memcpy(block + py * 16 + px * 4, row + x * 4, 4);
+                    }
+                }
+                Bc1Encoder::encodeBlock(block, out);
+                out += Bc1Encoder::kBlockBytes;
+            }
+        }
+    }
+}
+
+int Bc1Encoder::levelCount(int w, int h, bool mipmaps) noexcept
+{
+    int levels = 1;
+    while (mipmaps && (w > 1 || h > 1))
+    {
+        w = std::max(1, w / 2);
+        h = std::max(1, h / 2);
+        ++levels;
+    }
+    return levels;
+}
+
+void Bc1Encoder::encodeBlock(const std::uint8_t* rgba, std::uint8_t* out) noexcept
+{
+    int mn[3], mx[3];
+    blockBounds(rgba, mn, mx);
+
+    // Orient the box diagonal: the widest channel is the reference, the other
+    // two run against it if they are anti-correlated across the block
+    const int ext[3] = { mx[0] - mn[0], mx[1] - mn[1], mx[2] - mn[2] };
+    const int ref = ext[1] >= ext[0] && ext[1] >= ext[2] ? 1 : (ext[0] >= ext[2] ? 0 : 2);
+    int cov[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; ++i)
+    {
+        const std::uint8_t* p = rgba + i * 4;
+        const int dr = 2 * p[ref] - (mn[ref] + mx[ref]);
+        for (int c = 0; c < 3; ++c) cov[c] += dr * (2 * p[c] - (mn[c] + mx[c]));
+    }
+
+    // Inset by 1/16 of the range: endpoints closer to the bulk of the pixels
+    int hi[3], lo[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        if (cov[c] < 0) std::swap(mn[c], mx[c]);
+        const int inset = (mx[c] - mn[c]) / 16;
+        hi[c] = mx[c] - inset;
+        lo[c] = mn[c] + inset;
+    }
+
+    int c0 = to565(hi[0], hi[1], hi[2]);
+    int c1 = to565(lo[0], lo[1], lo[2]);
+    std::uint32_t indices = 0;
+    if (c0 != c1)
+    {
+        // color0 > color1 selects the four-color mode
+        if (c0 < c1) std::swap(c0, c1);
+        int p0[3], p1[3];
+        from565(c0, p0);
+        from565(c1, p1);
+
+        // Project onto the decoded endpoint axis and round to 0..3 thirds from
+        // color1: step = round(3t / dd), as threshold compares instead of a divide
+        const int dir[3] = { p0[0] - p1[0], p0[1] - p1[1], p0[2] - p1[2] };
+        const int dd = dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2];
+        const int base = p1[0] * dir[0] + p1[1] * dir[1] + p1[2] * dir[2];
+        static constexpr std::uint32_t kStepToIndex[4] = { 1, 3, 2, 0 };
+        for (int i = 15; i >= 0; --i)
+        {
+            const std::uint8_t* p = rgba + i * 4;
+            const int t6 = 6 * (p[0] * dir[0] + p[1] * dir[1] + p[2] * dir[2] - base);
+            const int step = (t6 >= dd) + (t6 >= 3 * dd) + (t6 >= 5 * dd);
+            indices = (indices << 2) | kStepToIndex[step];
+        }
+    }
+
+    put16(out, c0);
+    put16(out + 2, c1);
+    put16(out + 4, static_cast<int>(indices & 0xFFFF));
+    put16(out + 6, static_cast<int>(indices >> 16));
+}
+
+void Bc1Encoder::decodeBlock(const std::uint8_t* block, std::uint8_t* rgba) noexcept
+{
+    const int c0 = block[0] | (block[1] << 8);
+    const int c1 = block[2] | (block[3] << 8);
+    const std::uint32_t indices = static_cast<std::uint32_t>(block[4]) | (static_cast<std::uint32_t>(block[5]) << 8) |
+                                  (static_cast<std::uint32_t>(block[6]) << 16) | (static_cast<std::uint32_t>(block[7]) << 24);
+
+    int pal[4][3];
+    from565(c0, pal[0]);
+    from565(c1, pal[1]);
+    for (int c = 0; c < 3; ++c)
+    {
+        if (c0 > c1)
+        {
+            pal[2][c] = (2 * pal[0][c] + pal[1][c]) / 3;
+            pal[3][c] = (pal[0][c] + 2 * pal[1][c]) / 3;
+        }
+        else
+        {
+            pal[2][c] = (pal[0][c] + pal[1][c]) / 2;
+            pal[3][c] = 0;   // transparent black in BC1 RGBA; black here
+        }
+    }
+
+    for (int i = 0; i < 16; ++i)
+    {
+        const int* p = pal[(indices >> (2 * i)) & 3];
+        rgba[i * 4 + 0] = static_cast<std::uint8_t>(p[0]);
+        rgba[i * 4 + 1] = static_cast<std::uint8_t>(p[1]);
+        rgba[i * 4 + 2] = static_cast<std::uint8_t>(p[2]);
+        rgba[i * 4 + 3] = 255;
+    }
+}
+
+bool Bc1Encoder::encode(const Image& img,
+                        std::vector<std::uint8_t>& out,
+                        bool mipmaps,
+                        std::string* err) noexcept
+{
+    SLIPPYGL_ZONE("decode.bc1");
+
+    out.clear();
+    if (!img.valid() || img.channels != 4)
+    {
+        if (err)
+        {
+            *err = "BC1 encode needs a valid RGBA8 image";
+        }
+        return false;
+    }
+
+    try {
+        std::size_t total = 0;
+        for (int w = img.width, h = img.height, l = levelCount(w, h, mipmaps); l > 0; --l)
+        {
+            total += levelBytes(w, h);
+            w = std::max(1, w / 2);
+            h = std::max(1, h / 2);
+        }
+        out.resize(total);
+
+        std::uint8_t* dst = out.data();
+        encodeLevel(img, dst);
+        dst += levelBytes(img.width, img.height);
+
+        Image level[2];
+        const Image* src = &img;
+        for (int l = 1; l < levelCount(img.width, img.height, mipmaps); ++l)
+        {
+            Image& next = level[l & 1];
+            halve(*src, next);
+            encodeLevel(next, dst);
+            dst += levelBytes(next.width, next.height);
+            src = &next;
+        }
+        return true;
+    }
+    catch (...) {
+        if (err)
+        {
+            *err = "Out of memory during BC1 encoding";
+        }
+        out.clear();
+        return false;
+    }
+}
+
+bool Bc1Encoder::decode(const std::uint8_t* blocks,
+                        std::size_t size,
+                        int w, int h,
+                        Image& out,
+                        std::string* err) noexcept
+{
+    out.clear();
+    if (!blocks || w <= 0 || h <= 0 || size < levelBytes(w, h))
+    {
+        if (err)
+        {
+            *err = "BC1 data too short for the image size";
+        }
+        return false;
+    }
+
+    try {
+        out.width = w;
+        out.height = h;
+        out.channels = 4;
+        out.pixels.resize(static_cast<std::size_t>(w) * h * 4);
+
+        std::uint8_t px[64];
+        const int bw = (w + 3) / 4, bh = (h + 3) / 4;
+        for (int by = 0; by < bh; ++by)
+        {
+            for (int bx = 0; bx < bw; ++bx, blocks += kBlockBytes)
+            {
+                decodeBlock(blocks, px);
+                for (int py = 0; py < 4 && by * 4 + py < h; ++py)
+                {
+                    const int n = std::min(4, w - bx * 4);
+                    std::memcpy(&out.pixels[(static_cast<std::size_t>(by * 4 + py) * w + bx * 4) * 4], px + py * 16,
+                                static_cast<std::size_t>(n) * 4);
+                }
+            }
+        }
+        return true;
+    }
+    catch (...) {
+        if (err)
+        {
+            *err = "Out of memory during BC1 decoding";
+        }
+        out.clear();
+        return false;
+    }
+}
+
+} // namespace slippygl::decode
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <cstdint>
 #include <vector>
+#include "PixelKernels.hpp"
 
 namespace slippygl::decode 
 {
@@ -56,6 +57,27 @@ struct Image
     {
         return pixels.empty();
     }
+
+    // Every pixel fully opaque (no alpha channel, or alpha all 255)
+    bool opaque() const noexcept
+    {
+        if (channels != 2 && channels != 4)
+        {
+            return true;
+        }
+        if (channels == 4)
+        {
+            return PixelKernels::allOpaque(pixels.data(), pixels.size() / 4);
+        }
+        for (std::size_t i = static_cast<std::size_t>(channels) - 1; i < pixels.size(); i += static_cast<std::size_t>(channels))
+        {
+            if (pixels[i] != 255)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 } // namespace slippygl::decode
@@ -0,0 +1,609 @@
+#include "PixelKernels.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SLIPPYGL_PK_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define SLIPPYGL_TARGET_AVX2
+#else
+#define SLIPPYGL_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+// Baseline on x86-64; 32-bit x86 builds only when the compiler targets it
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SLIPPYGL_PK_SSE2 1
+#endif
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define SLIPPYGL_PK_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace slippygl::decode
+{
+
+namespace
+{
+    using Isa = PixelKernels::Isa;
+
+    struct Table
+    {
+        void (*expand)(const std::uint8_t*, std::uint8_t*, std::size_t);
+        void (*premultiply)(std::uint8_t*, std::size_t);
+        void (*pack565)(const std::uint8_t*, std::uint16_t*, std::size_t);
+        // One output row from two source rows; source width >= 2
+        void (*downsampleRow)(const std::uint8_t*, const std::uint8_t*, std::uint8_t*, int);
+        bool (*allOpaque)(const std::uint8_t*, std::size_t);
+    };
+
+    // ---- Scalar reference (also handles the SIMD paths' tails) ----
+    namespace scalar
+    {
+        void expand(const std::uint8_t* rgb, std::uint8_t* rgba, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i, rgb += 3, rgba += 4)
+            {
+                rgba[0] = rgb[0];
+                rgba[1] = rgb[1];
+                rgba[2] = rgb[2];
+                rgba[3] = 255;
+            }
+        }
+
+        // round(v * a / 255) without a divide, exact for all 8-bit v and a
+        inline std::uint8_t mulDiv255(unsigned v, unsigned a)
+        {
+            const unsigned t = v * a + 128u;
+            return static_cast<std::uint8_t>((t + (t >> 8)) >> 8);
+        }
+
+        void premultiply(std::uint8_t* rgba, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i, rgba += 4)
+            {
+                const unsigned a = rgba[3];
+                rgba[0] = mulDiv255(rgba[0], a);
+                rgba[1] = mulDiv255(rgba[1], a);
+                rgba[2] = mulDiv255(rgba[2], a);
+            }
+        }
+
+        // (v * 249 + 1014) >> 11 == round(v * 31 / 255), (v * 253 + 505) >> 10 == round(v * 63 / 255)
+        void pack565(const std::uint8_t* rgba, std::uint16_t* out, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i, rgba += 4)
+            {
+                const unsigned r = (rgba[0] * 249u + 1014u) >> 11;
+                const unsigned g = (rgba[1] * 253u + 505u) >> 10;
+                const unsigned b = (rgba[2] * 249u + 1014u) >> 11;
+                out[i] = static_cast<std::uint16_t>((r << 11) | (g << 5) | b);
+            }
+        }
+
+        void downsampleRow(const std::uint8_t* row0, const std::uint8_t* row1, std::uint8_t* dst, int dstW)
+        {
+            for (int x = 0; x < dstW; ++x, row0 += 8, row1 += 8, dst += 4)
+            {
+                for (int k = 0; k < 4; ++k)
+                {
+                    dst[k] = static_cast<std::uint8_t>((row0[k] + row0[k + 4] + row1[k] + row1[k + 4] + 2) >> 2);
+                }
+            }
+        }
+
+        bool allOpaque(const std::uint8_t* rgba, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (rgba[i * 4 + 3] != 255) return false;
+            }
+            return true;
+        }
+
+        constexpr Table kTable = { expand, premultiply, pack565, downsampleRow, allOpaque };
+    }
+
+#if SLIPPYGL_PK_SSE2
+    namespace sse2
+    {
+        void expand(const std::uint8_t* rgb, std::uint8_t* rgba, std::size_t count)
+        {
+            // 4 pixels per step: each 32-bit lane takes 3 color bytes (+1 stray,
+            // overwritten by alpha). The 16-byte load reads 4 bytes past the
+            // pixels, hence the margin.
+            const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+            std::size_t i = 0;
+            for (; i + 6 <= count; i += 4)
+            {
+                const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgb + i * 3));
+                const __m128i p01 = _mm_unpacklo_epi32(x, _mm_srli_si128(x, 3));
+                const __m128i p23 = _mm_unpacklo_epi32(_mm_srli_si128(x, 6), _mm_srli_si128(x, 9));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(rgba + i * 4),
+                                 _mm_or_si128(_mm_unpacklo_epi64(p01, p23), alpha));
+            }
+            scalar::expand(rgb + i * 3, rgba + i * 4, count - i);
+        }
+
+        // Two pixels of 16-bit channels
+        inline __m128i premultiply2(__m128i v)
+        {
+            const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+            const __m128i a = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xFF), 0xFF);
+            const __m128i m = _mm_or_si128(_mm_andnot_si128(alphaLanes, a), _mm_and_si128(alphaLanes, _mm_set1_epi16(255)));
+            const __m128i t = _mm_add_epi16(_mm_mullo_epi16(v, m), _mm_set1_epi16(128));
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+
+        void premultiply(std::uint8_t* rgba, std::size_t count)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            std::size_t i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                __m128i* p = reinterpret_cast<__m128i*>(rgba + i * 4);
+                const __m128i x = _mm_loadu_si128(p);
+                _mm_storeu_si128(p, _mm_packus_epi16(premultiply2(_mm_unpacklo_epi8(x, zero)),
+                                                     premultiply2(_mm_unpackhi_epi8(x, zero))));
+            }
+            scalar::premultiply(rgba + i * 4, count - i);
+        }
+
+        // Four pixels -> four RGB565 values in 32-bit lanes
+        inline __m128i to565(__m128i x)
+        {
+            const __m128i m = _mm_set1_epi32(0xFF);
+            const __m128i r = _mm_and_si128(x, m);
+            const __m128i g = _mm_and_si128(_mm_srli_epi32(x, 8), m);
+            const __m128i b = _mm_and_si128(_mm_srli_epi32(x, 16), m);
+            // 16-bit multiplies: the products fit the low halves, the high halves stay 0
+            const __m128i r5 = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(r, _mm_set1_epi32(249)), _mm_set1_epi32(1014)), 11);
+            const __m128i g6 = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(g, _mm_set1_epi32(253)), _mm_set1_epi32(505)), 10);
+            const __m128i b5 = _mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi16(b, _mm_set1_epi32(249)), _mm_set1_epi32(1014)), 11);
+            return _mm_or_si128(_mm_or_si128(_mm_slli_epi32(r5, 11), _mm_slli_epi32(g6, 5)), b5);
+        }
+
+        void pack565(const std::uint8_t* rgba, std::uint16_t* out, std::size_t count)
+        {
+            // SSE2 has only a signed 32 -> 16 pack: bias into its range and back
+            const __m128i bias32 = _mm_set1_epi32(32768);
+            const __m128i bias16 = _mm_set1_epi16(static_cast<short>(0x8000));
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                const __m128i* p = reinterpret_cast<const __m128i*>(rgba + i * 4);
+                const __m128i a = _mm_sub_epi32(to565(_mm_loadu_si128(p)), bias32);
+                const __m128i b = _mm_sub_epi32(to565(_mm_loadu_si128(p + 1)), bias32);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(_mm_packs_epi32(a, b), bias16));
+            }
+            scalar::pack565(rgba + i * 4, out + i, count - i);
+        }
+
+        void downsampleRow(const std::uint8_t* row0, const std::uint8_t* row1, std::uint8_t* dst, int dstW)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i two = _mm_set1_epi16(2);
+            int x = 0;
+            for (; x + 4 <= dstW; x += 4)
+            {
+                const __m128i* a = reinterpret_cast<const __m128i*>(row0 + x * 8);
+                const __m128i* b = reinterpret_cast<const __m128i*>(row1 + x * 8);
+                const __m128i a0 = _mm_loadu_si128(a), a1 = _mm_loadu_si128(a + 1);
+                const __m128i b0 = _mm_loadu_si128(b), b1 = _mm_loadu_si128(b + 1);
+
+                // Vertical sums, two source pixels per register
+                const __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+                const __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+                const __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+                const __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+                // Horizontal: even + odd source pixel
+                __m128i d01 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+                __m128i d23 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+                d01 = _mm_srli_epi16(_mm_add_epi16(d01, two), 2);
+                d23 = _mm_srli_epi16(_mm_add_epi16(d23, two), 2);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + x * 4), _mm_packus_epi16(d01, d23));
+            }
+            scalar::downsampleRow(row0 + x * 8, row1 + x * 8, dst + x * 4, dstW - x);
+        }
+
+        bool allOpaque(const std::uint8_t* rgba, std::size_t count)
+        {
+            const __m128i alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m128i* p = reinterpret_cast<const __m128i*>(rgba + i * 4);
+                const __m128i acc = _mm_and_si128(_mm_and_si128(_mm_loadu_si128(p), _mm_loadu_si128(p + 1)),
+                                                  _mm_and_si128(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3)));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(acc, alpha), alpha)) != 0xFFFF) return false;
+            }
+            return scalar::allOpaque(rgba + i * 4, count - i);
+        }
+
+        constexpr Table kTable = { expand, premultiply, pack565, downsampleRow, allOpaque };
+    }
+#endif
+
+#if SLIPPYGL_PK_X86
+    namespace avx2
+    {
+        SLIPPYGL_TARGET_AVX2 void expand(const std::uint8_t* rgb, std::uint8_t* rgba, std::size_t count)
+        {
+            // 8 pixels per step: 4 per 128-bit lane (the second lane loads from
+            // byte 12), then an in-lane byte shuffle. Loads run 4 bytes past the
+            // 8 pixels, hence the margin.
+            const __m256i shuffle = _mm256_setr_epi8(
+                0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1,
+                0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+            const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+            std::size_t i = 0;
+            for (; i + 10 <= count; i += 8)
+            {
+                const std::uint8_t* s = rgb + i * 3;
+                const __m256i x = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(s))),
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + 12)), 1);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(rgba + i * 4),
+                                    _mm256_or_si256(_mm256_shuffle_epi8(x, shuffle), alpha));
+            }
+            scalar::expand(rgb + i * 3, rgba + i * 4, count - i);
+        }
+
+        SLIPPYGL_TARGET_AVX2 inline __m256i premultiply4(__m256i v)
+        {
+            const __m256i alphaLanes = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+            const __m256i a = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(v, 0xFF), 0xFF);
+            const __m256i m = _mm256_blendv_epi8(a, _mm256_set1_epi16(255), alphaLanes);
+            const __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(v, m), _mm256_set1_epi16(128));
+            return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+        }
+
+        SLIPPYGL_TARGET_AVX2 void premultiply(std::uint8_t* rgba, std::size_t count)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8)
+            {
+                __m256i* p = reinterpret_cast<__m256i*>(rgba + i * 4);
+                const __m256i x = _mm256_loadu_si256(p);
+                _mm256_storeu_si256(p, _mm256_packus_epi16(premultiply4(_mm256_unpacklo_epi8(x, zero)),
+                                                           premultiply4(_mm256_unpackhi_epi8(x, zero))));
+            }
+            scalar::premultiply(rgba + i * 4, count - i);
+        }
+
+        SLIPPYGL_TARGET_AVX2 inline __m256i to565(__m256i x)
+        {
+            const __m256i m = _mm256_set1_epi32(0xFF);
+            const __m256i r = _mm256_and_si256(x, m);
+            const __m256i g = _mm256_and_si256(_mm256_srli_epi32(x, 8), m);
+            const __m256i b = _mm256_and_si256(_mm256_srli_epi32(x, 16), m);
+            const __m256i r5 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(r, _mm256_set1_epi32(249)), _mm256_set1_epi32(1014)), 11);
+            const __m256i g6 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(g, _mm256_set1_epi32(253)), _mm256_set1_epi32(505)), 10);
+            const __m256i b5 = _mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi16(b, _mm256_set1_epi32(249)), _mm256_set1_epi32(1014)), 11);
+            return _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(r5, 11), _mm256_slli_epi32(g6, 5)), b5);
+        }
+
+        SLIPPYGL_TARGET_AVX2 void pack565(const std::uint8_t* rgba, std::uint16_t* out, std::size_t count)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const __m256i* p = reinterpret_cast<const __m256i*>(rgba + i * 4);
+                // In-lane pack interleaves the 64-bit quarters; restore pixel order
+                const __m256i packed = _mm256_packus_epi32(to565(_mm256_loadu_si256(p)), to565(_mm256_loadu_si256(p + 1)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+            scalar::pack565(rgba + i * 4, out + i, count - i);
+        }
+
+        SLIPPYGL_TARGET_AVX2 void downsampleRow(const std::uint8_t* row0, const std::uint8_t* row1, std::uint8_t* dst, int dstW)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i two = _mm256_set1_epi16(2);
+            int x = 0;
+            for (; x + 8 <= dstW; x += 8)
+            {
+                const __m256i* a = reinterpret_cast<const __m256i*>(row0 + x * 8);
+                const __m256i* b = reinterpret_cast<const __m256i*>(row1 + x * 8);
+                __m256i d[2];
+                for (int h = 0; h < 2; ++h)
+                {
+                    const __m256i av = _mm256_loadu_si256(a + h), bv = _mm256_loadu_si256(b + h);
+                    const __m256i s0 = _mm256_add_epi16(_mm256_unpacklo_epi8(av, zero), _mm256_unpacklo_epi8(bv, zero));
+                    const __m256i s1 = _mm256_add_epi16(_mm256_unpackhi_epi8(av, zero), _mm256_unpackhi_epi8(bv, zero));
+                    const __m256i sum = _mm256_add_epi16(_mm256_unpacklo_epi64(s0, s1), _mm256_unpackhi_epi64(s0, s1));
+                    d[h] = _mm256_srli_epi16(_mm256_add_epi16(sum, two), 2);
+                }
+                const __m256i packed = _mm256_packus_epi16(d[0], d[1]);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + x * 4), _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0)));
+            }
+            scalar::downsampleRow(row0 + x * 8, row1 + x * 8, dst + x * 4, dstW - x);
+        }
+
+        SLIPPYGL_TARGET_AVX2 bool allOpaque(const std::uint8_t* rgba, std::size_t count)
+        {
+            const __m256i alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+            std::size_t i = 0;
+            for (; i + 32 <= count; i += 32)
+            {
+                const __m256i* p = reinterpret_cast<const __m256i*>(rgba + i * 4);
+                const __m256i acc = _mm256_and_si256(_mm256_and_si256(_mm256_loadu_si256(p), _mm256_loadu_si256(p + 1)),
+                                                     _mm256_and_si256(_mm256_loadu_si256(p + 2), _mm256_loadu_si256(p + 3)));
+                if (_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_and_si256(acc, alpha), alpha)) != -1) return false;
+            }
+            return scalar::allOpaque(rgba + i * 4, count - i);
+        }
+
+        constexpr Table kTable = { expand, premultiply, pack565, downsampleRow, allOpaque };
+
+        bool cpuSupported()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7) return false;
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 6) != 6) return false;   // OS saves YMM state
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#else
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+#endif
+        }
+    }
+#endif
+
+#if SLIPPYGL_PK_NEON
+    namespace neon
+    {
+        void expand(const std::uint8_t* rgb, std::uint8_t* rgba, std::size_t count)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const uint8x16x3_t s = vld3q_u8(rgb + i * 3);
+                uint8x16x4_t d;
+                d.val[0] = s.val[0];
+                d.val[1] = s.val[1];
+                d.val[2] = s.val[2];
+                d.val[3] = vdupq_n_u8(255);
+                vst4q_u8(rgba + i * 4, d);
+            }
+            scalar::expand(rgb + i * 3, rgba + i * 4, count - i);
+        }
+
+        inline uint8x8_t mulDiv255(uint8x8_t v, uint8x8_t a)
+        {
+            const uint16x8_t t = vaddq_u16(vmull_u8(v, a), vdupq_n_u16(128));
+            return vshrn_n_u16(vaddq_u16(t, vshrq_n_u16(t, 8)), 8);
+        }
+
+        void premultiply(std::uint8_t* rgba, std::size_t count)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                uint8x16x4_t p = vld4q_u8(rgba + i * 4);
+                const uint8x16_t a = p.val[3];
+                for (int c = 0; c < 3; ++c)
+                {
+                    p.val[c] = vcombine_u8(mulDiv255(vget_low_u8(p.val[c]), vget_low_u8(a)),
+                                           mulDiv255(vget_high_u8(p.val[c]), vget_high_u8(a)));
+                }
+                vst4q_u8(rgba + i * 4, p);
+            }
+            scalar::premultiply(rgba + i * 4, count - i);
+        }
+
+        inline uint16x8_t to565(uint8x8_t r, uint8x8_t g, uint8x8_t b)
+        {
+            const uint16x8_t r5 = vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(1014), vmovl_u8(r), 249), 11);
+            const uint16x8_t g6 = vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(505), vmovl_u8(g), 253), 10);
+            const uint16x8_t b5 = vshrq_n_u16(vmlaq_n_u16(vdupq_n_u16(1014), vmovl_u8(b), 249), 11);
+            return vorrq_u16(vorrq_u16(vshlq_n_u16(r5, 11), vshlq_n_u16(g6, 5)), b5);
+        }
+
+        void pack565(const std::uint8_t* rgba, std::uint16_t* out, std::size_t count)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                const uint8x16x4_t p = vld4q_u8(rgba + i * 4);
+                vst1q_u16(out + i, to565(vget_low_u8(p.val[0]), vget_low_u8(p.val[1]), vget_low_u8(p.val[2])));
+                vst1q_u16(out + i + 8, to565(vget_high_u8(p.val[0]), vget_high_u8(p.val[1]), vget_high_u8(p.val[2])));
+            }
+            scalar::pack565(rgba + i * 4, out + i, count - i);
+        }
+
+        void downsampleRow(const std::uint8_t* row0, const std::uint8_t* row1, std::uint8_t* dst, int dstW)
+        {
+            int x = 0;
+            for (; x + 8 <= dstW; x += 8)
+            {
+                // De-interleaved channels; pairwise adds sum each even/odd source pair
+                const uint8x16x4_t a = vld4q_u8(row0 + x * 8);
+                const uint8x16x4_t b = vld4q_u8(row1 + x * 8);
+                uint8x8x4_t d;
+                for (int c = 0; c < 4; ++c)
+                {
+                    d.val[c] = vrshrn_n_u16(vpadalq_u8(vpaddlq_u8(a.val[c]), b.val[c]), 2);
+                }
+                vst4_u8(dst + x * 4, d);
+            }
+            scalar::downsampleRow(row0 + x * 8, row1 + x * 8, dst + x * 4, dstW - x);
+        }
+
+        bool allOpaque(const std::uint8_t* rgba, std::size_t count)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16)
+            {
+                if (vminvq_u8(vld4q_u8(rgba + i * 4).val[3]) != 255) return false;
+            }
+            return scalar::allOpaque(rgba + i * 4, count - i);
+        }
+
+        constexpr Table kTable = { expand, premultiply, pack565, downsampleRow, allOpaque };
+    }
+#endif
+
+    bool avx2Supported() noexcept
+    {
+#if SLIPPYGL_PK_X86
+        static const bool supported = avx2::cpuSupported();
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+    Isa bestIsa() noexcept
+    {
+#if SLIPPYGL_PK_NEON
+        return Isa::kNEON;
+#else
+        if (avx2Supported()) return Isa::kAVX2;
+#if SLIPPYGL_PK_SSE2
+        return Isa::kSSE2;
+#else
+        return Isa::kScalar;
+#endif
+#endif
+    }
+
+    const Table& tableFor(Isa isa) noexcept
+    {
+        switch (isa)
+        {
+#if SLIPPYGL_PK_SSE2
+        case Isa::kSSE2: return sse2::kTable;
+#endif
+#if SLIPPYGL_PK_X86
+        case Isa::kAVX2: return avx2::kTable;
+#endif
+#if SLIPPYGL_PK_NEON
+        case Isa::kNEON: return neon::kTable;
+#endif
+        default: return scalar::kTable;
+        }
+    }
+
+    // Selected path; -1 until first use
+    std::atomic<int> g_isa{ -1 };
+
+    const Table& table() noexcept
+    {
+        int isa = g_isa.load(std::memory_order_relaxed);
+        if (isa < 0)
+        {
+            isa = static_cast<int>(bestIsa());
+            g_isa.store(isa, std::memory_order_relaxed);
+        }
+        return tableFor(static_cast<Isa>(isa));
+    }
+}
+
+PixelKernels::Isa PixelKernels::active() noexcept
+{
+    table();
+    return static_cast<Isa>(g_isa.load(std::memory_order_relaxed));
+}
+
+bool PixelKernels::supported(Isa isa) noexcept
+{
+    switch (isa)
+    {
+    case Isa::kScalar: return true;
+#if SLIPPYGL_PK_SSE2
+    case Isa::kSSE2: return true;
+#endif
+    case Isa::kAVX2: return avx2Supported();
+#if SLIPPYGL_PK_NEON
+    case Isa::kNEON: return true;
+#endif
+    default: return false;
+    }
+}
+
+bool PixelKernels::force(Isa isa) noexcept
+{
+    if (!supported(isa)) return false;
+    g_isa.store(static_cast<int>(isa), std::memory_order_relaxed);
+    return true;
+}
+
+void PixelKernels::reset() noexcept
+{
+    g_isa.store(static_cast<int>(bestIsa()), std::memory_order_relaxed);
+}
+
+const char* PixelKernels::name(Isa isa) noexcept
+{
+    switch (isa)
+    {
+    case Isa::kScalar: return "scalar";
+    case Isa::kSSE2: return "sse2";
+    case Isa::kAVX2: return "avx2";
+    case Isa::kNEON: return "neon";
+    }
+    return "?";
+}
+
+void PixelKernels::expandRGBtoRGBA(const std::uint8_t* rgb, std::uint8_t* rgba, std::size_t count) noexcept
+{
+    table().expand(rgb, rgba, count);
+}
+
+void PixelKernels::premultiplyAlpha(std::uint8_t* rgba, std::size_t count) noexcept
+{
+    table().premultiply(rgba, count);
+}
+
+void PixelKernels::packRGB565(const std::uint8_t* rgba, std::uint16_t* out, std::size_t count) noexcept
+{
+    table().pack565(rgba, out, count);
+}
+
+void PixelKernels::downsample2x2(const std::uint8_t* src, int srcW, int srcH, std::uint8_t* dst) noexcept
+{
+    if (!src || !dst || srcW <= 0 || srcH <= 0) return;
+
+    const int dstW = std::max(1, srcW / 2);
+    const int dstH = std::max(1, srcH / 2);
+    const std::size_t srcStride = static_cast<std::size_t>(srcW) * 4;
+    const std::size_t dstStride = static_cast<std::size_t>(dstW) * 4;
+    const Table& t = table();
+
+    for (int y = 0; y < dstH; ++y)
+    {
+        const std::uint8_t* row0 = src + static_cast<std::size_t>(std::min(y * 2, srcH - 1)) * srcStride;
+        const std::uint8_t* row1 = src + static_cast<std::size_t>(std::min(y * 2 + 1, srcH - 1)) * srcStride;
+        std::uint8_t* out = dst + static_cast<std::size_t>(y) * dstStride;
+        if (srcW >= 2)
+        {
+            t.downsampleRow(row0, row1, out, dstW);
+            continue;
+        }
+        // One column: the pair is the pixel with itself
+        for (int k = 0; k < 4; ++k)
+        {
+            out[k] = static_cast<std::uint8_t>((2 * row0[k] + 2 * row1[k] + 2) >> 2);
+        }
+    }
+}
+
+bool PixelKernels::allOpaque(const std::uint8_t* rgba, std::size_t count) noexcept
+{
+    return table().allOpaque(rgba, count);
+}
+
+} // namespace slippygl::decode
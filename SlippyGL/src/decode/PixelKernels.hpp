@@ -0,0 +1,75 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace slippygl::decode
+{
+/**
+ * Vectorized pixel kernels for the tile decode/upload path
+ * - Scalar reference, SSE2 (x86-64 baseline), AVX2 (picked at runtime via
+ *   CPUID) and NEON (AArch64 baseline)
+ * - Every path is bit-exact with the scalar one; unit tests compare them on
+ *   random data, so the scalar code is also the specification
+ * - The best supported path is selected on first use; force() pins one for
+ *   tests and benchmarks
+ * Pixel pointers need no alignment. RGBA8 is 4 bytes per pixel, memory order r, g, b, a.
+ */
+class PixelKernels
+{
+public:
+    enum class Isa : std::uint8_t
+    {
+        kScalar = 0,
+        kSSE2,
+        kAVX2,
+        kNEON,
+    };
+
+    /// Path currently in use
+    static Isa active() noexcept;
+
+    /// Whether this build and CPU can run isa
+    static bool supported(Isa isa) noexcept;
+
+    /**
+     * Use isa for all following calls (process-wide)
+     * @return false (selection unchanged) if isa isn't supported
+     */
+    static bool force(Isa isa) noexcept;
+
+    /// Back to the best supported path
+    static void reset() noexcept;
+
+    static const char* name(Isa isa) noexcept;
+
+    /**
+     * RGB8 -> RGBA8 with alpha 255
+     * @param count Pixels
+     */
+    static void expandRGBtoRGBA(const std::uint8_t* rgb, std::uint8_t* rgba, std::size_t count) noexcept;
+
+    /**
+     * Premultiply color by alpha in place: c = round(c * a / 255)
+     */
+    static void premultiplyAlpha(std::uint8_t* rgba, std::size_t count) noexcept;
+
+    /**
+     * RGBA8 -> RGB565 (GL_UNSIGNED_SHORT_5_6_5, red in the high bits), each
+     * channel rounded to the nearest level; alpha is ignored
+     */
+    static void packRGB565(const std::uint8_t* rgba, std::uint16_t* out, std::size_t count) noexcept;
+
+    /**
+     * 2x2 box filter of an RGBA8 image: dst is max(1, w/2) x max(1, h/2),
+     * rows tightly packed. Each output is the rounded mean of its four sources;
+     * a 1-pixel-wide or -tall source repeats its only column/row.
+     */
+    static void downsample2x2(const std::uint8_t* src, int srcW, int srcH, std::uint8_t* dst) noexcept;
+
+    /**
+     * True if every pixel's alpha is 255 (stops at the first block that isn't)
+     */
+    static bool allOpaque(const std::uint8_t* rgba, std::size_t count) noexcept;
+};
+
+} // namespace slippygl::decode
@@ -1,4 +1,5 @@
 ﻿#include "PngCodec.hpp"
+#include "../core/Profiler.hpp"
 
 // stb_image declarations only. The single implementation translation unit is
 // external/stb_image_impl.cpp (defines STB_IMAGE_IMPLEMENTATION there).
@@ -32,11 +33,22 @@ bool PngCodec::decode(const std::vector<std::uint8_t>& pngBytes,
                      const std::int32_t desiredChannels,
                      std::string* err) noexcept
 {
+    return decode(pngBytes.data(), pngBytes.size(), out, desiredChannels, err);
+}
+
+bool PngCodec::decode(const std::uint8_t* data,
+                     std::size_t size,
+                     Image& out,
+                     const std::int32_t desiredChannels,
+                     std::string* err) noexcept
+{
+    SLIPPYGL_ZONE("decode.png");
+
     // Reset output
     out.clear();
 
     // Validate input
-    if (pngBytes.empty())
+    if (!data || size == 0)
     {
         if (err) 
         {
@@ -57,7 +69,7 @@ bool PngCodec::decode(const std::vector<std::uint8_t>& pngBytes,
     }
 
     // Size limit (memory protection, 256MB max)
-    if (pngBytes.size() > 256 * 1024 * 1024) 
+    if (size > 256 * 1024 * 1024) 
     {
         if (err) 
         {
@@ -71,15 +83,15 @@ bool PngCodec::decode(const std::vector<std::uint8_t>& pngBytes,
         std::int32_t w = 0, h = 0, originalChannels = 0;
         const std::int32_t requestedChannels = (desiredChannels == 0) ? 0 : desiredChannels;
         
-        unsigned char* data = stbi_load_from_memory(
-            pngBytes.data(), 
-            static_cast<int>(pngBytes.size()), 
+        unsigned char* pixels = stbi_load_from_memory(
+            data, 
+            static_cast<int>(size), 
             &w, &h, &originalChannels, 
             requestedChannels
         );
 
         // RAII memory management
-        StbImageRAII dataGuard(data);
+        StbImageRAII dataGuard(pixels);
         
         if (!dataGuard) 
         {
@@ -114,7 +126,7 @@ bool PngCodec::decode(const std::vector<std::uint8_t>& pngBytes,
         out.width = w;
         out.height = h;
         out.channels = finalChannels;
-        out.pixels.assign(data, data + pixelDataSize);
+        out.pixels.assign(pixels, pixels + pixelDataSize);
 
         return true;
     }
@@ -26,6 +26,18 @@ public:
                       Image& out,
                       const std::int32_t desiredChannels = 4,
                       std::string* err = nullptr) noexcept;
+
+    /**
+     * Decode PNG from a raw byte range (zero-copy input, e.g. memory-mapped archive)
+     * @param data Pointer to PNG bytes
+     * @param size Byte count
+     * @see decode(const std::vector<std::uint8_t>&, Image&, std::int32_t, std::string*)
+     */
+    static bool decode(const std::uint8_t* data,
+                      std::size_t size,
+                      Image& out,
+                      const std::int32_t desiredChannels = 4,
+                      std::string* err = nullptr) noexcept;
 };
 
 } // namespace slippygl::decode
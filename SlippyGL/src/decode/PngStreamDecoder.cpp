@@ -0,0 +1,437 @@
+#include "PngStreamDecoder.hpp"
+#include "PixelKernels.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace slippygl::decode
+{
+
+namespace
+{
+    constexpr std::uint8_t kSignature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    constexpr std::int32_t kMaxDimension = 16384;
+
+    constexpr std::uint32_t chunkId(const char (&s)[5]) noexcept
+    {
+        return (static_cast<std::uint32_t>(static_cast<std::uint8_t>(s[0])) << 24)
+             | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(s[1])) << 16)
+             | (static_cast<std::uint32_t>(static_cast<std::uint8_t>(s[2])) << 8)
+             |  static_cast<std::uint32_t>(static_cast<std::uint8_t>(s[3]));
+    }
+
+    constexpr std::uint32_t kIHDR = chunkId("IHDR");
+    constexpr std::uint32_t kPLTE = chunkId("PLTE");
+    constexpr std::uint32_t kTRNS = chunkId("tRNS");
+    constexpr std::uint32_t kIDAT = chunkId("IDAT");
+    constexpr std::uint32_t kIEND = chunkId("IEND");
+
+    std::uint32_t readBE32(const std::uint8_t* p) noexcept
+    {
+        return (static_cast<std::uint32_t>(p[0]) << 24) | (static_cast<std::uint32_t>(p[1]) << 16)
+             | (static_cast<std::uint32_t>(p[2]) << 8) | static_cast<std::uint32_t>(p[3]);
+    }
+
+    std::uint8_t paeth(const int a, const int b, const int c) noexcept
+    {
+        const int p = a + b - c;
+        const int pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+        if (pa <= pb && pa <= pc) return static_cast<std::uint8_t>(a);
+        if (pb <= pc) return static_cast<std::uint8_t>(b);
+        return static_cast<std::uint8_t>(c);
+    }
+
+    // Longest metadata chunk we buffer (PLTE: 256 * 3)
+    std::uint32_t maxBufferedChunk(const std::uint32_t type) noexcept
+    {
+        if (type == kIHDR) return 13;
+        if (type == kPLTE) return 768;
+        if (type == kTRNS) return 256;
+        return 0;
+    }
+}
+
+PngStreamDecoder::~PngStreamDecoder()
+{
+    if (zInit_) inflateEnd(&zs_);
+}
+
+void PngStreamDecoder::reset()
+{
+    if (zInit_)
+    {
+        inflateEnd(&zs_);
+        zInit_ = false;
+    }
+    zs_ = z_stream{};
+    state_ = State::kNeedMore;
+    phase_ = Phase::kSignature;
+    error_.clear();
+    hdrFill_ = 0;
+    chunkType_ = 0;
+    chunkLeft_ = 0;
+    chunkBuf_.clear();
+    crcLeft_ = 0;
+    seenHeader_ = false;
+    width_ = height_ = 0;
+    bitDepth_ = colorType_ = channels_ = 0;
+    bpp_ = rowBytes_ = 0;
+    std::memset(palette_, 0, sizeof(palette_));
+    paletteSize_ = 0;
+    hasColorKey_ = false;
+    cur_.clear();
+    prev_.clear();
+    curFill_ = 0;
+    row_ = 0;
+    pixels_.clear();
+}
+
+bool PngStreamDecoder::fail(const State s, const char* msg)
+{
+    state_ = s;
+    error_ = msg;
+    return false;
+}
+
+bool PngStreamDecoder::feed(const std::uint8_t* data, const std::size_t size)
+{
+    std::size_t i = 0;
+    while (i < size && state_ == State::kNeedMore)
+    {
+        switch (phase_)
+        {
+        case Phase::kSignature:
+        case Phase::kChunkHeader:
+        {
+            const std::size_t n = std::min(sizeof(hdr_) - hdrFill_, size - i);
+            std::memcpy(hdr_ + hdrFill_, data + i, n);
+            hdrFill_ += n;
+            i += n;
+            if (hdrFill_ < sizeof(hdr_)) break;
+            hdrFill_ = 0;
+
+            if (phase_ == Phase::kSignature)
+            {
+                if (std::memcmp(hdr_, kSignature, sizeof(kSignature)) != 0)
+                    return fail(State::kFailed, "Not a PNG stream");
+                phase_ = Phase::kChunkHeader;
+                break;
+            }
+
+            chunkLeft_ = readBE32(hdr_);
+            chunkType_ = readBE32(hdr_ + 4);
+            if (chunkLeft_ > 0x7FFFFFFFu) return fail(State::kFailed, "Invalid chunk length");
+            if (!seenHeader_ && chunkType_ != kIHDR) return fail(State::kFailed, "Missing IHDR");
+            if (maxBufferedChunk(chunkType_) && chunkLeft_ > maxBufferedChunk(chunkType_))
+                return fail(State::kFailed, "Oversized metadata chunk");
+            if (chunkType_ == kIDAT && !zInit_) return fail(State::kFailed, "IDAT before IHDR");
+            if (chunkType_ == kIDAT && colorType_ == 3 && paletteSize_ == 0)
+                return fail(State::kFailed, "Missing PLTE");
+
+            chunkBuf_.clear();
+            phase_ = Phase::kChunkData;
+            if (chunkLeft_ == 0)
+            {
+                if (!onChunkComplete()) return false;
+                phase_ = Phase::kChunkCrc;
+                crcLeft_ = 4;
+            }
+            break;
+        }
+
+        case Phase::kChunkData:
+        {
+            const std::size_t n = std::min<std::size_t>(chunkLeft_, size - i);
+            if (chunkType_ == kIDAT)
+            {
+                if (!inflateData(data + i, n)) return false;
+            }
+            else if (maxBufferedChunk(chunkType_))
+            {
+                chunkBuf_.insert(chunkBuf_.end(), data + i, data + i + n);
+            }
+            // Other ancillary chunks are skipped without buffering
+            chunkLeft_ -= static_cast<std::uint32_t>(n);
+            i += n;
+            if (chunkLeft_ == 0)
+            {
+                if (!onChunkComplete()) return false;
+                phase_ = Phase::kChunkCrc;
+                crcLeft_ = 4;
+            }
+            break;
+        }
+
+        case Phase::kChunkCrc:
+        {
+            const std::size_t n = std::min<std::size_t>(crcLeft_, size - i);
+            crcLeft_ -= static_cast<std::uint32_t>(n);
+            i += n;
+            if (crcLeft_ == 0) phase_ = (chunkType_ == kIEND) ? Phase::kEnd : Phase::kChunkHeader;
+            break;
+        }
+
+        case Phase::kEnd:
+            i = size;   // trailing bytes after IEND are ignored
+            break;
+        }
+    }
+    return state_ == State::kNeedMore || state_ == State::kDone;
+}
+
+bool PngStreamDecoder::onChunkComplete()
+{
+    if (chunkType_ == kIHDR)
+    {
+        return parseHeader();
+    }
+    if (chunkType_ == kPLTE)
+    {
+        if (chunkBuf_.empty() || chunkBuf_.size() % 3 != 0) return fail(State::kFailed, "Invalid PLTE length");
+        paletteSize_ = static_cast<int>(chunkBuf_.size() / 3);
+        for (std::size_t k = 0; k * 3 < chunkBuf_.size(); ++k)
+        {
+            palette_[k * 4 + 0] = chunkBuf_[k * 3 + 0];
+            palette_[k * 4 + 1] = chunkBuf_[k * 3 + 1];
+            palette_[k * 4 + 2] = chunkBuf_[k * 3 + 2];
+        }
+        return true;
+    }
+    if (chunkType_ == kTRNS)
+    {
+        if (colorType_ == 3)
+        {
+            for (std::size_t k = 0; k < chunkBuf_.size(); ++k) palette_[k * 4 + 3] = chunkBuf_[k];
+        }
+        else if (colorType_ == 0 && chunkBuf_.size() >= 2)
+        {
+            hasColorKey_ = true;
+            colorKey_[0] = static_cast<std::uint16_t>((chunkBuf_[0] << 8) | chunkBuf_[1]);
+        }
+        else if (colorType_ == 2 && chunkBuf_.size() >= 6)
+        {
+            hasColorKey_ = true;
+            for (int c = 0; c < 3; ++c)
+                colorKey_[c] = static_cast<std::uint16_t>((chunkBuf_[c * 2] << 8) | chunkBuf_[c * 2 + 1]);
+        }
+        return true;
+    }
+    if (chunkType_ == kIEND)
+    {
+        if (row_ < height_) return fail(State::kFailed, "Truncated image data");
+        return true;
+    }
+    return true;
+}
+
+bool PngStreamDecoder::parseHeader()
+{
+    if (seenHeader_ || chunkBuf_.size() != 13) return fail(State::kFailed, "Invalid IHDR");
+    seenHeader_ = true;
+
+    const std::uint32_t w = readBE32(chunkBuf_.data());
+    const std::uint32_t h = readBE32(chunkBuf_.data() + 4);
+    bitDepth_ = chunkBuf_[8];
+    colorType_ = chunkBuf_[9];
+    const int compression = chunkBuf_[10], filter = chunkBuf_[11], interlace = chunkBuf_[12];
+
+    if (w == 0 || h == 0) return fail(State::kFailed, "Invalid image dimensions");
+    if (compression != 0 || filter != 0 || interlace > 1) return fail(State::kFailed, "Invalid IHDR method");
+
+    bool depthOk = false;
+    switch (colorType_)
+    {
+    case 0: channels_ = 1; depthOk = bitDepth_ == 1 || bitDepth_ == 2 || bitDepth_ == 4 || bitDepth_ == 8 || bitDepth_ == 16; break;
+    case 2: channels_ = 3; depthOk = bitDepth_ == 8 || bitDepth_ == 16; break;
+    case 3: channels_ = 1; depthOk = bitDepth_ == 1 || bitDepth_ == 2 || bitDepth_ == 4 || bitDepth_ == 8; break;
+    case 4: channels_ = 2; depthOk = bitDepth_ == 8 || bitDepth_ == 16; break;
+    case 6: channels_ = 4; depthOk = bitDepth_ == 8 || bitDepth_ == 16; break;
+    default: break;
+    }
+    if (!depthOk) return fail(State::kFailed, "Invalid color type / bit depth");
+
+    // Valid but not streamed: the caller falls back to the full-buffer decoder
+    if (interlace == 1) return fail(State::kUnsupported, "Interlaced PNG");
+    if (w > static_cast<std::uint32_t>(kMaxDimension) || h > static_cast<std::uint32_t>(kMaxDimension))
+        return fail(State::kUnsupported, "Image too large to stream");
+
+    width_ = static_cast<std::int32_t>(w);
+    height_ = static_cast<std::int32_t>(h);
+    const std::size_t bitsPerPixel = static_cast<std::size_t>(channels_) * static_cast<std::size_t>(bitDepth_);
+    bpp_ = std::max<std::size_t>(1, bitsPerPixel / 8);
+    rowBytes_ = (static_cast<std::size_t>(width_) * bitsPerPixel + 7) / 8;
+
+    cur_.assign(rowBytes_ + 1, 0);
+    prev_.assign(rowBytes_, 0);
+    pixels_.assign(static_cast<std::size_t>(width_) * static_cast<std::size_t>(height_) * 4, 0);
+
+    // Palette entries without tRNS are opaque
+    for (int k = 0; k < 256; ++k) palette_[k * 4 + 3] = 255;
+
+    if (inflateInit(&zs_) != Z_OK) return fail(State::kFailed, "inflateInit failed");
+    zInit_ = true;
+    return true;
+}
+
+bool PngStreamDecoder::inflateData(const std::uint8_t* data, const std::size_t size)
+{
+    zs_.next_in = const_cast<Bytef*>(data);
+    zs_.avail_in = static_cast<uInt>(size);
+
+    while (zs_.avail_in > 0 && row_ < height_)
+    {
+        zs_.next_out = cur_.data() + curFill_;
+        zs_.avail_out = static_cast<uInt>(cur_.size() - curFill_);
+        const int rc = inflate(&zs_, Z_NO_FLUSH);
+        curFill_ = cur_.size() - zs_.avail_out;
+
+        if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR)
+            return fail(State::kFailed, "Corrupt IDAT stream");
+
+        if (curFill_ == cur_.size())
+        {
+            curFill_ = 0;
+            if (cur_[0] > 4) return fail(State::kFailed, "Invalid filter type");
+            if (!emitRow()) return fail(State::kFailed, "Palette index out of range");
+            if (row_ == height_)
+            {
+                // Pixels are final; anything after the last scanline is only framing
+                state_ = State::kDone;
+                return true;
+            }
+        }
+        if (rc == Z_STREAM_END) return fail(State::kFailed, "Truncated image data");
+    }
+    return true;
+}
+
+bool PngStreamDecoder::emitRow()
+{
+    // Unfilter in place (filter byte validated by the caller)
+    std::uint8_t* line = cur_.data() + 1;
+    const std::uint8_t* up = prev_.data();
+    const std::size_t n = rowBytes_;
+    const std::size_t bpp = bpp_;
+
+    switch (cur_[0])
+    {
+    case 1: // Sub
+        for (std::size_t k = bpp; k < n; ++k) line[k] = static_cast<std::uint8_t>(line[k] + line[k - bpp]);
+        break;
+    case 2: // Up
+        for (std::size_t k = 0; k < n; ++k) line[k] = static_cast<std::uint8_t>(line[k] + up[k]);
+        break;
+    case 3: // Average
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            const int left = k >= bpp ? line[k - bpp] : 0;
+            line[k] = static_cast<std::uint8_t>(line[k] + ((left + up[k]) >> 1));
+        }
+        break;
+    case 4: // Paeth
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            const int left = k >= bpp ? line[k - bpp] : 0;
+            const int upLeft = k >= bpp ? up[k - bpp] : 0;
+            line[k] = static_cast<std::uint8_t>(line[k] + paeth(left, up[k], upLeft));
+        }
+        break;
+    default:
+        break;
+    }
+
+    // Expand to RGBA8
+    std::uint8_t* dst = pixels_.data() + static_cast<std::size_t>(row_) * static_cast<std::size_t>(width_) * 4;
+    const int bd = bitDepth_;
+    const std::uint32_t mask = (1u << std::min(bd, 8)) - 1u;
+    auto sample = [&](const std::size_t idx) -> std::uint32_t {
+        if (bd == 16) return (static_cast<std::uint32_t>(line[idx * 2]) << 8) | line[idx * 2 + 1];
+        if (bd == 8) return line[idx];
+        const std::size_t bit = idx * static_cast<std::size_t>(bd);
+        return (line[bit >> 3] >> (8 - bd - static_cast<int>(bit & 7))) & mask;
+    };
+    auto to8 = [&](const std::uint32_t v) -> std::uint8_t {
+        if (bd == 16) return static_cast<std::uint8_t>(v >> 8);
+        if (bd == 8) return static_cast<std::uint8_t>(v);
+        return static_cast<std::uint8_t>(v * 255u / mask);
+    };
+
+    const std::size_t w = static_cast<std::size_t>(width_);
+    switch (colorType_)
+    {
+    case 0:
+        for (std::size_t x = 0; x < w; ++x, dst += 4)
+        {
+            const std::uint32_t g = sample(x);
+            dst[0] = dst[1] = dst[2] = to8(g);
+            dst[3] = (hasColorKey_ && g == colorKey_[0]) ? 0 : 255;
+        }
+        break;
+    case 2:
+        if (bd == 8 && !hasColorKey_)
+        {
+            PixelKernels::expandRGBtoRGBA(line, dst, w);
+            break;
+        }
+        for (std::size_t x = 0; x < w; ++x, dst += 4)
+        {
+            const std::uint32_t r = sample(x * 3), g = sample(x * 3 + 1), b = sample(x * 3 + 2);
+            dst[0] = to8(r);
+            dst[1] = to8(g);
+            dst[2] = to8(b);
+            dst[3] = (hasColorKey_ && r == colorKey_[0] && g == colorKey_[1] && b == colorKey_[2]) ? 0 : 255;
+        }
+        break;
+    case 3:
+        for (std::size_t x = 0; x < w; ++x, dst += 4)
+        {
+            const std::uint32_t index = sample(x);
+            if (index >= static_cast<std::uint32_t>(paletteSize_)) return false;
+            std::memcpy(dst, palette_ + index * 4, 4);
+        }
+        break;
+    case 4:
+        for (std::size_t x = 0; x < w; ++x, dst += 4)
+        {
+            dst[0] = dst[1] = dst[2] = to8(sample(x * 2));
+            dst[3] = to8(sample(x * 2 + 1));
+        }
+        break;
+    case 6:
+        if (bd == 8)
+        {
+            std::memcpy(dst, line, w * 4);
+            break;
+        }
+        for (std::size_t x = 0; x < w * 4; ++x) dst[x] = to8(sample(x));
+        break;
+    default:
+        break;
+    }
+
+    std::memcpy(prev_.data(), line, n);
+    ++row_;
+    return true;
+}
+
+bool PngStreamDecoder::finish(Image& out, std::string* err)
+{
+    out.clear();
+    if (state_ != State::kDone)
+    {
+        if (err)
+        {
+            *err = !error_.empty() ? error_ : std::string("Truncated PNG stream");
+        }
+        return false;
+    }
+    out.width = width_;
+    out.height = height_;
+    out.channels = 4;
+    out.pixels = std::move(pixels_);
+    pixels_.clear();
+    return true;
+}
+
+} // namespace slippygl::decode
@@ -0,0 +1,108 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <zlib.h>
+#include "Image.hpp"
+
+namespace slippygl::decode
+{
+/**
+ * Incremental PNG decoder that consumes bytes as they arrive from the network
+ * - Chunks are parsed on the fly and IDAT data is inflated immediately, so
+ *   scanlines are unfiltered and expanded to RGBA8 while the body downloads
+ * - Supports every non-interlaced PNG color type and bit depth
+ * - Interlaced (Adam7) images report unsupported(); callers fall back to
+ *   PngCodec on the buffered body
+ * - Like stb_image, chunk CRCs and the zlib checksum are not verified; the
+ *   image is final as soon as the last scanline inflates
+ */
+class PngStreamDecoder
+{
+public:
+    enum class State : std::uint8_t
+    {
+        kNeedMore = 0,   // waiting for more bytes
+        kDone,           // every scanline decoded
+        kUnsupported,    // valid PNG we don't stream (e.g. interlaced)
+        kFailed          // malformed input
+    };
+
+    PngStreamDecoder() = default;
+    ~PngStreamDecoder();
+
+    // Non-copyable (owns a zlib stream)
+    PngStreamDecoder(const PngStreamDecoder&) = delete;
+    PngStreamDecoder& operator=(const PngStreamDecoder&) = delete;
+
+    /// Discard all state (e.g. before a retried download)
+    void reset();
+
+    /**
+     * Consume the next bytes of the PNG stream
+     * @return false once the decoder has failed or gone unsupported
+     */
+    bool feed(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * Hand over the decoded RGBA8 image
+     * @param out Receives the image on success
+     * @param err Pointer to string for error message (can be nullptr)
+     * @return true if the whole image was decoded
+     */
+    bool finish(Image& out, std::string* err = nullptr);
+
+    State state() const noexcept { return state_; }
+    bool unsupported() const noexcept { return state_ == State::kUnsupported; }
+    std::int32_t width() const noexcept { return width_; }
+    std::int32_t height() const noexcept { return height_; }
+    std::int32_t rowsDecoded() const noexcept { return row_; }
+    const std::string& error() const noexcept { return error_; }
+
+private:
+    enum class Phase : std::uint8_t { kSignature, kChunkHeader, kChunkData, kChunkCrc, kEnd };
+
+    bool fail(State s, const char* msg);
+    bool onChunkComplete();
+    bool parseHeader();
+    bool inflateData(const std::uint8_t* data, std::size_t size);
+    bool emitRow();                 // false on an out-of-range palette index
+
+    State state_ = State::kNeedMore;
+    Phase phase_ = Phase::kSignature;
+    std::string error_;
+
+    // Chunk framing
+    std::uint8_t hdr_[8] = {};
+    std::size_t hdrFill_ = 0;
+    std::uint32_t chunkType_ = 0;
+    std::uint32_t chunkLeft_ = 0;
+    std::vector<std::uint8_t> chunkBuf_;   // small metadata chunks only (IHDR/PLTE/tRNS)
+    std::uint32_t crcLeft_ = 0;
+    bool seenHeader_ = false;
+
+    // Image header
+    std::int32_t width_ = 0;
+    std::int32_t height_ = 0;
+    int bitDepth_ = 0;
+    int colorType_ = 0;
+    int channels_ = 0;          // samples per pixel in the file
+    std::size_t bpp_ = 0;       // filter byte distance
+    std::size_t rowBytes_ = 0;  // packed row size without the filter byte
+
+    std::uint8_t palette_[256 * 4] = {};
+    int paletteSize_ = 0;       // PLTE entries; 0 until PLTE is seen
+    bool hasColorKey_ = false;
+    std::uint16_t colorKey_[3] = {};
+
+    // Inflate + scanline state
+    z_stream zs_{};
+    bool zInit_ = false;
+    std::vector<std::uint8_t> cur_;    // filter byte + row
+    std::vector<std::uint8_t> prev_;   // previous unfiltered row (no filter byte)
+    std::size_t curFill_ = 0;
+    std::int32_t row_ = 0;
+    std::vector<std::uint8_t> pixels_; // RGBA8 output
+};
+
+} // namespace slippygl::decode
@@ -0,0 +1,105 @@
+#include "TexelPack.hpp"
+#include "PixelKernels.hpp"
+#include "../core/Profiler.hpp"
+
+#include <cstring>
+
+namespace slippygl::decode
+{
+
+namespace
+{
+    bool isRgba8(const Image& img) noexcept
+    {
+        return img.valid() && img.channels == 4;
+    }
+
+    std::uint32_t load32(const std::uint8_t* p) noexcept
+    {
+        std::uint32_t v;
+        std::memcpy(&v, p, 4);
+        return v;
+    }
+}
+
+bool TexelPack::toIndexed(const Image& img,
+                          std::vector<std::uint8_t>& indices,
+                          std::vector<std::uint8_t>& palette)
+{
+    SLIPPYGL_ZONE("decode.palette");
+
+    indices.clear();
+    palette.clear();
+    if (!isRgba8(img)) return false;
+
+    // Open-addressed color -> index table, 2x the palette so probes stay short
+    constexpr std::uint32_t kSlots = 2 * kMaxPaletteSize;
+    std::uint32_t keys[kSlots];
+    std::int16_t values[kSlots];
+    std::memset(values, 0xFF, sizeof(values));   // -1 = empty
+
+    const std::size_t count = static_cast<std::size_t>(img.width) * static_cast<std::size_t>(img.height);
+    indices.resize(count);
+    const std::uint8_t* src = img.pixels.data();
+
+    // Map tiles are runs of the same fill: check the previous pixel before hashing
+    std::uint32_t lastColor = 0;
+    int lastIndex = -1;
+    for (std::size_t i = 0; i < count; ++i, src += 4)
+    {
+        const std::uint32_t color = load32(src);
+        if (color != lastColor || lastIndex < 0)
+        {
+            std::uint32_t slot = (color * 2654435761u) >> 23;   // top 9 bits: 0..511
+            while (values[slot] >= 0 && keys[slot] != color) slot = (slot + 1) & (kSlots - 1);
+            if (values[slot] < 0)
+            {
+                const int next = static_cast<int>(palette.size() / 4);
+                if (next == kMaxPaletteSize)
+                {
+                    indices.clear();
+                    palette.clear();
+                    return false;
+                }
+                keys[slot] = color;
+                values[slot] = static_cast<std::int16_t>(next);
+                palette.insert(palette.end(), src, src + 4);
+            }
+            lastColor = color;
+            lastIndex = values[slot];
+        }
+        indices[i] = static_cast<std::uint8_t>(lastIndex);
+    }
+    return true;
+}
+
+bool TexelPack::toRGB8(const Image& img, std::vector<std::uint8_t>& out)
+{
+    out.clear();
+    if (!isRgba8(img)) return false;
+
+    const std::size_t count = static_cast<std::size_t>(img.width) * static_cast<std::size_t>(img.height);
+    out.resize(count * 3);
+    const std::uint8_t* src = img.pixels.data();
+    std::uint8_t* dst = out.data();
+    for (std::size_t i = 0; i < count; ++i, src += 4, dst += 3)
+    {
+        dst[0] = src[0];
+        dst[1] = src[1];
+        dst[2] = src[2];
+    }
+    return true;
+}
+
+bool TexelPack::toRGB565(const Image& img, std::vector<std::uint16_t>& out)
+{
+    out.clear();
+    if (!isRgba8(img)) return false;
+
+    const std::size_t count = static_cast<std::size_t>(img.width) * static_cast<std::size_t>(img.height);
+    out.resize(count);
+    PixelKernels::packRGB565(img.pixels.data(), out.data(), count);
+    return true;
+}
+
+} // namespace slippygl::decode
@@ -0,0 +1,46 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Image.hpp"
+
+namespace slippygl::decode
+{
+/**
+ * Repack decoded RGBA8 tiles into smaller texel layouts for upload
+ * - Indexed: up to 256 distinct RGBA colors -> 1-byte indices + palette
+ *   (lossless; typical for 8-bit paletted OSM tiles and flat fills)
+ * - RGB8: opaque tiles without the alpha byte (lossless)
+ * - RGB565: opaque tiles at 2 bytes per texel (lossy, <= 4 levels per channel)
+ */
+class TexelPack
+{
+public:
+    static constexpr int kMaxPaletteSize = 256;
+
+    /**
+     * Find the image's distinct colors and index every pixel
+     * Stops as soon as a 257th color turns up, so full-color tiles cost little.
+     * @param img RGBA8 image
+     * @param indices One byte per pixel, row-major (replaced)
+     * @param palette RGBA8 entries, 4 bytes each (replaced, at most 256 entries)
+     * @return false if the image has more than 256 colors or isn't RGBA8 (outputs cleared)
+     */
+    static bool toIndexed(const Image& img,
+                          std::vector<std::uint8_t>& indices,
+                          std::vector<std::uint8_t>& palette);
+
+    /**
+     * Drop alpha: 3 bytes per pixel, row-major
+     * @return false if img isn't RGBA8
+     */
+    static bool toRGB8(const Image& img, std::vector<std::uint8_t>& out);
+
+    /**
+     * Round each channel to 5/6/5 bits (GL_UNSIGNED_SHORT_5_6_5, red in the high bits)
+     * @return false if img isn't RGBA8
+     */
+    static bool toRGB565(const Image& img, std::vector<std::uint16_t>& out);
+};
+
+} // namespace slippygl::decode
@@ -49,4 +49,52 @@ CurlEasy& CurlEasy::operator=(CurlEasy&& o) noexcept
     return *this;
 }
 
+CurlShare::CurlShare(const bool shareConnections) : h_(curl_share_init()) 
+{
+    if (!h_) 
+    {
+        throw std::runtime_error("curl_share_init failed");
+    }
+    curl_share_setopt(h_, CURLSHOPT_LOCKFUNC, &CurlShare::lockCb);
+    curl_share_setopt(h_, CURLSHOPT_UNLOCKFUNC, &CurlShare::unlockCb);
+    curl_share_setopt(h_, CURLSHOPT_USERDATA, this);
+
+    curl_share_setopt(h_, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+    curl_share_setopt(h_, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900
+    if (shareConnections)
+    {
+        sharesConnections_ = curl_share_setopt(h_, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT) == CURLSHE_OK;
+    }
+#else
+    (void)shareConnections;
+#endif
+}
+
+CurlShare::~CurlShare() 
+{
+    if (h_) 
+    {
+        curl_share_cleanup(h_);
+        h_ = nullptr;
+    }
+}
+
+void CurlShare::attach(CURL* easy) noexcept 
+{
+    curl_easy_setopt(easy, CURLOPT_SHARE, h_);
+}
+
+void CurlShare::lockCb(CURL*, curl_lock_data data, curl_lock_access, void* userptr) 
+{
+    auto* self = static_cast<CurlShare*>(userptr);
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) self->locks_[data].lock();
+}
+
+void CurlShare::unlockCb(CURL*, curl_lock_data data, void* userptr) 
+{
+    auto* self = static_cast<CurlShare*>(userptr);
+    if (data >= 0 && data < CURL_LOCK_DATA_LAST) self->locks_[data].unlock();
+}
+
 } // namespace slippygl::net
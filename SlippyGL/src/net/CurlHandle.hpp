@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include <curl/curl.h>
+#include <mutex>
 #include <stdexcept>
 
 namespace slippygl::net 
@@ -31,4 +32,35 @@ private:
     CURL* h_ = nullptr;
 };
 
+// CURLSH RAII: DNS 캐시와 TLS 세션 ID를 여러 easy 핸들/HttpClient가 공유
+// - curl_share 락 콜백을 데이터 종류별 mutex로 구현 (멀티스레드 사용 가능)
+// - 연결 캐시(CURL_LOCK_DATA_CONNECT)는 기본으로 공유하지 않는다: libcurl 문서상
+//   공유 연결 캐시는 여러 스레드에서 동시에 쓰면 안전하지 않다.
+//   한 스레드 또는 multi 핸들 하나에서만 쓸 때 shareConnections=true로 켠다.
+//   (기본 구성에서는 HttpClient가 easy 핸들을 재사용해 keep-alive 연결을 유지한다)
+// - 핸들을 붙인 easy 핸들보다 오래 살아야 한다 (HttpClient는 shared_ptr로 보유)
+class CurlShare 
+{
+public:
+    explicit CurlShare(bool shareConnections = false);
+    ~CurlShare();
+    CurlShare(const CurlShare&) = delete;
+    CurlShare& operator=(const CurlShare&) = delete;
+
+    CURLSH* get() noexcept { return h_; }
+    // easy 핸들에 공유 객체 연결
+    void attach(CURL* easy) noexcept;
+    // 연결 캐시 공유 여부 (요청했고 libcurl 7.57+일 때만 true)
+    bool sharesConnections() const noexcept { return sharesConnections_; }
+
+private:
+    static void lockCb(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr);
+    static void unlockCb(CURL* handle, curl_lock_data data, void* userptr);
+
+    CurlGlobal global_;                 // curl_global_init은 참조 카운트됨: 공유 객체보다 먼저 초기화
+    CURLSH* h_ = nullptr;
+    bool sharesConnections_ = false;
+    std::mutex locks_[CURL_LOCK_DATA_LAST];
+};
+
 } // namespace slippygl::net
@@ -0,0 +1,225 @@
+#include "HostGovernor.hpp"
+
+#include <algorithm>
+#include <cctype>
+
+namespace slippygl::net
+{
+
+namespace
+{
+    constexpr double kMinRateFactor = 0.1;     // 429가 이어져도 설정값의 10% 밑으로는 내리지 않음
+    constexpr double kRecoverPerSuccess = 0.05;
+}
+
+// ==== HostPermit ====
+
+HostPermit::HostPermit(HostPermit&& o) noexcept
+    : gov_(o.gov_), host_(std::move(o.host_))
+{
+    o.gov_ = nullptr;
+}
+
+HostPermit& HostPermit::operator=(HostPermit&& o) noexcept
+{
+    if (this != &o)
+    {
+        release();
+        gov_ = o.gov_;
+        host_ = std::move(o.host_);
+        o.gov_ = nullptr;
+    }
+    return *this;
+}
+
+void HostPermit::release() noexcept
+{
+    if (gov_)
+    {
+        gov_->release(host_);
+        gov_ = nullptr;
+    }
+}
+
+// ==== HostGovernor ====
+
+HostGovernor::HostGovernor(GovernorConfig cfg) : cfg_(std::move(cfg)) {}
+
+HostGovernor::HostState& HostGovernor::stateFor(const std::string& host)
+{
+    auto it = hosts_.find(host);
+    if (it == hosts_.end())
+    {
+        HostState st;
+        st.tokens = static_cast<double>(std::max(1, cfg_.burst()));
+        st.lastRefill = Clock::now();
+        it = hosts_.emplace(host, st).first;
+    }
+    return it->second;
+}
+
+bool HostGovernor::tryTake(HostState& st, const Clock::time_point now, Clock::time_point& wakeAt)
+{
+    wakeAt = Clock::time_point::max();
+
+    if (now < st.blockedUntil)
+    {
+        wakeAt = st.blockedUntil;
+        return false;
+    }
+
+    const int maxConn = cfg_.maxConnectionsPerHost();
+    if (maxConn > 0 && st.inFlight >= maxConn)
+    {
+        return false;   // woken by release()
+    }
+
+    const double rate = cfg_.requestsPerSec() * st.stats.rateFactor;
+    if (rate > 0.0)
+    {
+        const double burst = static_cast<double>(std::max(1, cfg_.burst()));
+        const double elapsed = std::chrono::duration<double>(now - st.lastRefill).count();
+        st.tokens = std::min(burst, st.tokens + elapsed * rate);
+        st.lastRefill = now;
+        if (st.tokens < 1.0)
+        {
+            const auto need = std::chrono::duration<double>((1.0 - st.tokens) / rate);
+            wakeAt = now + std::chrono::duration_cast<Clock::duration>(need);
+            return false;
+        }
+        st.tokens -= 1.0;
+    }
+
+    ++st.inFlight;
+    ++st.stats.requests;
+    return true;
+}
+
+HostPermit HostGovernor::acquire(const std::string& host)
+{
+    std::unique_lock<std::mutex> lock(mu_);
+    HostState& st = stateFor(host);
+
+    const auto start = Clock::now();
+    Clock::time_point wakeAt;
+    bool waited = false;
+    while (!tryTake(st, Clock::now(), wakeAt))
+    {
+        waited = true;
+        if (wakeAt == Clock::time_point::max()) cv_.wait(lock);
+        else cv_.wait_until(lock, wakeAt);
+    }
+
+    if (waited)
+    {
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        ++st.stats.waited;
+        st.stats.totalWaitMs += ms;
+        st.stats.maxWaitMs = std::max(st.stats.maxWaitMs, ms);
+    }
+    return HostPermit(this, host);
+}
+
+HostPermit HostGovernor::tryAcquire(const std::string& host)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    HostState& st = stateFor(host);
+    Clock::time_point wakeAt;
+    if (!tryTake(st, Clock::now(), wakeAt)) return HostPermit();
+    return HostPermit(this, host);
+}
+
+void HostGovernor::release(const std::string& host) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mu_);
+        auto it = hosts_.find(host);
+        if (it != hosts_.end() && it->second.inFlight > 0) --it->second.inFlight;
+    }
+    cv_.notify_all();
+}
+
+void HostGovernor::onResponse(const std::string& host, const long status, const long retryAfterMs)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    HostState& st = stateFor(host);
+
+    if (status == 429 || (status == 503 && retryAfterMs >= 0))
+    {
+        ++st.stats.throttled;
+        // 503은 헤더가 있을 때만 차단 (일시 장애는 HttpClient의 backoff가 처리)
+        const long ms = retryAfterMs >= 0 ? retryAfterMs : cfg_.defaultRetryAfterMs();
+        st.blockedUntil = std::max(st.blockedUntil, Clock::now() + std::chrono::milliseconds(ms));
+        // 처리율 제한에 걸렸으면 요청률을 절반으로 (multiplicative decrease)
+        if (status == 429)
+        {
+            st.stats.rateFactor = std::max(kMinRateFactor, st.stats.rateFactor * 0.5);
+            st.tokens = 0.0;
+        }
+    }
+    else if (status >= 200 && status < 400)
+    {
+        // additive increase
+        st.stats.rateFactor = std::min(1.0, st.stats.rateFactor + kRecoverPerSuccess);
+    }
+}
+
+HostStats HostGovernor::stats(const std::string& host) const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    auto it = hosts_.find(host);
+    if (it == hosts_.end()) return {};
+    HostStats s = it->second.stats;
+    s.inFlight = it->second.inFlight;
+    return s;
+}
+
+std::vector<std::pair<std::string, HostStats>> HostGovernor::snapshot() const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    std::vector<std::pair<std::string, HostStats>> out;
+    out.reserve(hosts_.size());
+    for (const auto& [host, st] : hosts_)
+    {
+        HostStats s = st.stats;
+        s.inFlight = st.inFlight;
+        out.emplace_back(host, s);
+    }
+    return out;
+}
+
+std::string HostGovernor::hostOf(const std::string& url)
+{
+    std::size_t begin = url.find("://");
+    begin = (begin == std::string::npos) ? 0 : begin + 3;
+    std::size_t end = url.find_first_of("/?#", begin);
+    if (end == std::string::npos) end = url.size();
+
+    // userinfo@host
+    const std::size_t at = url.rfind('@', end);
+    if (at != std::string::npos && at >= begin) begin = at + 1;
+
+    std::string host = url.substr(begin, end - begin);
+    for (auto& c : host) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    return host;
+}
+
+long HostGovernor::parseRetryAfterSeconds(const std::string& value) noexcept
+{
+    std::size_t i = 0;
+    while (i < value.size() && (value[i] == ' ' || value[i] == '\t')) ++i;
+    if (i == value.size()) return -1;
+
+    long secs = 0;
+    for (; i < value.size(); ++i)
+    {
+        const char c = value[i];
+        if (c == ' ' || c == '\t' || c == '\r' || c == '\n') break;
+        if (c < '0' || c > '9') return -1;
+        secs = secs * 10 + (c - '0');
+        if (secs > 86400) secs = 86400;   // 하루 이상은 무의미
+    }
+    return secs * 1000;
+}
+
+} // namespace slippygl::net
@@ -0,0 +1,107 @@
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "HttpTypes.hpp"
+
+namespace slippygl::net
+{
+
+// 호스트별 예의(politeness) 설정(GovernorConfig)은 값 타입이라 HttpTypes.hpp에 있다
+
+// 호스트별 대기 지표 (스냅샷)
+struct HostStats
+{
+    std::uint64_t requests = 0;        // permits granted
+    std::uint64_t waited = 0;          // permits that had to wait
+    double totalWaitMs = 0.0;
+    double maxWaitMs = 0.0;
+    std::uint64_t throttled = 0;       // 429 (or 503 + Retry-After) responses seen
+    double rateFactor = 1.0;           // adaptive multiplier on requestsPerSec (AIMD)
+    int inFlight = 0;
+};
+
+class HostGovernor;
+
+// 호스트 슬롯 RAII 핸들. 소멸 시 동시 연결 슬롯을 반납한다.
+class HostPermit
+{
+public:
+    HostPermit() = default;
+    ~HostPermit() { release(); }
+    HostPermit(const HostPermit&) = delete;
+    HostPermit& operator=(const HostPermit&) = delete;
+    HostPermit(HostPermit&& o) noexcept;
+    HostPermit& operator=(HostPermit&& o) noexcept;
+
+    bool valid() const noexcept { return gov_ != nullptr; }
+    const std::string& host() const noexcept { return host_; }
+    void release() noexcept;
+
+private:
+    friend class HostGovernor;
+    HostPermit(HostGovernor* g, std::string host) : gov_(g), host_(std::move(host)) {}
+    HostGovernor* gov_ = nullptr;
+    std::string host_;
+};
+
+// 호스트별 토큰 버킷 + 동시 연결 상한 (thread-safe)
+// - acquire()는 토큰과 연결 슬롯이 생길 때까지, 그리고 429/503 차단 기간이 끝날 때까지 대기
+// - onResponse()가 429/503 + Retry-After로 차단 기간을 설정하고 요청률을 절반으로 낮추며,
+//   성공 응답마다 조금씩 원래 요청률로 회복한다 (AIMD)
+// - 여러 HttpClient가 shared_ptr로 공유할 수 있다
+class HostGovernor
+{
+public:
+    explicit HostGovernor(GovernorConfig cfg = {});
+
+    HostGovernor(const HostGovernor&) = delete;
+    HostGovernor& operator=(const HostGovernor&) = delete;
+
+    const GovernorConfig& config() const noexcept { return cfg_; }
+
+    // 블로킹 획득. 대기 시간은 HostStats에 누적된다.
+    HostPermit acquire(const std::string& host);
+    // 논블로킹 획득. 즉시 불가하면 invalid permit
+    HostPermit tryAcquire(const std::string& host);
+
+    // 응답 피드백. retryAfterMs < 0 이면 헤더 없음
+    void onResponse(const std::string& host, long status, long retryAfterMs);
+
+    HostStats stats(const std::string& host) const;
+    std::vector<std::pair<std::string, HostStats>> snapshot() const;
+
+    // "https://a.tile.example.org:8443/1/2/3.png" -> "a.tile.example.org:8443"
+    static std::string hostOf(const std::string& url);
+    // Retry-After delta-seconds → ms. 숫자가 아니면 -1 (HTTP-date는 호출 측에서 처리)
+    static long parseRetryAfterSeconds(const std::string& value) noexcept;
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    struct HostState
+    {
+        double tokens = 0.0;
+        Clock::time_point lastRefill{};
+        Clock::time_point blockedUntil{};
+        int inFlight = 0;
+        HostStats stats;
+    };
+
+    friend class HostPermit;
+    void release(const std::string& host) noexcept;
+
+    HostState& stateFor(const std::string& host);            // mu_ held
+    bool tryTake(HostState& st, Clock::time_point now, Clock::time_point& wakeAt);  // mu_ held
+
+    GovernorConfig cfg_;
+    mutable std::mutex mu_;
+    std::condition_variable cv_;
+    std::unordered_map<std::string, HostState> hosts_;
+};
+
+} // namespace slippygl::net
@@ -1,9 +1,11 @@
 ﻿#include "HttpClient.hpp"
+#include "../core/Profiler.hpp"
 #include <spdlog/spdlog.h>
 #include <sstream>
 #include <thread>
 #include <chrono>
-#include <cctype>
+#include <ctime>
+#include <algorithm>
 
 namespace slippygl::net 
 {
@@ -11,15 +13,28 @@ namespace slippygl::net
 class HttpClient::Impl 
 {
 public:
-    explicit Impl(NetConfig c) : cfg_(std::move(c)) {}
+    Impl(NetConfig c, std::shared_ptr<HostGovernor> g, std::shared_ptr<CurlShare> sh)
+        : cfg_(std::move(c))
+        , governor_(g ? std::move(g) : std::make_shared<HostGovernor>(cfg_.politeness()))
+        , share_(sh ? std::move(sh) : std::make_shared<CurlShare>())
+        , telemetry_(std::make_shared<NetTelemetry>()) {}
 
     const NetConfig& cfg() const noexcept { return cfg_; }
     void setCfg(const NetConfig& c) noexcept { cfg_ = c; }
+    const std::shared_ptr<HostGovernor>& governor() const noexcept { return governor_; }
+    const std::shared_ptr<CurlShare>& share() const noexcept { return share_; }
+    // 워커 스레드가 읽는 중에도 교체할 수 있도록 atomic shared_ptr 접근만 쓴다
+    std::shared_ptr<NetTelemetry> telemetry() const noexcept { return std::atomic_load(&telemetry_); }
+    void setTelemetry(std::shared_ptr<NetTelemetry> t) {
+        std::atomic_store(&telemetry_, t ? std::move(t) : std::make_shared<NetTelemetry>());
+    }
 
     HttpResponse doGet(const std::string& url,
                        const RequestHeaders* optHeaders,
-                       const Conditional* cond) {
-        CurlEasy easy;              // per request
+                       const Conditional* cond,
+                       BodySink* sink) {
+        EasyLease lease(*this);     // 유휴 easy 핸들 재사용: keep-alive 연결은 핸들의 연결 캐시에 남는다
+        CurlEasy& easy = lease.easy;
         Bytes body;
         ResponseHeaders rhdr;
 
@@ -48,54 +63,62 @@ public:
         curl_easy_setopt(easy, CURLOPT_SSL_VERIFYPEER, cfg_.verifyTLS() ? 1L : 0L);
         curl_easy_setopt(easy, CURLOPT_SSL_VERIFYHOST, cfg_.verifyTLS() ? 2L : 0L);
 
-        // 바디 콜백
+        // 바디 콜백 (sink가 있으면 200 응답 바이트를 도착 즉시 함께 전달)
+        // 전달 여부는 응답마다 첫 바디 조각에서 정한다 (새 상태 줄이 오면 헤더 콜백이 되돌림)
+        struct WriteCtx {
+            Bytes* body;
+            BodySink* sink;
+            CURL* easy;
+            int streaming;          // -1: 미확인, 0: 아님, 1: 전달 중
+        } wctx{ &body, sink, easy.get(), sink ? -1 : 0 };
+        if (sink) sink->onBegin();
+
         curl_easy_setopt(
             easy, CURLOPT_WRITEFUNCTION,
             +[](char* ptr, size_t size, size_t nmemb, void* userdata) -> size_t {
-                auto* out = static_cast<Bytes*>(userdata);
+                auto* ctx = static_cast<WriteCtx*>(userdata);
                 size_t bytes = size * nmemb;
-                out->insert(out->end(),
-                            reinterpret_cast<std::uint8_t*>(ptr),
-                            reinterpret_cast<std::uint8_t*>(ptr) + bytes);
+                const auto* p = reinterpret_cast<const std::uint8_t*>(ptr);
+                ctx->body->insert(ctx->body->end(), p, p + bytes);
+                if (ctx->streaming < 0) {
+                    long code = 0;
+                    curl_easy_getinfo(ctx->easy, CURLINFO_RESPONSE_CODE, &code);
+                    ctx->streaming = (code == 200) ? 1 : 0;
+                }
+                if (ctx->streaming > 0) ctx->sink->onData(p, bytes);
                 return bytes;
             }
         );
-        curl_easy_setopt(easy, CURLOPT_WRITEDATA, &body);
+        curl_easy_setopt(easy, CURLOPT_WRITEDATA, &wctx);
+
+        // 헤더 콜백: string_view 파싱, 사용하는 필드만 할당
+        struct HeaderCtx {
+            ResponseHeaders* headers;
+            bool keepRaw;
+            WriteCtx* write;
+        } hctx{ &rhdr, cfg_.keepRawHeaders(), &wctx };
 
-        // 헤더 콜백
         curl_easy_setopt(
             easy, CURLOPT_HEADERFUNCTION,
             +[](char* buffer, size_t size, size_t nitems, void* userdata) -> size_t {
-                auto* rh = static_cast<ResponseHeaders*>(userdata);
+                auto* ctx = static_cast<HeaderCtx*>(userdata);
                 size_t bytes = size * nitems;
-                std::string line(buffer, buffer + bytes);
-                rh->addRaw(line);
-
-                // 간단 파서: "Key: Value"
-                auto lower = [](std::string s){
-                    for (auto& c : s) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
-                    return s;
-                };
-                auto pos = line.find(':');
-                if (pos != std::string::npos) {
-                    std::string key = lower(line.substr(0, pos));
-                    std::string val = line.substr(pos + 1);
-                    // trim
-                    while (!val.empty() && (val.front()==' '||val.front()=='\t')) val.erase(val.begin());
-                    while (!val.empty() && (val.back()=='\r'||val.back()=='\n'||val.back()==' '||val.back()=='\t')) val.pop_back();
-
-                    if (key == "etag") rh->setEtag(val);
-                    else if (key == "last-modified") rh->setLastModified(val);
-                    else if (key == "content-encoding") rh->setContentEncoding(val);
-                    else if (key == "content-type") rh->setContentType(val);
-                    else if (key == "content-length") {
-                        try { rh->setContentLength(std::stoll(val)); } catch (...) {}
+                const std::string_view line(buffer, bytes);
+                if (line.size() >= 5 && line.compare(0, 5, "HTTP/") == 0) {
+                    // 새 응답 (리다이렉트 다음 hop / 100-continue 뒤의 최종 응답):
+                    // 이전 응답의 바디를 버리고 전달 여부를 다시 정한다
+                    WriteCtx* w = ctx->write;
+                    w->body->clear();
+                    if (w->sink) {
+                        if (w->streaming > 0) w->sink->onBegin();
+                        w->streaming = -1;
                     }
                 }
+                ctx->headers->parseLine(line, ctx->keepRaw);
                 return bytes;
             }
         );
-        curl_easy_setopt(easy, CURLOPT_HEADERDATA, &rhdr);
+        curl_easy_setopt(easy, CURLOPT_HEADERDATA, &hctx);
 
         // 요청 헤더 구성
         struct curl_slist* headers = nullptr;
@@ -113,7 +136,11 @@ public:
         if (headers) curl_easy_setopt(easy, CURLOPT_HTTPHEADER, headers);
 
         // 실행
-        CURLcode rc = curl_easy_perform(easy);
+        CURLcode rc;
+        {
+            SLIPPYGL_ZONE("net.perform");
+            rc = curl_easy_perform(easy);
+        }
         long status = 0;
         char* eff = nullptr;
         curl_easy_getinfo(easy, CURLINFO_RESPONSE_CODE, &status);
@@ -122,6 +149,7 @@ public:
         if (headers) curl_slist_free_all(headers);
 
         HttpResponse resp;
+        resp.setTimings(collectTimings(easy, body.size(), rc == CURLE_OK && status != 0));
         resp.setStatus(rc == CURLE_OK ? status : 0);
         resp.mutableBody() = std::move(body);
         resp.mutableHeaders() = std::move(rhdr);
@@ -133,42 +161,143 @@ public:
         return resp;
     }
 
+    // 단계별 소요 시간/바이트/프로토콜 (libcurl 7.61+의 *_T 마이크로초 API)
+    // completed=false(전송 실패/응답 없음)면 NUM_CONNECTS가 0이어도 재사용으로 세지 않는다
+    static RequestTimings collectTimings(CURL* easy, const std::size_t decodedBytes, const bool completed) {
+        curl_off_t dns = 0, conn = 0, app = 0, start = 0, total = 0, down = 0;
+        long header = 0, version = 0, connects = 0;
+        curl_easy_getinfo(easy, CURLINFO_NAMELOOKUP_TIME_T, &dns);
+        curl_easy_getinfo(easy, CURLINFO_CONNECT_TIME_T, &conn);
+        curl_easy_getinfo(easy, CURLINFO_APPCONNECT_TIME_T, &app);
+        curl_easy_getinfo(easy, CURLINFO_STARTTRANSFER_TIME_T, &start);
+        curl_easy_getinfo(easy, CURLINFO_TOTAL_TIME_T, &total);
+        curl_easy_getinfo(easy, CURLINFO_SIZE_DOWNLOAD_T, &down);
+        curl_easy_getinfo(easy, CURLINFO_HEADER_SIZE, &header);
+        curl_easy_getinfo(easy, CURLINFO_HTTP_VERSION, &version);
+        curl_easy_getinfo(easy, CURLINFO_NUM_CONNECTS, &connects);
+
+        auto ms = [](const curl_off_t us) { return static_cast<double>(us) / 1000.0; };
+        RequestTimings t;
+        t.dnsMs = ms(dns);
+        t.connectMs = ms(std::max<curl_off_t>(0, conn - dns));
+        t.tlsMs = app > 0 ? ms(std::max<curl_off_t>(0, app - conn)) : 0.0;
+        t.ttfbMs = ms(start);
+        t.totalMs = ms(total);
+        t.wireBytes = static_cast<long long>(header) + static_cast<long long>(down);
+        t.decodedBytes = static_cast<long long>(decodedBytes);
+        switch (version) {
+        case CURL_HTTP_VERSION_1_0: t.httpVersion = 10; break;
+        case CURL_HTTP_VERSION_1_1: t.httpVersion = 11; break;
+        case CURL_HTTP_VERSION_2_0: t.httpVersion = 20; break;
+#if LIBCURL_VERSION_NUM >= 0x074200
+        case CURL_HTTP_VERSION_3:   t.httpVersion = 30; break;
+#endif
+        default: break;
+        }
+        t.connectionReused = completed && connects == 0;
+        return t;
+    }
+
+    // 요청 하나 동안 빌려 쓰는 easy 핸들. 반납할 때 풀로 돌아가 연결 캐시를 유지한다
+    struct EasyLease {
+        Impl& owner;
+        CurlEasy easy;
+        explicit EasyLease(Impl& o) : owner(o), easy(o.takeIdle()) {
+            curl_easy_reset(easy);  // 옵션만 초기화 (연결 캐시, DNS/세션 캐시는 유지)
+            owner.share_->attach(easy);
+        }
+        ~EasyLease() {
+            std::lock_guard<std::mutex> lock(owner.idleMu_);
+            owner.idle_.push_back(std::move(easy));
+        }
+        EasyLease(const EasyLease&) = delete;
+        EasyLease& operator=(const EasyLease&) = delete;
+    };
+
+    CurlEasy takeIdle() {
+        std::lock_guard<std::mutex> lock(idleMu_);
+        if (idle_.empty()) return CurlEasy{};
+        CurlEasy e = std::move(idle_.back());
+        idle_.pop_back();
+        return e;
+    }
+
     static void sleepMs(const int ms) noexcept {
         std::this_thread::sleep_for(std::chrono::milliseconds(ms));
     }
 
+    // Retry-After: delta-seconds 또는 HTTP-date. 없거나 해석 불가면 -1
+    static long retryAfterMs(const ResponseHeaders& h) {
+        if (!h.retryAfter().has_value()) return -1;
+        const std::string& v = *h.retryAfter();
+        long ms = HostGovernor::parseRetryAfterSeconds(v);
+        if (ms >= 0) return ms;
+        const time_t at = curl_getdate(v.c_str(), nullptr);
+        if (at < 0) return -1;
+        const double secs = std::difftime(at, std::time(nullptr));
+        return secs > 0.0 ? static_cast<long>(secs * 1000.0) : 0;
+    }
+
 private:
     NetConfig  cfg_;
+    std::shared_ptr<HostGovernor> governor_;
+    std::shared_ptr<CurlShare> share_;  // CurlGlobal 참조를 함께 보유
+    std::shared_ptr<NetTelemetry> telemetry_;
+    std::mutex idleMu_;
+    std::vector<CurlEasy> idle_;        // 동시 요청 수만큼만 쌓인다
     CurlGlobal global_; // RAII: 프로세스 전역 초기화
 };
 
 // ==== HttpClient public API ====
 
-HttpClient::HttpClient(NetConfig cfg)
-: impl_(std::make_unique<Impl>(std::move(cfg))) {}
+HttpClient::HttpClient(NetConfig cfg, std::shared_ptr<HostGovernor> governor, std::shared_ptr<CurlShare> share)
+: impl_(std::make_unique<Impl>(std::move(cfg), std::move(governor), std::move(share))) {}
 
 HttpClient::~HttpClient() = default;
 
 const NetConfig& HttpClient::config() const noexcept { return impl_->cfg(); }
 void HttpClient::setConfig(const NetConfig& cfg) noexcept { impl_->setCfg(cfg); }
+const std::shared_ptr<HostGovernor>& HttpClient::governor() const noexcept { return impl_->governor(); }
+const std::shared_ptr<CurlShare>& HttpClient::share() const noexcept { return impl_->share(); }
+std::shared_ptr<NetTelemetry> HttpClient::telemetry() const noexcept { return impl_->telemetry(); }
+void HttpClient::setTelemetry(std::shared_ptr<NetTelemetry> t) { impl_->setTelemetry(std::move(t)); }
 
 HttpResponse HttpClient::get(const std::string& url,
                              const RequestHeaders* optHeaders,
-                             const Conditional* cond)
+                             const Conditional* cond,
+                             BodySink* sink)
 {
     const auto& cfg = impl_->cfg();
     const int attempts = cfg.maxRetries() + 1;
+    HostGovernor& gov = *impl_->governor();
+    const std::string host = HostGovernor::hostOf(url);
 
     for (int i = 0; i < attempts; ++i) {
-        auto resp = impl_->doGet(url, optHeaders, cond);
+        HttpResponse resp;
+        {
+            // 토큰 + 호스트 연결 슬롯 확보 (429/503 차단 기간이면 여기서 대기)
+            HostPermit permit = [&] {
+                SLIPPYGL_ZONE("net.throttle");
+                return gov.acquire(host);
+            }();
+            resp = impl_->doGet(url, optHeaders, cond, sink);
+        }
+        const long status = resp.status();
+        impl_->telemetry()->record(resp.timings(), status);
+        const long retryAfter = (status == 429 || status == 503) ? Impl::retryAfterMs(resp.headers()) : -1;
+        gov.onResponse(host, status, retryAfter);
 
-        // 재시도 조건: 네트워크 에러(status=0) 또는 5xx
-        if ((resp.status() == 0) || ((resp.status() >= 500) && (resp.status() < 600))) {
-            if (i < attempts - 1) 
+        // 재시도 조건: 네트워크 에러(status=0), 429 또는 5xx
+        if ((status == 0) || (status == 429) || ((status >= 500) && (status < 600))) {
+            // 서버가 요청한 대기가 전체 타임아웃보다 길면 포기하고 그대로 반환
+            if (i < attempts - 1 && retryAfter <= cfg.totalTimeoutMs())
             {
-                const int32_t backoff = (i == 0) ? cfg.retryBackoffMs0() : cfg.retryBackoffMs1();
-                spdlog::warn("GET retry {}/{} (status={}) {}", i+1, attempts-1, resp.status(), url);
-                Impl::sleepMs(backoff);
+                spdlog::warn("GET retry {}/{} (status={}) {}", i+1, attempts-1, status, url);
+                // 429/Retry-After는 governor가 다음 acquire에서 기다리게 한다
+                if (status != 429 && retryAfter < 0) {
+                    const int32_t backoff = (i == 0) ? cfg.retryBackoffMs0() : cfg.retryBackoffMs1();
+                    Impl::sleepMs(backoff);
+                }
                 continue;
             }
         }
@@ -1,6 +1,8 @@
 ﻿#pragma once
 #include "HttpTypes.hpp"
 #include "CurlHandle.hpp"
+#include "HostGovernor.hpp"
+#include "NetTelemetry.hpp"
 #include <memory>
 
 namespace slippygl::net 
@@ -9,15 +11,33 @@ namespace slippygl::net
 class HttpClient 
 {
 public:
-    explicit HttpClient(NetConfig cfg = {});
+    // governor가 null이면 cfg.politeness()로 전용 governor를 만든다.
+    // 같은 호스트를 치는 클라이언트끼리는 하나를 공유해야 호스트 상한이 의미가 있다.
+    // share가 null이면 전용 CurlShare를 만든다 (DNS 캐시/TLS 세션).
+    // 포그라운드 로더와 프리페처처럼 여러 클라이언트가 하나를 공유하면 TLS 재개를 함께 쓴다.
+    // 연결 자체는 클라이언트가 재사용하는 easy 핸들에 남는다 (CurlShare 주석 참고).
+    explicit HttpClient(NetConfig cfg = {},
+                        std::shared_ptr<HostGovernor> governor = nullptr,
+                        std::shared_ptr<CurlShare> share = nullptr);
     ~HttpClient();
 
     const NetConfig& config() const noexcept;
     void setConfig(const NetConfig& cfg) noexcept;
 
+    // 호스트별 대기 지표 조회용
+    const std::shared_ptr<HostGovernor>& governor() const noexcept;
+    const std::shared_ptr<CurlShare>& share() const noexcept;
+
+    // 요청별 계측 집계 (기본: 클라이언트 전용). 여러 클라이언트가 하나에 모을 수 있다.
+    // 요청이 진행 중일 때 바꿔도 된다 (atomic 교체, 진행 중인 요청은 이전 집계에 기록).
+    std::shared_ptr<NetTelemetry> telemetry() const noexcept;
+    void setTelemetry(std::shared_ptr<NetTelemetry> t);
+
+    // sink가 있으면 200 응답 바디를 수신 중에 전달 (응답 body()에도 그대로 남음)
     HttpResponse get(const std::string& url,
                      const RequestHeaders* optHeaders = nullptr,
-                     const Conditional*    cond = nullptr);
+                     const Conditional*    cond = nullptr,
+                     BodySink*             sink = nullptr);
 
 private:
     class Impl;                    // PIMPL로 libcurl 의존 숨김
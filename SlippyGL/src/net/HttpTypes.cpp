@@ -1,4 +1,5 @@
 ﻿#include "HttpTypes.hpp"
+#include <charconv>
 
 namespace slippygl::net 
 {
@@ -15,4 +16,78 @@ RequestHeaders& RequestHeaders::addRaw(const std::string& line)
     return *this;
 }
 
+bool iequals(std::string_view a, std::string_view b) noexcept
+{
+    if (a.size() != b.size()) return false;
+    for (std::size_t i = 0; i < a.size(); ++i)
+    {
+        char ca = a[i], cb = b[i];
+        if (ca >= 'A' && ca <= 'Z') ca = static_cast<char>(ca - 'A' + 'a');
+        if (cb >= 'A' && cb <= 'Z') cb = static_cast<char>(cb - 'A' + 'a');
+        if (ca != cb) return false;
+    }
+    return true;
+}
+
+void ResponseHeaders::parseLine(std::string_view line, const bool keepRaw)
+{
+    // 새 응답 시작 (리다이렉트/100-continue): 이전 응답의 원본 줄도 폐기
+    const bool statusLine = line.size() >= 5 && line.compare(0, 5, "HTTP/") == 0;
+    if (statusLine) raw_.clear();
+    if (keepRaw) raw_.emplace_back(line);
+
+    // trim trailing CR/LF/공백
+    while (!line.empty() && (line.back() == '\r' || line.back() == '\n' || line.back() == ' ' || line.back() == '\t'))
+        line.remove_suffix(1);
+    if (line.empty()) return;
+
+    if (statusLine)
+    {
+        // 이전 응답의 필드 폐기
+        etag_.reset();
+        lastModified_.reset();
+        contentEncoding_.reset();
+        contentType_.reset();
+        contentLength_.reset();
+        retryAfter_.reset();
+        return;
+    }
+
+    const std::size_t colon = line.find(':');
+    if (colon == std::string_view::npos) return;
+
+    const std::string_view key = line.substr(0, colon);
+    std::string_view val = line.substr(colon + 1);
+    while (!val.empty() && (val.front() == ' ' || val.front() == '\t')) val.remove_prefix(1);
+
+    switch (key.size())
+    {
+    case 4:
+        if (iequals(key, "etag")) etag_.emplace(val);
+        break;
+    case 11:
+        if (iequals(key, "retry-after")) retryAfter_.emplace(val);
+        break;
+    case 12:
+        if (iequals(key, "content-type")) contentType_.emplace(val);
+        break;
+    case 13:
+        if (iequals(key, "last-modified")) lastModified_.emplace(val);
+        break;
+    case 14:
+        if (iequals(key, "content-length"))
+        {
+            long long n = 0;
+            const auto r = std::from_chars(val.data(), val.data() + val.size(), n);
+            if (r.ec == std::errc() && n >= 0) contentLength_ = n;
+        }
+        break;
+    case 16:
+        if (iequals(key, "content-encoding")) contentEncoding_.emplace(val);
+        break;
+    default:
+        break;
+    }
+}
+
 } // namespace slippygl::net
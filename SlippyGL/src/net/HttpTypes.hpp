@@ -1,5 +1,6 @@
 ﻿#pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
 #include <cstdint>
@@ -8,6 +9,29 @@ namespace slippygl::net {
 
 using Bytes = std::vector<std::uint8_t>;
 
+// ASCII 대소문자 무시 비교 (복사/할당 없음)
+bool iequals(std::string_view a, std::string_view b) noexcept;
+
+// 호스트별 예의(politeness) 설정
+class GovernorConfig
+{
+public:
+    double requestsPerSec() const noexcept { return requestsPerSec_; }
+    int    burst() const noexcept { return burst_; }
+    int    maxConnectionsPerHost() const noexcept { return maxConnectionsPerHost_; }
+    int    defaultRetryAfterMs() const noexcept { return defaultRetryAfterMs_; }
+    // fluent setters
+    GovernorConfig& setRequestsPerSec(const double v) noexcept { requestsPerSec_ = v; return *this; }
+    GovernorConfig& setBurst(const int v) noexcept { burst_ = v; return *this; }
+    GovernorConfig& setMaxConnectionsPerHost(const int v) noexcept { maxConnectionsPerHost_ = v; return *this; }
+    GovernorConfig& setDefaultRetryAfterMs(const int v) noexcept { defaultRetryAfterMs_ = v; return *this; }
+private:
+    double requestsPerSec_      = 0.0;   // 0 = no rate limit (connection cap still applies)
+    int    burst_               = 8;     // token bucket capacity
+    int    maxConnectionsPerHost_ = 2;   // OSM 타일 정책: 호스트당 동시 연결 2개 이하
+    int    defaultRetryAfterMs_ = 1000;  // 429에 Retry-After가 없을 때
+};
+
 class NetConfig {
 public:
     // getters
@@ -20,6 +44,8 @@ public:
     int  maxRetries()       const noexcept { return maxRetries_; }
     int  retryBackoffMs0()  const noexcept { return retryBackoffMs0_; }
     int  retryBackoffMs1()  const noexcept { return retryBackoffMs1_; }
+    const GovernorConfig& politeness() const noexcept { return politeness_; }
+    bool keepRawHeaders()   const noexcept { return keepRawHeaders_; }
     // fluent setters
     NetConfig& setUserAgent(std::string v) noexcept { userAgent_=std::move(v); return *this; }
     NetConfig& setConnectTimeoutMs(const long v) noexcept { connectTimeoutMs_=v; return *this; }
@@ -30,6 +56,8 @@ public:
     NetConfig& setMaxRetries(const int v) noexcept { maxRetries_=v; return *this; }
     NetConfig& setRetryBackoffMs0(const int v) noexcept { retryBackoffMs0_=v; return *this; }
     NetConfig& setRetryBackoffMs1(const int v) noexcept { retryBackoffMs1_=v; return *this; }
+    NetConfig& setPoliteness(const GovernorConfig& v) noexcept { politeness_=v; return *this; }
+    NetConfig& setKeepRawHeaders(const bool v) noexcept { keepRawHeaders_=v; return *this; }
 private:
     std::string userAgent_ = "SlippyGL/0.1 (+contact@example.com)";
     long connectTimeoutMs_ = 5000;
@@ -40,6 +68,8 @@ private:
     int  maxRetries_       = 2;
     int  retryBackoffMs0_  = 200;
     int  retryBackoffMs1_  = 500;
+    GovernorConfig politeness_;   // 호스트별 요청률/동시 연결 상한
+    bool keepRawHeaders_   = false; // 디버깅용: 모든 헤더 줄을 ResponseHeaders::raw()에 보관
 };
 
 class RequestHeaders {
@@ -72,6 +102,7 @@ public:
     const std::optional<std::string>& contentEncoding() const noexcept { return contentEncoding_; }
     const std::optional<std::string>& contentType() const noexcept { return contentType_; }
     const std::optional<long long>&   contentLength() const noexcept { return contentLength_; }
+    const std::optional<std::string>& retryAfter() const noexcept { return retryAfter_; }
     const std::vector<std::string>&   raw() const noexcept { return raw_; }
     // setters
     void setEtag(std::optional<std::string> v) noexcept { etag_=std::move(v); }
@@ -79,29 +110,61 @@ public:
     void setContentEncoding(std::optional<std::string> v) noexcept { contentEncoding_=std::move(v); }
     void setContentType(std::optional<std::string> v) noexcept { contentType_=std::move(v); }
     void setContentLength(const std::optional<long long> v) noexcept { contentLength_=v; }
+    void setRetryAfter(std::optional<std::string> v) noexcept { retryAfter_=std::move(v); }
     void addRaw(std::string line) { raw_.push_back(std::move(line)); }
+
+    // 헤더 한 줄 파싱 ("Key: Value\r\n"). 키는 복사 없이 비교하고,
+    // 사용하는 필드만 문자열로 만든다. 상태 줄("HTTP/...")은 이전 응답(리다이렉트)의 필드와 원본 줄을 비운다.
+    void parseLine(std::string_view line, bool keepRaw = false);
 private:
-    std::optional<std::string> etag_, lastModified_, contentEncoding_, contentType_;
+    std::optional<std::string> etag_, lastModified_, contentEncoding_, contentType_, retryAfter_;
     std::optional<long long> contentLength_;
     std::vector<std::string> raw_;
 };
 
+// 요청 1건의 네트워크 계측 (curl_easy_getinfo)
+// 시간은 ms, 각 단계 소요 시간(누적 아님). ttfb/total은 요청 시작부터.
+struct RequestTimings {
+    double dnsMs = 0.0;
+    double connectMs = 0.0;     // TCP
+    double tlsMs = 0.0;         // TLS handshake (평문/재사용이면 0)
+    double ttfbMs = 0.0;        // first byte
+    double totalMs = 0.0;
+    long long wireBytes = 0;    // 헤더 + 전송 바디(압축 상태)
+    long long decodedBytes = 0; // 콜백으로 받은 바디 (압축 해제 후)
+    int httpVersion = 0;        // 10, 11, 20, 30 (0 = 알 수 없음)
+    bool connectionReused = false;
+};
+
+// 응답 바디 스트리밍 수신자
+// HttpClient는 바디를 그대로 버퍼링하면서 200 응답의 바이트를 도착 즉시 함께 넘긴다.
+// (예: 다운로드와 PNG 디코딩을 겹치기)
+class BodySink {
+public:
+    virtual ~BodySink() = default;
+    virtual void onBegin() {}   // 매 시도 시작 시 (재시도면 이전 상태를 버릴 것)
+    virtual void onData(const std::uint8_t* data, std::size_t size) = 0;
+};
+
 class HttpResponse {
 public:
     long status() const noexcept { return status_; }
     const Bytes& body() const noexcept { return body_; }
     const ResponseHeaders& headers() const noexcept { return headers_; }
     const std::string& effectiveUrl() const noexcept { return effectiveUrl_; }
+    const RequestTimings& timings() const noexcept { return timings_; }
     // internal setters
     void setStatus(const long s) noexcept { status_ = s; }
     Bytes& mutableBody() noexcept { return body_; }
     ResponseHeaders& mutableHeaders() noexcept { return headers_; }
     void setEffectiveUrl(std::string v) noexcept { effectiveUrl_ = std::move(v); }
+    void setTimings(const RequestTimings& t) noexcept { timings_ = t; }
 private:
     long status_ = 0;
     Bytes body_;
     ResponseHeaders headers_;
     std::string effectiveUrl_;
+    RequestTimings timings_;
 };
 
 } // namespace slippygl::net
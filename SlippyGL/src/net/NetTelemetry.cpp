@@ -0,0 +1,155 @@
+#include "NetTelemetry.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+namespace slippygl::net
+{
+
+// ==== RollingHistogram ====
+
+void RollingHistogram::add(const double v)
+{
+    if (samples_.size() < window_)
+    {
+        samples_.push_back(v);
+    }
+    else
+    {
+        samples_[next_] = v;
+        next_ = (next_ + 1) % window_;
+    }
+    ++total_;
+}
+
+double RollingHistogram::percentile(const double p) const
+{
+    if (samples_.empty()) return 0.0;
+    std::vector<double> sorted(samples_);
+    const double rank = std::clamp(p, 0.0, 100.0) / 100.0 * static_cast<double>(sorted.size() - 1);
+    const std::size_t k = static_cast<std::size_t>(std::llround(rank));
+    std::nth_element(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(k), sorted.end());
+    return sorted[k];
+}
+
+double RollingHistogram::mean() const
+{
+    if (samples_.empty()) return 0.0;
+    double sum = 0.0;
+    for (const double v : samples_) sum += v;
+    return sum / static_cast<double>(samples_.size());
+}
+
+double RollingHistogram::max() const
+{
+    return samples_.empty() ? 0.0 : *std::max_element(samples_.begin(), samples_.end());
+}
+
+std::array<std::uint32_t, RollingHistogram::kBuckets> RollingHistogram::buckets() const
+{
+    std::array<std::uint32_t, kBuckets> out{};
+    for (const double v : samples_)
+    {
+        std::size_t b = 0;
+        if (v >= 1.0) b = std::min<std::size_t>(kBuckets - 1, 1 + static_cast<std::size_t>(std::log2(v)));
+        ++out[b];
+    }
+    return out;
+}
+
+// ==== NetTelemetry ====
+
+NetTelemetry::NetTelemetry(const std::size_t window)
+    : dns_(window), connect_(window), tls_(window), ttfb_(window), total_(window)
+{
+}
+
+void NetTelemetry::record(const RequestTimings& t, const long status)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    ++counters_.requests;
+    if (status == 0 || status == 429 || status >= 500) ++counters_.failures;
+    if (t.connectionReused) ++counters_.reusedConnections;
+    counters_.wireBytes += t.wireBytes;
+    counters_.decodedBytes += t.decodedBytes;
+    if (t.httpVersion >= 30) ++counters_.http3;
+    else if (t.httpVersion >= 20) ++counters_.http2;
+    else if (t.httpVersion > 0) ++counters_.http1;
+
+    // 재사용 연결은 DNS/연결/TLS가 0이라 분포를 흐리므로 새 연결만 기록
+    if (!t.connectionReused && status != 0)
+    {
+        dns_.add(t.dnsMs);
+        connect_.add(t.connectMs);
+        tls_.add(t.tlsMs);
+    }
+    if (status != 0) ttfb_.add(t.ttfbMs);
+    total_.add(t.totalMs);
+}
+
+void NetTelemetry::reset()
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    dns_.clear();
+    connect_.clear();
+    tls_.clear();
+    ttfb_.clear();
+    total_.clear();
+    counters_ = Summary{};
+}
+
+NetTelemetry::Summary NetTelemetry::summary() const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    Summary s = counters_;
+    s.ttfbP50 = ttfb_.percentile(50.0);
+    s.ttfbP99 = ttfb_.percentile(99.0);
+    s.totalP50 = total_.percentile(50.0);
+    s.totalP99 = total_.percentile(99.0);
+    return s;
+}
+
+std::string NetTelemetry::toJson() const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    std::string out;
+    char buf[256];
+
+    std::snprintf(buf, sizeof(buf),
+                  "{\"requests\":%llu,\"failures\":%llu,\"reused_connections\":%llu,"
+                  "\"wire_bytes\":%lld,\"decoded_bytes\":%lld,"
+                  "\"http_versions\":{\"1.x\":%llu,\"2\":%llu,\"3\":%llu},\"phases_ms\":{",
+                  static_cast<unsigned long long>(counters_.requests),
+                  static_cast<unsigned long long>(counters_.failures),
+                  static_cast<unsigned long long>(counters_.reusedConnections),
+                  counters_.wireBytes, counters_.decodedBytes,
+                  static_cast<unsigned long long>(counters_.http1),
+                  static_cast<unsigned long long>(counters_.http2),
+                  static_cast<unsigned long long>(counters_.http3));
+    out += buf;
+
+    const std::pair<const char*, const RollingHistogram*> phases[] = {
+        { "dns", &dns_ }, { "connect", &connect_ }, { "tls", &tls_ }, { "ttfb", &ttfb_ }, { "total", &total_ }
+    };
+    bool first = true;
+    for (const auto& [name, h] : phases)
+    {
+        std::snprintf(buf, sizeof(buf),
+                      "%s\"%s\":{\"n\":%zu,\"mean\":%.3f,\"p50\":%.3f,\"p90\":%.3f,\"p99\":%.3f,\"max\":%.3f,\"log2_buckets\":[",
+                      first ? "" : ",", name, h->size(), h->mean(),
+                      h->percentile(50.0), h->percentile(90.0), h->percentile(99.0), h->max());
+        out += buf;
+        const auto b = h->buckets();
+        for (std::size_t i = 0; i < b.size(); ++i)
+        {
+            out += (i ? "," : "") + std::to_string(b[i]);
+        }
+        out += "]}";
+        first = false;
+    }
+    out += "}}";
+    return out;
+}
+
+} // namespace slippygl::net
@@ -0,0 +1,71 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "HttpTypes.hpp"
+
+namespace slippygl::net
+{
+
+// 최근 N개 샘플의 롤링 히스토그램 (링 버퍼, 조회 시 정렬)
+class RollingHistogram
+{
+public:
+    explicit RollingHistogram(std::size_t window = 1024) : window_(window ? window : 1) {}
+
+    void add(double v);
+    void clear() noexcept { samples_.clear(); next_ = 0; total_ = 0; }
+
+    std::size_t size() const noexcept { return samples_.size(); }   // samples in window
+    std::uint64_t total() const noexcept { return total_; }         // samples ever added
+    double percentile(double p) const;                              // 0..100, 0 if empty
+    double mean() const;
+    double max() const;
+
+    // log2 버킷 카운트: [0,1), [1,2), [2,4) ... 마지막 버킷은 나머지 전부
+    static constexpr std::size_t kBuckets = 16;
+    std::array<std::uint32_t, kBuckets> buckets() const;
+
+private:
+    std::size_t window_;
+    std::vector<double> samples_;
+    std::size_t next_ = 0;
+    std::uint64_t total_ = 0;
+};
+
+// 요청 단위 계측 집계 (thread-safe). 여러 HttpClient가 공유 가능.
+// 느린 타일이 DNS/연결/TLS(클라이언트 측), TTFB(CDN/서버), 전송(대역폭) 중
+// 어디서 오는지 구분하기 위한 용도.
+class NetTelemetry
+{
+public:
+    explicit NetTelemetry(std::size_t window = 1024);
+
+    void record(const RequestTimings& t, long status);
+    void reset();
+
+    struct Summary
+    {
+        std::uint64_t requests = 0;
+        std::uint64_t failures = 0;          // status 0 / 5xx / 429
+        std::uint64_t reusedConnections = 0;
+        long long wireBytes = 0;
+        long long decodedBytes = 0;
+        std::uint64_t http1 = 0, http2 = 0, http3 = 0;
+        double ttfbP50 = 0.0, ttfbP99 = 0.0;
+        double totalP50 = 0.0, totalP99 = 0.0;
+    };
+    Summary summary() const;
+
+    // 히스토그램 전체를 JSON 문자열로
+    std::string toJson() const;
+
+private:
+    mutable std::mutex mu_;
+    RollingHistogram dns_, connect_, tls_, ttfb_, total_;
+    Summary counters_;
+};
+
+} // namespace slippygl::net
@@ -1,20 +1,238 @@
 ﻿#include "TileEndpoint.hpp"
+#include <algorithm>
+#include <cmath>
 
 namespace slippygl::net 
 {
 
 using slippygl::core::TileID;
 
-std::string TileEndpoint::rasterUrl(const TileID& id) const noexcept
+namespace
 {
-    // e.g., https://tile.openstreetmap.org/z/x/y.png
-    return baseUrl_ + "/" + std::to_string(id.z()) + "/" + std::to_string(id.x()) + "/" + std::to_string(id.y()) + ".png";
+    constexpr double kEwmaAlpha = 0.2;
+    constexpr double kMinWeight = 0.01;         // 실패 중인 호스트도 가끔은 시도해 회복을 감지
+
+    // 가중치는 몇 단계로만 나뉜다: 건강한 호스트끼리의 지연 흔들림으로는 타일이 옮겨가지 않는다
+    double latencyLevel(const double latencyMs, const double medianMs) noexcept
+    {
+        if (medianMs <= 0.0 || latencyMs <= 2.0 * medianMs) return 1.0;
+        if (latencyMs <= 4.0 * medianMs) return 0.5;
+        return 0.25;
+    }
+
+    double failureLevel(const double failureRate) noexcept
+    {
+        if (failureRate < 0.25) return 1.0;    // 드문 실패 한두 번은 무시
+        if (failureRate < 0.5) return 0.5;
+        if (failureRate < 0.8) return 0.1;
+        return kMinWeight;
+    }
+
+    std::uint64_t mix64(std::uint64_t v) noexcept
+    {
+        // splitmix64 finalizer
+        v += 0x9E3779B97F4A7C15ull;
+        v = (v ^ (v >> 30)) * 0xBF58476D1CE4E5B9ull;
+        v = (v ^ (v >> 27)) * 0x94D049BB133111EBull;
+        return v ^ (v >> 31);
+    }
+
+    bool hasPlaceholders(const std::string& s)
+    {
+        return s.find("{z}") != std::string::npos;
+    }
+}
+
+TileEndpoint::TileEndpoint(std::string base)
+    : state_(1)
+{
+    applyBaseUrl(std::move(base));
+}
+
+std::string TileEndpoint::baseUrl() const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    return baseUrl_;
+}
+
+std::string TileEndpoint::urlTemplate() const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    return rasterTemplate_;
+}
+
+std::size_t TileEndpoint::hostCount() const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    return hostCountLocked();
+}
+
+TileEndpoint& TileEndpoint::setBaseUrl(std::string v)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    applyBaseUrl(std::move(v));
+    return *this;
+}
+
+void TileEndpoint::applyBaseUrl(std::string v)
+{
+    baseUrl_ = std::move(v);
+    if (hasPlaceholders(baseUrl_))
+    {
+        rasterTemplate_ = baseUrl_;
+        mvtTemplate_.clear();
+    }
+    else
+    {
+        // e.g., https://tile.openstreetmap.org/z/x/y.png
+        rasterTemplate_ = baseUrl_ + "/{z}/{x}/{y}.png";
+        // 일반적으로 .pbf 확장자를 많이 사용 (서버마다 다름)
+        mvtTemplate_ = baseUrl_ + "/{z}/{x}/{y}.pbf";
+    }
+}
+
+TileEndpoint& TileEndpoint::setUrlTemplate(std::string tmpl)
+{
+    return setBaseUrl(std::move(tmpl));
+}
+
+TileEndpoint& TileEndpoint::setHosts(std::vector<std::string> hosts)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    hosts_ = std::move(hosts);
+    state_.assign(hostCountLocked(), HostState{});
+    refreshWeights();
+    return *this;
+}
+
+std::string TileEndpoint::expand(const std::string& tmpl, const std::string& s, const TileID& id)
+{
+    std::string out;
+    out.reserve(tmpl.size() + s.size() + 16);
+    for (std::size_t i = 0; i < tmpl.size(); ++i)
+    {
+        if (tmpl[i] == '{' && i + 2 < tmpl.size() && tmpl[i + 2] == '}')
+        {
+            switch (tmpl[i + 1])
+            {
+            case 's': out += s; i += 2; continue;
+            case 'z': out += std::to_string(id.z()); i += 2; continue;
+            case 'x': out += std::to_string(id.x()); i += 2; continue;
+            case 'y': out += std::to_string(id.y()); i += 2; continue;
+            default: break;
+            }
+        }
+        out += tmpl[i];
+    }
+    return out;
+}
+
+void TileEndpoint::refreshWeights()
+{
+    // 기준 지연: 샘플이 있는 호스트들의 (아래쪽) 중앙값. 느린 소수가 기준을 끌어올리지 않는다
+    std::vector<double> sampled;
+    sampled.reserve(state_.size());
+    for (const HostState& h : state_)
+    {
+        if (h.requests) sampled.push_back(h.latencyMs);
+    }
+    double medianMs = 0.0;
+    if (!sampled.empty())
+    {
+        const auto mid = sampled.begin() + static_cast<std::ptrdiff_t>((sampled.size() - 1) / 2);
+        std::nth_element(sampled.begin(), mid, sampled.end());
+        medianMs = *mid;
+    }
+
+    for (HostState& h : state_)
+    {
+        const double lat = h.requests ? latencyLevel(h.latencyMs, medianMs) : 1.0;
+        h.weight = std::max(kMinWeight, lat * failureLevel(h.failureRate));
+    }
+}
+
+int TileEndpoint::pickHost(const TileID& id) const
+{
+    const std::size_t n = hostCountLocked();
+    if (n <= 1) return 0;
+
+    // Weighted rendezvous hashing: score = -w / ln(u), u = hash(tile, host) in (0,1).
+    // 가중치가 같으면 타일은 항상 같은 호스트로, 한 호스트의 가중치가 내려가면
+    // 그 호스트의 타일 일부만 다른 호스트로 옮겨간다.
+    const std::uint64_t tileKey = (static_cast<std::uint64_t>(id.z()) << 58)
+                                ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(id.x())) << 29)
+                                ^ static_cast<std::uint64_t>(static_cast<std::uint32_t>(id.y()));
+    int best = 0;
+    double bestScore = -1.0;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        const std::uint64_t h = mix64(tileKey ^ mix64(i + 1));
+        const double u = (static_cast<double>(h >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+        const double score = -state_[i].weight / std::log(u);
+        if (score > bestScore)
+        {
+            bestScore = score;
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+TileEndpoint::Target TileEndpoint::resolveRaster(const TileID& id) const
+{
+    Target t;
+    std::lock_guard<std::mutex> lock(mu_);
+    t.host = pickHost(id);
+    t.url = expand(rasterTemplate_, hosts_.empty() ? std::string() : hosts_[t.host], id);
+    return t;
+}
+
+std::string TileEndpoint::rasterUrl(const TileID& id) const
+{
+    return resolveRaster(id).url;
+}
+
+std::string TileEndpoint::mvtUrl(const TileID& id) const
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    const std::string s = hosts_.empty() ? std::string() : hosts_[pickHost(id)];
+    if (!mvtTemplate_.empty()) return expand(mvtTemplate_, s, id);
+
+    // 래스터 템플릿만 있으면 확장자만 교체
+    std::string url = expand(rasterTemplate_, s, id);
+    const std::size_t dot = url.rfind(".png");
+    if (dot != std::string::npos) url.replace(dot, 4, ".pbf");
+    return url;
+}
+
+void TileEndpoint::report(const int host, const double latencyMs, const bool ok)
+{
+    std::lock_guard<std::mutex> lock(mu_);
+    if (host < 0 || static_cast<std::size_t>(host) >= state_.size()) return;
+
+    HostState& h = state_[host];
+    h.latencyMs = h.requests ? h.latencyMs + kEwmaAlpha * (latencyMs - h.latencyMs) : latencyMs;
+    h.failureRate += kEwmaAlpha * ((ok ? 0.0 : 1.0) - h.failureRate);
+    ++h.requests;
+    refreshWeights();
 }
 
-std::string TileEndpoint::mvtUrl(const TileID& id) const noexcept
+std::vector<HostHealth> TileEndpoint::health() const
 {
-    // 일반적으로 .pbf 확장자를 많이 사용 (서버마다 다름)
-    return baseUrl_ + "/" + std::to_string(id.z()) + "/" + std::to_string(id.x()) + "/" + std::to_string(id.y()) + ".pbf";
+    std::lock_guard<std::mutex> lock(mu_);
+    std::vector<HostHealth> out;
+    out.reserve(state_.size());
+    for (std::size_t i = 0; i < state_.size(); ++i)
+    {
+        HostHealth h;
+        h.host = hosts_.empty() ? baseUrl_ : hosts_[i];
+        h.latencyMs = state_[i].latencyMs;
+        h.failureRate = state_[i].failureRate;
+        h.requests = state_[i].requests;
+        h.weight = state_[i].weight;
+        out.push_back(std::move(h));
+    }
+    return out;
 }
 
-} // namespace slippygl::net
\ No newline at end of file
+} // namespace slippygl::net
@@ -1,24 +1,91 @@
 ﻿#pragma once
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <vector>
 #include "../core/Types.hpp"  // TileID
 
 namespace slippygl::net 
 {
 
+// 미러/서브도메인별 건강 상태 (EWMA)
+struct HostHealth
+{
+    std::string host;
+    double latencyMs = 0.0;     // EWMA of transfer time (0 = no sample yet), see report()
+    double failureRate = 0.0;   // EWMA of failures (0..1)
+    std::uint64_t requests = 0;
+    double weight = 1.0;        // current selection weight (discrete levels)
+};
+
+// 타일 URL 템플릿 + 호스트 샤딩
+// - 템플릿 치환자: {s} (호스트 목록 항목), {z}, {x}, {y}
+//   예) "https://{s}.tile.openstreetmap.org/{z}/{x}/{y}.png" + hosts {"a","b","c"}
+//       "{s}/{z}/{x}/{y}.png" + hosts {"https://mirror1", "https://mirror2"}
+// - 호스트 선택은 타일별 결정적(weighted rendezvous hashing)이라 같은 타일은 같은 호스트로 간다.
+//   건강한 호스트는 모두 같은 가중치다. 지연이 중앙값의 2배를 넘거나 실패율이 높아지면
+//   가중치가 몇 단계(1, 0.5, 0.25, ... 0.01)로만 내려가, 건강 상태가 실제로 바뀔 때만
+//   그 호스트의 타일 일부가 다른 호스트로 옮겨간다 (평소 지연 흔들림으로는 움직이지 않음).
+// - 모든 public 멤버는 thread-safe (다운로더 스레드가 URL을 만드는 중에 엔드포인트를 바꿔도 된다)
 class TileEndpoint 
 {
 public:
-    explicit TileEndpoint(std::string base = "https://tile.openstreetmap.org")
-        : baseUrl_(std::move(base)) {}
+    // 치환자가 없는 base URL이면 "{base}/{z}/{x}/{y}.png" 템플릿으로 취급
+    explicit TileEndpoint(std::string base = "https://tile.openstreetmap.org");
+
+    TileEndpoint(const TileEndpoint&) = delete;
+    TileEndpoint& operator=(const TileEndpoint&) = delete;
+
+    std::string baseUrl() const;
+    TileEndpoint& setBaseUrl(std::string v);
+
+    std::string urlTemplate() const;
+    TileEndpoint& setUrlTemplate(std::string tmpl);
+    TileEndpoint& setHosts(std::vector<std::string> hosts);
+    std::size_t hostCount() const;
 
-    const std::string& baseUrl() const noexcept { return baseUrl_; }
-    TileEndpoint& setBaseUrl(std::string v) noexcept { baseUrl_ = std::move(v); return *this; }
+    // 선택된 호스트와 URL
+    struct Target
+    {
+        std::string url;
+        int host = 0;           // index for report()
+    };
+    Target resolveRaster(const slippygl::core::TileID& id) const;
 
-    std::string rasterUrl(const slippygl::core::TileID& id) const noexcept; // z/x/y.png
-    std::string mvtUrl(const slippygl::core::TileID& id) const noexcept;    // z/x/y.mvt or .pbf (미래)
+    std::string rasterUrl(const slippygl::core::TileID& id) const; // z/x/y.png
+    std::string mvtUrl(const slippygl::core::TileID& id) const;    // z/x/y.mvt or .pbf (미래)
+
+    // 요청 결과 피드백. ok=false는 네트워크 오류/5xx/429
+    // latencyMs는 미러 자체의 전송 시간(마지막 시도의 libcurl total time)이어야 한다.
+    // HostGovernor 대기나 재시도 백오프를 넣으면 요청률 제한이 미러가 느린 것처럼 보인다.
+    void report(int host, double latencyMs, bool ok);
+
+    std::vector<HostHealth> health() const;
+
+    // 템플릿 치환 (테스트/도구용)
+    static std::string expand(const std::string& tmpl, const std::string& s, const slippygl::core::TileID& id);
 
 private:
+    struct HostState
+    {
+        double latencyMs = 0.0;
+        double failureRate = 0.0;
+        std::uint64_t requests = 0;
+        double weight = 1.0;
+    };
+
+    void applyBaseUrl(std::string v);                        // mu_ held (or constructing)
+    std::size_t hostCountLocked() const noexcept { return hosts_.empty() ? 1 : hosts_.size(); }
+    int pickHost(const slippygl::core::TileID& id) const;   // mu_ held
+    void refreshWeights();                                   // mu_ held
+
     std::string baseUrl_;
+    std::string rasterTemplate_;
+    std::string mvtTemplate_;
+    std::vector<std::string> hosts_;
+
+    mutable std::mutex mu_;
+    std::vector<HostState> state_;
 };
 
 } // namespace slippygl::net
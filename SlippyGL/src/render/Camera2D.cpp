@@ -10,8 +10,8 @@ void Camera2D::pan(float dx, float dy) noexcept
 {
     // Screen drag translates to world movement (inverse of scale)
     // Moving mouse right (dx > 0) should move the world left (origin increases)
-    worldOriginX_ -= dx / scale_;
-    worldOriginY_ -= dy / scale_;
+    worldOriginX_ -= static_cast<double>(dx) / scale_;
+    worldOriginY_ -= static_cast<double>(dy) / scale_;
 }
 
 void Camera2D::zoomAt(float cx, float cy, float zoomDelta, int fbW, int fbH) noexcept
@@ -20,7 +20,7 @@ void Camera2D::zoomAt(float cx, float cy, float zoomDelta, int fbW, int fbH) noe
     (void)fbH;
 
     // Get world point under cursor before zoom
-    const glm::vec2 worldBefore = screenToWorld(cx, cy);
+    const glm::dvec2 worldBefore = screenToWorld(cx, cy);
 
     // Apply zoom
     const float factor = 1.0f + kZoomSpeed * zoomDelta;
@@ -30,7 +30,7 @@ void Camera2D::zoomAt(float cx, float cy, float zoomDelta, int fbW, int fbH) noe
     scale_ = std::clamp(scale_, kMinScale, kMaxScale);
 
     // Get world point under cursor after zoom
-    const glm::vec2 worldAfter = screenToWorld(cx, cy);
+    const glm::dvec2 worldAfter = screenToWorld(cx, cy);
 
     // Adjust origin so the same world point stays under cursor
     worldOriginX_ += (worldBefore.x - worldAfter.x);
@@ -39,12 +39,12 @@ void Camera2D::zoomAt(float cx, float cy, float zoomDelta, int fbW, int fbH) noe
 
 void Camera2D::reset() noexcept
 {
-    worldOriginX_ = 0.0f;
-    worldOriginY_ = 0.0f;
+    worldOriginX_ = 0.0;
+    worldOriginY_ = 0.0;
     scale_ = 1.0f;
 }
 
-void Camera2D::applyZoomStep(float factor) noexcept
+void Camera2D::applyZoomStep(double factor) noexcept
 {
     // worldOrigin *= factor, scale /= factor preserves the on-screen mapping:
     //   screen = (world - origin) * scale
@@ -53,26 +53,26 @@ void Camera2D::applyZoomStep(float factor) noexcept
     //           = (world - origin) * scale = screen   (unchanged)
     worldOriginX_ *= factor;
     worldOriginY_ *= factor;
-    scale_ /= factor;
+    scale_ = static_cast<float>(scale_ / factor);
 }
 
-glm::vec2 Camera2D::screenToWorld(float sx, float sy) const noexcept
+glm::dvec2 Camera2D::screenToWorld(float sx, float sy) const noexcept
 {
     // Screen coordinate to world coordinate
     // screen(0,0) -> world(worldOriginX_, worldOriginY_)
     // screen(sx, sy) -> world(worldOriginX_ + sx/scale_, worldOriginY_ + sy/scale_)
-    return glm::vec2(
-        worldOriginX_ + sx / scale_,
-        worldOriginY_ + sy / scale_
+    return glm::dvec2(
+        worldOriginX_ + static_cast<double>(sx) / scale_,
+        worldOriginY_ + static_cast<double>(sy) / scale_
     );
 }
 
-glm::vec2 Camera2D::worldToScreen(float wx, float wy) const noexcept
+glm::vec2 Camera2D::worldToScreen(double wx, double wy) const noexcept
 {
-    // Inverse of screenToWorld
+    // Inverse of screenToWorld (difference taken in double, result is screen-sized)
     return glm::vec2(
-        (wx - worldOriginX_) * scale_,
-        (wy - worldOriginY_) * scale_
+        static_cast<float>((wx - worldOriginX_) * scale_),
+        static_cast<float>((wy - worldOriginY_) * scale_)
     );
 }
 
@@ -91,25 +91,29 @@ glm::mat4 Camera2D::ortho(int fbW, int fbH) const noexcept
 
 glm::mat4 Camera2D::viewMatrix() const noexcept
 {
-    // View matrix: world to screen transformation
-    // 1. Translate by -worldOrigin (move world so origin is at camera position)
-    // 2. Scale by scale_ (zoom)
+    // View matrix: anchor-relative world to screen transformation
+    // Vertices arrive as P_rel = P_world - anchor (anchor = floor(worldOrigin)),
+    // so only the sub-pixel remainder f = worldOrigin - anchor is left here:
     //
-    // For a point P_world:
     // P_screen = scale_ * (P_world - worldOrigin)
-    //          = scale_ * P_world - scale_ * worldOrigin
+    //          = scale_ * (P_rel - f)
     //
     // As a matrix:
-    // [scale_  0      0   -scale_*worldOriginX_]
-    // [0       scale_ 0   -scale_*worldOriginY_]
-    // [0       0      1   0                    ]
-    // [0       0      0   1                    ]
+    // [scale_  0      0   -scale_*fx]
+    // [0       scale_ 0   -scale_*fy]
+    // [0       0      1   0         ]
+    // [0       0      0   1         ]
+    //
+    // Both P_rel and f are small, so float keeps sub-pixel accuracy at any zoom.
+    const glm::dvec2 anchor = renderAnchor();
+    const float fx = static_cast<float>(worldOriginX_ - anchor.x);
+    const float fy = static_cast<float>(worldOriginY_ - anchor.y);
 
     glm::mat4 view(1.0f);
     
     // First translate, then scale (applied in reverse order in matrix form)
     view = glm::scale(view, glm::vec3(scale_, scale_, 1.0f));
-    view = glm::translate(view, glm::vec3(-worldOriginX_, -worldOriginY_, 0.0f));
+    view = glm::translate(view, glm::vec3(-fx, -fy, 0.0f));
     
     return view;
 }
@@ -2,6 +2,7 @@
 
 #include <glm/glm.hpp>
 #include <algorithm>
+#include <cmath>
 
 namespace slippygl::render
 {
@@ -10,6 +11,9 @@ namespace slippygl::render
      * - Y-down coordinate system (consistent with screen coordinates)
      * - Supports pan (drag) and zoom (scroll wheel)
      * - Cursor-centered zoom for intuitive navigation
+     * - World origin kept in double precision: at z22 the world is 2^30 px
+     *   wide, far beyond float's 24-bit mantissa. Geometry is sent to the GPU
+     *   relative to renderAnchor(), so only small offsets are ever floats.
      */
     class Camera2D
     {
@@ -54,7 +58,7 @@ namespace slippygl::render
          * not jump) while making tile world positions consistent with the new
          * zoom level.
          */
-        void applyZoomStep(float factor) noexcept;
+        void applyZoomStep(double factor) noexcept;
 
         /**
          * Get current scale
@@ -64,7 +68,17 @@ namespace slippygl::render
         /**
          * Get world origin (top-left world pixel visible at screen origin)
          */
-        glm::vec2 worldOrigin() const noexcept { return glm::vec2(worldOriginX_, worldOriginY_); }
+        glm::dvec2 worldOrigin() const noexcept { return glm::dvec2(worldOriginX_, worldOriginY_); }
+
+        /**
+         * Integer world pixel near the origin that render geometry is relative to.
+         * Vertices passed with mvp() must be (world - renderAnchor()); being whole
+         * pixels, tile corners stay exact integers after the subtraction.
+         */
+        glm::dvec2 renderAnchor() const noexcept
+        {
+            return glm::dvec2(std::floor(worldOriginX_), std::floor(worldOriginY_));
+        }
 
         /**
          * Convert screen coordinates to world coordinates
@@ -72,7 +86,7 @@ namespace slippygl::render
          * @param sy Screen Y
          * @return World coordinates
          */
-        glm::vec2 screenToWorld(float sx, float sy) const noexcept;
+        glm::dvec2 screenToWorld(float sx, float sy) const noexcept;
 
         /**
          * Convert world coordinates to screen coordinates
@@ -80,7 +94,7 @@ namespace slippygl::render
          * @param wy World Y
          * @return Screen coordinates
          */
-        glm::vec2 worldToScreen(float wx, float wy) const noexcept;
+        glm::vec2 worldToScreen(double wx, double wy) const noexcept;
 
         /**
          * Get orthographic projection matrix (screen space, Y-down)
@@ -89,13 +103,13 @@ namespace slippygl::render
         glm::mat4 ortho(int fbW, int fbH) const noexcept;
 
         /**
-         * Get view matrix (world to screen transformation)
-         * Applies scale and translation
+         * Get view matrix (anchor-relative world to screen transformation)
+         * Applies scale and the sub-pixel translation origin - renderAnchor()
          */
         glm::mat4 viewMatrix() const noexcept;
 
         /**
-         * Get combined Model-View-Projection matrix
+         * Get combined Model-View-Projection matrix for anchor-relative vertices
          * MVP = ortho * view
          */
         glm::mat4 mvp(int fbW, int fbH) const noexcept;
@@ -104,12 +118,21 @@ namespace slippygl::render
          * Set world origin (for initial positioning)
          * @param origin World coordinates to show at screen top-left
          */
-        void setWorldOrigin(const glm::vec2& origin) noexcept
+        void setWorldOrigin(const glm::dvec2& origin) noexcept
         {
             worldOriginX_ = origin.x;
             worldOriginY_ = origin.y;
         }
 
+        /**
+         * Set scale directly (scripted camera paths), clamped to [kMinScale, kMaxScale]
+         * @param scale Pixels per world unit
+         */
+        void setScale(float scale) noexcept
+        {
+            scale_ = std::clamp(scale, kMinScale, kMaxScale);
+        }
+
         // Configuration
         static constexpr float kMinScale = 0.25f;
         static constexpr float kMaxScale = 8.0f;
@@ -117,8 +140,8 @@ namespace slippygl::render
 
     private:
         // World origin: top-left world pixel offset (screen (0,0) maps to this world point)
-        float worldOriginX_ = 0.0f;
-        float worldOriginY_ = 0.0f;
+        double worldOriginX_ = 0.0;
+        double worldOriginY_ = 0.0;
 
         // Scale: pixels per world unit (1.0 = 1:1, 2.0 = zoomed in 2x)
         float scale_ = 1.0f;
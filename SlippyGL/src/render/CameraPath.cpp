@@ -0,0 +1,202 @@
+#include "CameraPath.hpp"
+#include "Camera2D.hpp"
+#include "../core/TileMath.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+
+namespace slippygl::render
+{
+
+namespace
+{
+    constexpr double kPi = 3.14159265358979323846;
+
+    // 터무니없는 스크립트로 메모리를 다 쓰지 않도록 프레임 수 상한
+    constexpr long kMaxFrames = 1'000'000;
+
+    constexpr const char* kBuiltinScript =
+        "# Seoul City Hall, z12\n"
+        "start 126.9780 37.5665 12\n"
+        "hold 30\n"
+        "pan 8 0 120\n"
+        "pan 0 6 60\n"
+        "zoom 3 30        # zoom-in burst\n"
+        "hold 30\n"
+        "zoom -5 30       # fast zoom-out\n"
+        "pan -12 -4 90\n"
+        "flyto 129.0756 35.1796 13 180   # Busan\n"
+        "hold 30\n"
+        "zoom 2 20\n"
+        "zoom -2 20\n"
+        "flyto 126.9780 37.5665 12 180\n";
+
+    double clampZoom(const double z)
+    {
+        return std::clamp(z, CameraPath::kMinZoom, CameraPath::kMaxZoom);
+    }
+
+    // 정규화 좌표: x는 날짜변경선에서 감싸고 y는 메르카토르 한계에서 자른다
+    void normalize(CameraPose& p)
+    {
+        p.x -= std::floor(p.x);
+        p.y = std::clamp(p.y, 0.0, 1.0);
+        p.zoom = clampZoom(p.zoom);
+    }
+
+    double smoothstep(const double t)
+    {
+        return t * t * (3.0 - 2.0 * t);
+    }
+}
+
+CameraPose CameraPath::fromLonLat(const double lonDeg, const double latDeg, const double zoom) noexcept
+{
+    const double world = static_cast<double>(core::TileMath::worldSizePx(0));
+    CameraPose p;
+    p.x = core::TileMath::lonToXpx(lonDeg, 0) / world;
+    p.y = core::TileMath::latToYpx(latDeg, 0) / world;
+    p.zoom = clampZoom(zoom);
+    return p;
+}
+
+bool CameraPath::parse(const std::string& text, CameraPath& out, std::string* err)
+{
+    std::vector<CameraPose> poses;
+    CameraPose cur;
+    bool started = false;
+
+    std::istringstream lines(text);
+    std::string line;
+    int lineNo = 0;
+    const auto fail = [&](const std::string& msg) {
+        if (err) *err = "line " + std::to_string(lineNo) + ": " + msg;
+        return false;
+    };
+
+    while (std::getline(lines, line))
+    {
+        ++lineNo;
+        const auto hash = line.find('#');
+        if (hash != std::string::npos) line.erase(hash);
+
+        std::istringstream in(line);
+        std::string cmd;
+        if (!(in >> cmd)) continue;   // blank / comment-only
+
+        double a = 0.0, b = 0.0, c = 0.0;
+        long frames = 0;
+        if (cmd == "start")
+        {
+            if (!(in >> a >> b >> c)) return fail("expected: start <lon> <lat> <zoom>");
+            if (started) return fail("'start' must appear once, before other commands");
+            cur = fromLonLat(a, b, c);
+            started = true;
+            continue;
+        }
+        if (!started) return fail("path must begin with 'start'");
+
+        if (cmd == "hold") { if (!(in >> frames)) return fail("expected: hold <frames>"); }
+        else if (cmd == "pan") { if (!(in >> a >> b >> frames)) return fail("expected: pan <dx> <dy> <frames>"); }
+        else if (cmd == "zoom") { if (!(in >> a >> frames)) return fail("expected: zoom <dz> <frames>"); }
+        else if (cmd == "flyto") { if (!(in >> a >> b >> c >> frames)) return fail("expected: flyto <lon> <lat> <zoom> <frames>"); }
+        else return fail("unknown command '" + cmd + "'");
+
+        if (frames <= 0) return fail("frame count must be positive");
+        if (static_cast<long>(poses.size()) + frames > kMaxFrames) return fail("path too long");
+
+        if (cmd == "hold")
+        {
+            poses.insert(poses.end(), static_cast<std::size_t>(frames), cur);
+        }
+        else if (cmd == "pan")
+        {
+            for (long i = 0; i < frames; ++i)
+            {
+                const double pxToNorm = 1.0 / (core::WebMercator::kTileSize * std::exp2(cur.zoom));
+                cur.x += a * pxToNorm;
+                cur.y += b * pxToNorm;
+                normalize(cur);
+                poses.push_back(cur);
+            }
+        }
+        else if (cmd == "zoom")
+        {
+            const double z0 = cur.zoom;
+            for (long i = 1; i <= frames; ++i)
+            {
+                cur.zoom = clampZoom(z0 + a * static_cast<double>(i) / static_cast<double>(frames));
+                poses.push_back(cur);
+            }
+        }
+        else // flyto
+        {
+            const CameraPose from = cur;
+            const CameraPose to = fromLonLat(a, b, c);
+
+            // 먼 이동은 중간에 줌 아웃했다가 들어간다 (화면 폭 대비 거리의 log2, 최대 4단계)
+            const double dist = std::hypot(to.x - from.x, to.y - from.y);
+            const double distPx = dist * core::WebMercator::kTileSize * std::exp2(std::min(from.zoom, to.zoom));
+            const double arc = std::clamp(std::log2(std::max(distPx / 512.0, 1.0)), 0.0, 4.0);
+
+            for (long i = 1; i <= frames; ++i)
+            {
+                const double s = smoothstep(static_cast<double>(i) / static_cast<double>(frames));
+                cur.x = from.x + (to.x - from.x) * s;
+                cur.y = from.y + (to.y - from.y) * s;
+                cur.zoom = from.zoom + (to.zoom - from.zoom) * s - arc * std::sin(kPi * s);
+                normalize(cur);
+                poses.push_back(cur);
+            }
+        }
+    }
+
+    if (!started) return fail("empty path");
+    if (poses.empty()) poses.push_back(cur);   // 'start' only: a single static frame
+
+    out.poses_ = std::move(poses);
+    return true;
+}
+
+bool CameraPath::load(const std::string& path, CameraPath& out, std::string* err)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        if (err) *err = "Cannot open camera path: " + path;
+        return false;
+    }
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    if (!parse(ss.str(), out, err))
+    {
+        if (err) *err = path + ": " + *err;
+        return false;
+    }
+    return true;
+}
+
+CameraPath CameraPath::builtin()
+{
+    CameraPath path;
+    parse(kBuiltinScript, path);
+    return path;
+}
+
+void CameraPath::apply(const CameraPose& pose, Camera2D& camera, int& tileZoom, const int fbW, const int fbH) noexcept
+{
+    // 가장 가까운 정수 줌을 고르면 잔여 배율이 [0.71, 1.41]이라
+    // 앱 루프의 줌 단계 전환(ZoomBlend, 2^±0.6 임계치)이 다시 일어나지 않는다
+    tileZoom = static_cast<int>(std::lround(clampZoom(pose.zoom)));
+    const double scale = std::exp2(pose.zoom - tileZoom);
+    const double world = static_cast<double>(core::TileMath::worldSizePx(tileZoom));
+
+    camera.setScale(static_cast<float>(scale));
+    camera.setWorldOrigin(glm::dvec2(
+        pose.x * world - 0.5 * fbW / scale,
+        pose.y * world - 0.5 * fbH / scale));
+}
+
+} // namespace slippygl::render
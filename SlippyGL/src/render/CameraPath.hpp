@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace slippygl::render
+{
+    class Camera2D;
+
+    /**
+     * One camera state of a scripted path.
+     * x, y are normalized Web Mercator coordinates ([0,1), y-down) so a pose
+     * is independent of the tile zoom level; zoom is fractional.
+     */
+    struct CameraPose
+    {
+        double x = 0.0;
+        double y = 0.0;
+        double zoom = 0.0;
+    };
+
+    /**
+     * Deterministic, frame-indexed camera path for replay benchmarks.
+     *
+     * Script format (one command per line, '#' starts a comment):
+     *   start <lon> <lat> <zoom>              initial pose (required, first)
+     *   hold  <frames>                        keep the pose
+     *   pan   <dx> <dy> <frames>              move dx/dy screen px per frame (+x east, +y south)
+     *   zoom  <dz> <frames>                   change zoom by dz over frames (linear)
+     *   flyto <lon> <lat> <zoom> <frames>     eased move with a zoom-out arc for long hops
+     *
+     * The script is expanded to one pose per frame at load time, so replay is
+     * independent of frame rate and of anything the renderer does.
+     */
+    class CameraPath
+    {
+    public:
+        static constexpr double kMinZoom = 0.0;
+        static constexpr double kMaxZoom = 22.0;
+
+        /**
+         * Parse a path script
+         * @param text Script text
+         * @param out Expanded path (unchanged on failure)
+         * @param err Error message with line number (optional)
+         * @return false on syntax error or empty path
+         */
+        static bool parse(const std::string& text, CameraPath& out, std::string* err = nullptr);
+
+        /**
+         * Read and parse a script file
+         */
+        static bool load(const std::string& path, CameraPath& out, std::string* err = nullptr);
+
+        /**
+         * Built-in scenario around Seoul: slow pan, zoom bursts in/out,
+         * fly-to Busan and back.
+         */
+        static CameraPath builtin();
+
+        /**
+         * Number of frames in one pass of the path
+         */
+        std::size_t frameCount() const noexcept { return poses_.size(); }
+
+        /**
+         * Pose for a frame; wraps around so any frame count can be replayed
+         */
+        const CameraPose& pose(std::size_t frame) const noexcept { return poses_[frame % poses_.size()]; }
+
+        /**
+         * Place the camera at a pose: picks the tile zoom nearest to pose.zoom,
+         * sets the residual scale and centers the pose in the framebuffer.
+         * @param tileZoom In/out tile zoom level of the app loop
+         */
+        static void apply(const CameraPose& pose, Camera2D& camera, int& tileZoom, int fbW, int fbH) noexcept;
+
+        /**
+         * Normalized Web Mercator coordinates of a lon/lat
+         */
+        static CameraPose fromLonLat(double lonDeg, double latDeg, double zoom) noexcept;
+
+    private:
+        std::vector<CameraPose> poses_;
+    };
+
+} // namespace slippygl::render
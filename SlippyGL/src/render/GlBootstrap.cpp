@@ -8,6 +8,13 @@
 namespace slippygl::render
 {
 
+namespace
+{
+    // 창이 가려졌다 다시 보이는 등 OS가 내용을 버렸을 때 GLFW가 알려준다.
+    // 창은 하나뿐이라 전역 플래그로 충분하다 (user pointer는 InputHandler가 쓴다).
+    bool refreshRequested = false;
+}
+
 GlBootstrap::~GlBootstrap()
 {
     shutdown();
@@ -28,6 +35,7 @@ bool GlBootstrap::init(const WindowConfig& cfg)
 #ifdef __APPLE__
     glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
 #endif
+    glfwWindowHint(GLFW_VISIBLE, cfg.visible ? GLFW_TRUE : GLFW_FALSE);
 
     // Create window
     window_ = glfwCreateWindow(cfg.width, cfg.height, cfg.title, nullptr, nullptr);
@@ -38,6 +46,7 @@ bool GlBootstrap::init(const WindowConfig& cfg)
     }
 
     glfwMakeContextCurrent(window_);
+    glfwSetWindowRefreshCallback(window_, [](GLFWwindow*) { refreshRequested = true; });
 
     // Load GLAD
     if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(glfwGetProcAddress))) {
@@ -79,7 +88,24 @@ bool GlBootstrap::shouldClose() const
 void GlBootstrap::poll()
 {
     glfwPollEvents();
+    afterEvents();
+}
+
+void GlBootstrap::waitEvents(double timeoutSec)
+{
+    glfwWaitEventsTimeout(timeoutSec);
+    afterEvents();
+}
+
+bool GlBootstrap::consumeRefresh()
+{
+    const bool r = refreshRequested;
+    refreshRequested = false;
+    return r;
+}
 
+void GlBootstrap::afterEvents()
+{
     // Exit on ESC key
     if (window_ && glfwGetKey(window_, GLFW_KEY_ESCAPE) == GLFW_PRESS) {
         glfwSetWindowShouldClose(window_, GLFW_TRUE);
@@ -110,4 +136,11 @@ void GlBootstrap::endFrame()
     }
 }
 
+void GlBootstrap::setVSync(bool on)
+{
+    if (window_) {
+        glfwSwapInterval(on ? 1 : 0);
+    }
+}
+
 } // namespace slippygl::render
\ No newline at end of file
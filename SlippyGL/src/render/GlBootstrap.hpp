@@ -11,6 +11,7 @@ namespace slippygl::render
 		int width = 800;
 		int height = 600; 
 		const char* title = "SlippyGL"; 
+		bool visible = true;             // false: 숨김 창 (GL 컨텍스트만 필요한 벤치마크 등)
 	};
 
 	/**
@@ -31,8 +32,11 @@ namespace slippygl::render
 		void shutdown();                        // 리소스 정리
 		bool shouldClose() const;               // 창 닫기 요청
 		void poll();                            // 입력/이벤트
+		void waitEvents(double timeoutSec);     // 이벤트가 오거나 timeout까지 블록 (유휴 시 CPU 0%)
+		bool consumeRefresh();                  // 창이 다시 노출되어 다시 그려야 하면 true (한 번)
 		void beginFrame(float r = 0.1f, float g = 0.1f, float b = 0.1f);  // glClear
 		void endFrame();                        // glfwSwapBuffers
+		void setVSync(bool on);                 // glfwSwapInterval(1/0), 기본 on
 		
 		// 뷰포트 크기 조회
 		int width() const noexcept { return width_; }
@@ -41,6 +45,8 @@ namespace slippygl::render
 		GLFWwindow* window() const noexcept { return window_; }
 
 	private:
+		void afterEvents();                     // ESC 종료, 리사이즈 반영
+
 		GLFWwindow* window_ = nullptr;
 		int width_ = 0;
 		int height_ = 0;
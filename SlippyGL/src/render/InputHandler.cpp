@@ -50,6 +50,9 @@ void InputHandler::attach(GLFWwindow* window, Camera2D* camera)
 
 void InputHandler::detach()
 {
+    stopRecording();
+    playing_ = false;
+
     if (window_) {
         // Clear callbacks
         glfwSetMouseButtonCallback(window_, nullptr);
@@ -60,14 +63,89 @@ void InputHandler::detach()
         
         window_ = nullptr;
         camera_ = nullptr;
-        isDragging_ = false;
-        panVelX_ = 0.0f;
-        panVelY_ = 0.0f;
+        resetInteraction();
 
         spdlog::debug("InputHandler detached");
     }
 }
 
+void InputHandler::resetInteraction()
+{
+    isDragging_ = false;
+    panVelX_ = 0.0f;
+    panVelY_ = 0.0f;
+    keysDown_.reset();
+}
+
+bool InputHandler::startRecording(const std::string& path, std::string* err)
+{
+    if (!window_) {
+        if (err) *err = "InputHandler not attached";
+        return false;
+    }
+    stopRecording();
+
+    int fbW = 0, fbH = 0;
+    glfwGetFramebufferSize(window_, &fbW, &fbH);
+    auto writer = std::make_unique<InputLogWriter>();
+    if (!writer->open(path, fbW, fbH, err)) return false;
+    recorder_ = std::move(writer);
+    recordStart_ = glfwGetTime();
+    recordFbW_ = fbW;
+    recordFbH_ = fbH;
+
+    // Start from a known cursor position and no held keys/buttons
+    resetInteraction();
+    InputEvent cursor;
+    cursor.type = InputEvent::Type::kCursor;
+    cursor.x = static_cast<float>(lastMouseX_);
+    cursor.y = static_cast<float>(lastMouseY_);
+    recorder_->add(cursor);
+
+    spdlog::info("Recording input to {}", path);
+    return true;
+}
+
+void InputHandler::stopRecording()
+{
+    if (!recorder_) return;
+    std::string err;
+    const std::size_t frames = recorder_->frames();
+    if (recorder_->close(&err)) {
+        spdlog::info("Input recording stopped ({} frames)", frames);
+    } else {
+        spdlog::warn("Input recording: {}", err);
+    }
+    recorder_.reset();
+}
+
+bool InputHandler::startPlayback(const std::string& path, std::string* err)
+{
+    if (!window_) {
+        if (err) *err = "InputHandler not attached";
+        return false;
+    }
+    InputLog log;
+    if (!InputLog::load(path, log, err)) return false;
+
+    int fbW = 0, fbH = 0;
+    glfwGetFramebufferSize(window_, &fbW, &fbH);
+    if (fbW != log.fbW || fbH != log.fbH) {
+        spdlog::info("Input log was recorded at {}x{}, window is {}x{}; resizing",
+                     log.fbW, log.fbH, fbW, fbH);
+        onResize(log.fbW, log.fbH);
+    }
+
+    playback_ = std::move(log);
+    playPos_ = 0;
+    playFrames_ = 0;
+    playTotal_ = playback_.frameCount();
+    playing_ = true;
+    resetInteraction();
+    spdlog::info("Replaying input from {} ({} frames)", path, playTotal_);
+    return true;
+}
+
 void InputHandler::update()
 {
     if (!window_ || !camera_) return;
@@ -79,9 +157,47 @@ void InputHandler::update()
     if (dt < 0.0f) dt = 0.0f;
     if (dt > 0.1f) dt = 0.1f;  // cap at 100ms
 
+    if (playing_) {
+        // Events recorded during this frame's poll(), then the frame's dt
+        const auto& events = playback_.events;
+        while (playPos_ < events.size() && events[playPos_].type != InputEvent::Type::kFrame) {
+            handleEvent(events[playPos_++]);
+        }
+        if (playPos_ < events.size()) {
+            dt = events[playPos_++].x;
+            ++playFrames_;
+        } else {
+            // Log exhausted: hand control back to live input
+            playing_ = false;
+            resetInteraction();
+            glfwGetCursorPos(window_, &lastMouseX_, &lastMouseY_);
+            spdlog::info("Input playback finished after {} frames", playFrames_);
+        }
+    } else if (recorder_) {
+        // Framebuffer size changes go in ahead of the frame that first sees them
+        int fbW = 0, fbH = 0;
+        glfwGetFramebufferSize(window_, &fbW, &fbH);
+        if (fbW != recordFbW_ || fbH != recordFbH_) {
+            recordFbW_ = fbW;
+            recordFbH_ = fbH;
+            InputEvent resize;
+            resize.type = InputEvent::Type::kResize;
+            resize.timeUs = static_cast<std::uint64_t>((now - recordStart_) * 1e6);
+            resize.code = fbW;
+            resize.action = fbH;
+            recorder_->add(resize);
+        }
+
+        InputEvent frame;
+        frame.type = InputEvent::Type::kFrame;
+        frame.timeUs = static_cast<std::uint64_t>((now - recordStart_) * 1e6);
+        frame.x = dt;
+        recorder_->add(frame);
+    }
+
     // Target pan direction from key state.
     // W/Up = north (up), S/Down = south, A/Left = west, D/Right = east.
-    auto down = [&](int key) { return glfwGetKey(window_, key) == GLFW_PRESS; };
+    auto down = [&](int key) { return keysDown_.test(static_cast<std::size_t>(key)); };
     float tx = 0.0f, ty = 0.0f;
     if (down(GLFW_KEY_W) || down(GLFW_KEY_UP))    ty += 1.0f;
     if (down(GLFW_KEY_S) || down(GLFW_KEY_DOWN))  ty -= 1.0f;
@@ -118,38 +234,84 @@ void InputHandler::update()
     }
 }
 
+void InputHandler::resetFrameClock()
+{
+    lastUpdateTime_ = glfwGetTime();
+}
+
 InputHandler* InputHandler::getHandler(GLFWwindow* window)
 {
     return static_cast<InputHandler*>(glfwGetWindowUserPointer(window));
 }
 
+void InputHandler::liveEvent(InputEvent e)
+{
+    if (playing_) return;   // the log drives the camera
+    if (recorder_) {
+        e.timeUs = static_cast<std::uint64_t>((glfwGetTime() - recordStart_) * 1e6);
+        recorder_->add(e);
+    }
+    handleEvent(e);
+}
+
+void InputHandler::handleEvent(const InputEvent& e)
+{
+    switch (e.type) {
+    case InputEvent::Type::kCursor:      onCursorPos(e.x, e.y); break;
+    case InputEvent::Type::kMouseButton: onMouseButton(e.code, e.action, e.mods); break;
+    case InputEvent::Type::kScroll:      onScroll(e.x, e.y); break;
+    case InputEvent::Type::kKey:         onKey(e.code, 0, e.action, e.mods); break;
+    case InputEvent::Type::kResize:      onResize(e.code, e.action); break;
+    case InputEvent::Type::kFrame:       break;
+    }
+}
+
 // Static callback implementations
+// Values go through float so live input matches what the log can replay.
 void InputHandler::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods)
 {
     if (auto* handler = getHandler(window)) {
-        handler->onMouseButton(button, action, mods);
+        InputEvent e;
+        e.type = InputEvent::Type::kMouseButton;
+        e.code = button;
+        e.action = action;
+        e.mods = mods;
+        handler->liveEvent(e);
     }
 }
 
 void InputHandler::cursorPosCallback(GLFWwindow* window, double xpos, double ypos)
 {
     if (auto* handler = getHandler(window)) {
-        handler->onCursorPos(xpos, ypos);
+        InputEvent e;
+        e.type = InputEvent::Type::kCursor;
+        e.x = static_cast<float>(xpos);
+        e.y = static_cast<float>(ypos);
+        handler->liveEvent(e);
     }
 }
 
 void InputHandler::scrollCallback(GLFWwindow* window, double xoffset, double yoffset)
 {
-    (void)xoffset; // unused
     if (auto* handler = getHandler(window)) {
-        handler->onScroll(xoffset, yoffset);
+        InputEvent e;
+        e.type = InputEvent::Type::kScroll;
+        e.x = static_cast<float>(xoffset);
+        e.y = static_cast<float>(yoffset);
+        handler->liveEvent(e);
     }
 }
 
 void InputHandler::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
 {
+    (void)scancode; // platform-specific, not recorded
     if (auto* handler = getHandler(window)) {
-        handler->onKey(key, scancode, action, mods);
+        InputEvent e;
+        e.type = InputEvent::Type::kKey;
+        e.code = key;
+        e.action = action;
+        e.mods = mods;
+        handler->liveEvent(e);
     }
 }
 
@@ -160,8 +322,8 @@ void InputHandler::onMouseButton(int button, int action, int mods)
 
     if (button == GLFW_MOUSE_BUTTON_LEFT) {
         if (action == GLFW_PRESS) {
+            // Drag starts at the last cursor event (tracked even when not dragging)
             isDragging_ = true;
-            glfwGetCursorPos(window_, &lastMouseX_, &lastMouseY_);
         } else if (action == GLFW_RELEASE) {
             isDragging_ = false;
         }
@@ -191,9 +353,9 @@ void InputHandler::onScroll(double xoffset, double yoffset)
 
     if (!camera_ || !window_) return;
 
-    // Get cursor position for cursor-centered zoom
-    double cx, cy;
-    glfwGetCursorPos(window_, &cx, &cy);
+    // Cursor position for cursor-centered zoom (from the last cursor event)
+    const double cx = lastMouseX_;
+    const double cy = lastMouseY_;
 
     // Get framebuffer size
     int fbW, fbH;
@@ -213,6 +375,11 @@ void InputHandler::onKey(int key, int scancode, int action, int mods)
     (void)scancode;
     (void)mods;
 
+    // Held-key state for update() panning
+    if (key >= 0 && key < kMaxKeys && action != GLFW_REPEAT) {
+        keysDown_.set(static_cast<std::size_t>(key), action == GLFW_PRESS);
+    }
+
     if (action != GLFW_PRESS) return;
 
     if (key == GLFW_KEY_R && camera_) {
@@ -225,7 +392,24 @@ void InputHandler::onKey(int key, int scancode, int action, int mods)
         debugMode_ = !debugMode_;
         spdlog::info("Debug overlay: {}", debugMode_ ? "ON" : "OFF");
     }
+    else if (key == GLFW_KEY_F2) {
+        // Toggle profiler overlay (per-zone CPU frame times)
+        profilerMode_ = !profilerMode_;
+        spdlog::info("Profiler overlay: {}", profilerMode_ ? "ON" : "OFF");
+    }
     // Note: ESC handling is done in GlBootstrap::poll()
 }
 
+void InputHandler::onResize(int fbW, int fbH)
+{
+    if (!window_ || fbW <= 0 || fbH <= 0) return;
+
+    // The log holds framebuffer pixels; the window is sized in screen units
+    int winW = 0, winH = 0, curW = 0, curH = 0;
+    glfwGetWindowSize(window_, &winW, &winH);
+    glfwGetFramebufferSize(window_, &curW, &curH);
+    if (curW <= 0 || curH <= 0 || (curW == fbW && curH == fbH)) return;
+    glfwSetWindowSize(window_, fbW * winW / curW, fbH * winH / curH);
+}
+
 } // namespace slippygl::render
@@ -1,6 +1,11 @@
 ﻿#pragma once
 
+#include "InputLog.hpp"
+
+#include <bitset>
 #include <functional>
+#include <memory>
+#include <string>
 
 struct GLFWwindow;
 
@@ -37,10 +42,45 @@ namespace slippygl::render
         /**
          * Per-frame update: WASD (+arrow keys) panning with smooth
          * acceleration/deceleration. Call once per frame after poll().
-         * Computes its own delta time via glfwGetTime().
+         * Computes its own delta time via glfwGetTime(); during playback the
+         * recorded events and delta time of the next frame are used instead.
          */
         void update();
 
+        /**
+         * Restart the delta-time clock. Call after blocking in an event wait
+         * so the idle time isn't applied as one long frame of pan easing.
+         */
+        void resetFrameClock();
+
+        /**
+         * Record input events and update() delta times to a binary log
+         * (see InputLog). Start right after attach() so the session begins
+         * from the app's initial camera.
+         * @return false if the file can't be created
+         */
+        bool startRecording(const std::string& path, std::string* err = nullptr);
+
+        /**
+         * Flush and close the recording (also done by detach())
+         */
+        void stopRecording();
+
+        /**
+         * Replay a recorded log in place of live GLFW callbacks. Live input is
+         * ignored until the log runs out, then control returns to the user.
+         * The window is resized to the recorded framebuffer size at the start
+         * and at each recorded resize (best effort: the window manager may
+         * clamp it, and the new size shows up one frame later).
+         * @return false if the log can't be read
+         */
+        bool startPlayback(const std::string& path, std::string* err = nullptr);
+
+        bool isRecording() const noexcept { return recorder_ != nullptr; }
+        bool isPlaying() const noexcept { return playing_; }
+        std::size_t playbackFrames() const noexcept { return playFrames_; }   // frames replayed so far
+        std::size_t playbackTotalFrames() const noexcept { return playTotal_; }
+
         /**
          * Check if attached
          */
@@ -51,6 +91,11 @@ namespace slippygl::render
          */
         bool debugMode() const noexcept { return debugMode_; }
 
+        /**
+         * Profiler overlay (per-zone frame times) toggle state. Toggled by F2.
+         */
+        bool profilerMode() const noexcept { return profilerMode_; }
+
         // For access in static callbacks
         static InputHandler* getHandler(GLFWwindow* window);
 
@@ -66,11 +111,33 @@ namespace slippygl::render
         // Debug overlay toggle (F3)
         bool debugMode_ = false;
 
+        // Profiler overlay toggle (F2)
+        bool profilerMode_ = false;
+
         // WASD panning state (smooth accel/decel)
         double lastUpdateTime_ = 0.0;  // glfwGetTime() of last update()
         float panVelX_ = 0.0f;         // current pan velocity (screen px/sec)
         float panVelY_ = 0.0f;
 
+        // Held keys, tracked from key events (not polled) so playback is exact
+        static constexpr int kMaxKeys = 512;
+        std::bitset<kMaxKeys> keysDown_;
+
+        // Recording / playback
+        std::unique_ptr<InputLogWriter> recorder_;
+        double recordStart_ = 0.0;     // glfwGetTime() at startRecording()
+        int recordFbW_ = 0;            // last framebuffer size written to the log
+        int recordFbH_ = 0;
+        InputLog playback_;
+        std::size_t playPos_ = 0;
+        std::size_t playFrames_ = 0;
+        std::size_t playTotal_ = 0;
+        bool playing_ = false;
+
+        void liveEvent(InputEvent e);          // from GLFW: record, then handle
+        void handleEvent(const InputEvent& e); // dispatch to on*()
+        void resetInteraction();
+
         // GLFW callback handlers
         static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
         static void cursorPosCallback(GLFWwindow* window, double xpos, double ypos);
@@ -82,6 +149,7 @@ namespace slippygl::render
         void onCursorPos(double xpos, double ypos);
         void onScroll(double xoffset, double yoffset);
         void onKey(int key, int scancode, int action, int mods);
+        void onResize(int fbW, int fbH);   // playback only
     };
 
 } // namespace slippygl::render
@@ -0,0 +1,280 @@
+#include "InputLog.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+namespace slippygl::render
+{
+namespace
+{
+    constexpr std::size_t kFlushBytes = 4096;
+
+    void putU16(std::vector<std::uint8_t>& out, std::uint32_t v)
+    {
+        out.push_back(static_cast<std::uint8_t>(v));
+        out.push_back(static_cast<std::uint8_t>(v >> 8));
+    }
+
+    void putF32(std::vector<std::uint8_t>& out, float f)
+    {
+        std::uint32_t v;
+        std::memcpy(&v, &f, sizeof(v));
+        for (int i = 0; i < 4; ++i) out.push_back(static_cast<std::uint8_t>(v >> (8 * i)));
+    }
+
+    void putVarint(std::vector<std::uint8_t>& out, std::uint64_t v)
+    {
+        while (v >= 0x80)
+        {
+            out.push_back(static_cast<std::uint8_t>(v | 0x80));
+            v >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    // Bounds-checked reader over the log bytes
+    struct Reader
+    {
+        const std::uint8_t* p;
+        const std::uint8_t* end;
+
+        bool u8(std::uint8_t& v)
+        {
+            if (p >= end) return false;
+            v = *p++;
+            return true;
+        }
+
+        bool u16(std::uint16_t& v)
+        {
+            if (end - p < 2) return false;
+            v = static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+            p += 2;
+            return true;
+        }
+
+        bool f32(float& f)
+        {
+            if (end - p < 4) return false;
+            const std::uint32_t v = static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8)
+                                  | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+            std::memcpy(&f, &v, sizeof(f));
+            p += 4;
+            return true;
+        }
+
+        bool varint(std::uint64_t& v)
+        {
+            v = 0;
+            for (int shift = 0; shift < 64; shift += 7)
+            {
+                std::uint8_t b;
+                if (!u8(b)) return false;
+                v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+                if (!(b & 0x80)) return true;
+            }
+            return false;
+        }
+    };
+}
+
+// ==== InputLog ====
+
+std::size_t InputLog::frameCount() const noexcept
+{
+    std::size_t n = 0;
+    for (const auto& e : events)
+    {
+        if (e.type == InputEvent::Type::kFrame) ++n;
+    }
+    return n;
+}
+
+void InputLog::encode(const InputEvent& e, std::uint64_t& prevTimeUs, std::vector<std::uint8_t>& out)
+{
+    out.push_back(static_cast<std::uint8_t>(e.type));
+    putVarint(out, e.timeUs >= prevTimeUs ? e.timeUs - prevTimeUs : 0);
+    prevTimeUs = std::max(prevTimeUs, e.timeUs);
+
+    switch (e.type)
+    {
+    case InputEvent::Type::kFrame:
+        putF32(out, e.x);
+        break;
+    case InputEvent::Type::kCursor:
+    case InputEvent::Type::kScroll:
+        putF32(out, e.x);
+        putF32(out, e.y);
+        break;
+    case InputEvent::Type::kMouseButton:
+        out.push_back(static_cast<std::uint8_t>(e.code));
+        out.push_back(static_cast<std::uint8_t>(e.action));
+        out.push_back(static_cast<std::uint8_t>(e.mods));
+        break;
+    case InputEvent::Type::kKey:
+        putU16(out, static_cast<std::uint32_t>(e.code));
+        out.push_back(static_cast<std::uint8_t>(e.action));
+        out.push_back(static_cast<std::uint8_t>(e.mods));
+        break;
+    case InputEvent::Type::kResize:
+        putU16(out, static_cast<std::uint32_t>(e.code));
+        putU16(out, static_cast<std::uint32_t>(e.action));
+        break;
+    }
+}
+
+bool InputLog::parse(const std::uint8_t* data, std::size_t size, InputLog& out, std::string* err)
+{
+    if (!data || size < kHeaderSize || std::memcmp(data, kMagic, sizeof(kMagic)) != 0)
+    {
+        if (err) *err = "Not an input log (bad magic)";
+        return false;
+    }
+
+    Reader r{ data + sizeof(kMagic), data + size };
+    std::uint16_t version = 0, reserved = 0, w = 0, h = 0;
+    r.u16(version);
+    r.u16(reserved);
+    r.u16(w);
+    r.u16(h);
+    if (version < 1 || version > kVersion)
+    {
+        if (err) *err = "Unsupported input log version " + std::to_string(version);
+        return false;
+    }
+
+    InputLog log;
+    log.fbW = w;
+    log.fbH = h;
+    std::uint64_t t = 0;
+    while (r.p < r.end)
+    {
+        InputEvent e;
+        std::uint8_t type = 0;
+        std::uint64_t delta = 0;
+        bool ok = r.u8(type) && r.varint(delta);
+        t += delta;
+        e.timeUs = t;
+        e.type = static_cast<InputEvent::Type>(type);
+
+        std::uint8_t a = 0, b = 0, c = 0;
+        std::uint16_t key = 0, w16 = 0, h16 = 0;
+        switch (e.type)
+        {
+        case InputEvent::Type::kFrame:
+            ok = ok && r.f32(e.x);
+            break;
+        case InputEvent::Type::kCursor:
+        case InputEvent::Type::kScroll:
+            ok = ok && r.f32(e.x) && r.f32(e.y);
+            break;
+        case InputEvent::Type::kMouseButton:
+            ok = ok && r.u8(a) && r.u8(b) && r.u8(c);
+            e.code = a;
+            e.action = b;
+            e.mods = c;
+            break;
+        case InputEvent::Type::kKey:
+            ok = ok && r.u16(key) && r.u8(b) && r.u8(c);
+            e.code = key;
+            e.action = b;
+            e.mods = c;
+            break;
+        case InputEvent::Type::kResize:
+            if (version < 2)
+            {
+                if (err) *err = "Unknown event type " + std::to_string(type) + " at event " + std::to_string(log.events.size());
+                return false;
+            }
+            ok = ok && r.u16(w16) && r.u16(h16);
+            e.code = w16;
+            e.action = h16;
+            break;
+        default:
+            if (err) *err = "Unknown event type " + std::to_string(type) + " at event " + std::to_string(log.events.size());
+            return false;
+        }
+        if (!ok)
+        {
+            if (err) *err = "Truncated input log at event " + std::to_string(log.events.size());
+            return false;
+        }
+        log.events.push_back(e);
+    }
+
+    out = std::move(log);
+    return true;
+}
+
+bool InputLog::load(const std::string& path, InputLog& out, std::string* err)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        if (err) *err = "Cannot open input log: " + path;
+        return false;
+    }
+    const std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return parse(bytes.data(), bytes.size(), out, err);
+}
+
+// ==== InputLogWriter ====
+
+bool InputLogWriter::open(const std::string& path, int fbW, int fbH, std::string* err)
+{
+    close();
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_)
+    {
+        if (err) *err = "Cannot create input log: " + path;
+        return false;
+    }
+
+    buf_.assign(InputLog::kMagic, InputLog::kMagic + sizeof(InputLog::kMagic));
+    putU16(buf_, InputLog::kVersion);
+    putU16(buf_, 0);
+    putU16(buf_, static_cast<std::uint32_t>(fbW));
+    putU16(buf_, static_cast<std::uint32_t>(fbH));
+    prevTimeUs_ = 0;
+    frames_ = 0;
+    failed_ = false;
+    return true;
+}
+
+void InputLogWriter::add(const InputEvent& e)
+{
+    if (!out_.is_open()) return;
+    InputLog::encode(e, prevTimeUs_, buf_);
+    bool due = buf_.size() >= kFlushBytes;
+    if (e.type == InputEvent::Type::kFrame)
+    {
+        ++frames_;
+        due = due || frames_ % kFlushFrames == 0;
+    }
+    if (due) flush();
+}
+
+bool InputLogWriter::flush()
+{
+    if (!buf_.empty())
+    {
+        out_.write(reinterpret_cast<const char*>(buf_.data()), static_cast<std::streamsize>(buf_.size()));
+        out_.flush();   // past the ofstream buffer, so the bytes survive a crash
+        buf_.clear();
+    }
+    if (!out_) failed_ = true;
+    return !failed_;
+}
+
+bool InputLogWriter::close(std::string* err)
+{
+    if (!out_.is_open()) return true;
+    bool ok = flush();
+    out_.close();
+    ok = ok && !out_.fail();
+    if (!ok && err) *err = "Failed to write input log";
+    return ok;
+}
+
+} // namespace slippygl::render
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace slippygl::render
+{
+    /**
+     * One recorded input event
+     * Frame events mark InputHandler::update() calls and carry its delta time;
+     * everything between two frame events arrived during that frame's poll().
+     */
+    struct InputEvent
+    {
+        enum class Type : std::uint8_t
+        {
+            kFrame = 0,        // x = dt (seconds)
+            kCursor = 1,       // x, y = cursor position
+            kMouseButton = 2,  // code = button, action, mods
+            kScroll = 3,       // x, y = scroll offsets
+            kKey = 4,          // code = key, action, mods
+            kResize = 5,       // code, action = framebuffer width, height (v2)
+        };
+
+        Type type = Type::kFrame;
+        std::uint64_t timeUs = 0;   // since recording start
+        float x = 0.0f;
+        float y = 0.0f;
+        std::int32_t code = 0;
+        std::int32_t action = 0;
+        std::int32_t mods = 0;
+    };
+
+    /**
+     * Input log format (little-endian)
+     *
+     *   [0]  magic "SGLINPUT"
+     *   [8]  u16 version (2), u16 reserved, u16 framebuffer width, u16 framebuffer height
+     *   [16] events: u8 type, varint time delta (us), payload
+     *          frame   f32 dt
+     *          cursor  f32 x, f32 y
+     *          button  u8 button, u8 action, u8 mods
+     *          scroll  f32 dx, f32 dy
+     *          key     u16 key, u8 action, u8 mods
+     *          resize  u16 width, u16 height
+     *
+     * Version 1 logs (no resize events) are still read.
+     * A frame without input costs 8 bytes (~29 KB per minute at 60 fps).
+     */
+    struct InputLog
+    {
+        static constexpr char kMagic[8] = { 'S','G','L','I','N','P','U','T' };
+        static constexpr std::uint16_t kVersion = 2;
+        static constexpr std::size_t kHeaderSize = 16;
+
+        int fbW = 0;
+        int fbH = 0;
+        std::vector<InputEvent> events;
+
+        std::size_t frameCount() const noexcept;
+
+        /**
+         * Parse an in-memory log
+         * @return false on bad magic/version or truncated event (out unchanged)
+         */
+        static bool parse(const std::uint8_t* data, std::size_t size, InputLog& out, std::string* err = nullptr);
+
+        /**
+         * Read and parse a log file
+         */
+        static bool load(const std::string& path, InputLog& out, std::string* err = nullptr);
+
+        /**
+         * Append one encoded event
+         * @param prevTimeUs Time of the previous event; updated
+         */
+        static void encode(const InputEvent& e, std::uint64_t& prevTimeUs, std::vector<std::uint8_t>& out);
+    };
+
+    /**
+     * Streams events to a log file
+     * - Events are buffered and handed to the OS every kFlushFrames frames
+     *   (or 4 KB of events, whichever comes first), so a crash loses at most
+     *   about half a second of a field recording at 60 fps
+     */
+    class InputLogWriter
+    {
+    public:
+        InputLogWriter() = default;
+        ~InputLogWriter() { close(); }
+
+        // Non-copyable
+        InputLogWriter(const InputLogWriter&) = delete;
+        InputLogWriter& operator=(const InputLogWriter&) = delete;
+
+        bool open(const std::string& path, int fbW, int fbH, std::string* err = nullptr);
+        void add(const InputEvent& e);
+        bool close(std::string* err = nullptr);
+
+        static constexpr std::size_t kFlushFrames = 30;
+
+        bool isOpen() const noexcept { return out_.is_open(); }
+        std::size_t frames() const noexcept { return frames_; }
+
+    private:
+        bool flush();
+
+        std::ofstream out_;
+        std::vector<std::uint8_t> buf_;
+        std::uint64_t prevTimeUs_ = 0;
+        std::size_t frames_ = 0;
+        bool failed_ = false;
+    };
+
+} // namespace slippygl::render
@@ -32,10 +32,29 @@ in vec2 vTexCoord;
 out vec4 FragColor;
 
 uniform sampler2D uTex;
+uniform float uOpacity;
+uniform bool uIndexed;     // R8 indices + palette rows (TexFormat::kIndexed8)
+uniform vec2 uImageSize;   // indexed: image size in texels; the palette starts at row uImageSize.y
 
 void main()
 {
-    FragColor = texture(uTex, vTexCoord);
+    vec4 c;
+    if (uIndexed)
+    {
+        // Nearest index, then one palette channel per row
+        ivec2 p = clamp(ivec2(vTexCoord * uImageSize), ivec2(0), ivec2(uImageSize) - 1);
+        int i = int(texelFetch(uTex, p, 0).r * 255.0 + 0.5);
+        int row = int(uImageSize.y);
+        c = vec4(texelFetch(uTex, ivec2(i, row), 0).r,
+                 texelFetch(uTex, ivec2(i, row + 1), 0).r,
+                 texelFetch(uTex, ivec2(i, row + 2), 0).r,
+                 texelFetch(uTex, ivec2(i, row + 3), 0).r);
+    }
+    else
+    {
+        c = texture(uTex, vTexCoord);
+    }
+    FragColor = vec4(c.rgb, c.a * uOpacity);
 }
 )";
 
@@ -67,6 +86,13 @@ bool QuadRenderer::init()
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
+    // Sampler for minified tiles: overrides the texture's NEAREST filter while bound
+    glGenSamplers(1, &trilinearSampler_);
+    glSamplerParameteri(trilinearSampler_, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glSamplerParameteri(trilinearSampler_, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glSamplerParameteri(trilinearSampler_, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glSamplerParameteri(trilinearSampler_, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
     // Compile and link shaders
     if (!compileShaders()) {
         shutdown();
@@ -91,6 +117,10 @@ void QuadRenderer::shutdown()
         glDeleteVertexArrays(1, &vao_);
         vao_ = 0;
     }
+    if (trilinearSampler_) {
+        glDeleteSamplers(1, &trilinearSampler_);
+        trilinearSampler_ = 0;
+    }
 }
 
 bool QuadRenderer::compileShaders()
@@ -150,6 +180,9 @@ bool QuadRenderer::compileShaders()
     // Cache uniform locations
     uProjLoc_ = glGetUniformLocation(program_, "uProj");
     uTexLoc_ = glGetUniformLocation(program_, "uTex");
+    uOpacityLoc_ = glGetUniformLocation(program_, "uOpacity");
+    uIndexedLoc_ = glGetUniformLocation(program_, "uIndexed");
+    uImageSizeLoc_ = glGetUniformLocation(program_, "uImageSize");
 
     return true;
 }
@@ -171,7 +204,8 @@ void QuadRenderer::draw(TexHandle tex, const Quad& q, int texFullW, int texFullH
     draw(tex, q, texFullW, texFullH, proj);
 }
 
-void QuadRenderer::draw(TexHandle tex, const Quad& q, int texFullW, int texFullH, const glm::mat4& mvp)
+void QuadRenderer::draw(TexHandle tex, const Quad& q, int texFullW, int texFullH, const glm::mat4& mvp,
+                        float opacity, bool indexed)
 {
     if (!program_ || !vao_ || tex == 0) return;
     if (texFullW <= 0 || texFullH <= 0) return;
@@ -211,9 +245,15 @@ void QuadRenderer::draw(TexHandle tex, const Quad& q, int texFullW, int texFullH
     glUseProgram(program_);
     glUniformMatrix4fv(uProjLoc_, 1, GL_FALSE, glm::value_ptr(mvp));
     glUniform1i(uTexLoc_, 0);
+    glUniform1f(uOpacityLoc_, opacity);
+    glUniform1i(uIndexedLoc_, indexed ? 1 : 0);
+    glUniform2f(uImageSizeLoc_, tw, th);
 
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, tex);
+    if (trilinear_) {
+        glBindSampler(0, trilinearSampler_);
+    }
 
     // Enable alpha blending (PNG transparency support)
     glEnable(GL_BLEND);
@@ -224,6 +264,9 @@ void QuadRenderer::draw(TexHandle tex, const Quad& q, int texFullW, int texFullH
     glBindVertexArray(0);
 
     glDisable(GL_BLEND);
+    if (trilinear_) {
+        glBindSampler(0, 0);
+    }
     glBindTexture(GL_TEXTURE_2D, 0);
     glUseProgram(0);
 }
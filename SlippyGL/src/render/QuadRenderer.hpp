@@ -59,17 +59,31 @@ namespace slippygl::render
 		 * @param texFullW Texture full width
 		 * @param texFullH Texture full height
 		 * @param mvp Model-View-Projection matrix
+		 * @param opacity Alpha multiplier (zoom cross-fade), 1 = opaque
+		 * @param indexed tex is TexFormat::kIndexed8 (texFull* = image size, without the palette rows)
 		 */
-		void draw(TexHandle tex, const Quad& q, int texFullW, int texFullH, const glm::mat4& mvp);
+		void draw(TexHandle tex, const Quad& q, int texFullW, int texFullH, const glm::mat4& mvp,
+		          float opacity = 1.0f, bool indexed = false);
+
+		/**
+		 * Sample with LINEAR_MIPMAP_LINEAR instead of the textures' NEAREST filter
+		 * For minified drawing (scale < 1); every texture drawn must have a mip chain.
+		 */
+		void setTrilinear(bool enabled) noexcept { trilinear_ = enabled; }
 
 	private:
 		unsigned int vao_ = 0;
 		unsigned int vbo_ = 0;
 		unsigned int program_ = 0;
+		unsigned int trilinearSampler_ = 0;
+		bool trilinear_ = false;
 
 		// Uniform locations
 		int uProjLoc_ = -1;
 		int uTexLoc_ = -1;
+		int uOpacityLoc_ = -1;
+		int uIndexedLoc_ = -1;
+		int uImageSizeLoc_ = -1;
 
 		bool compileShaders();
 	};
@@ -5,9 +5,11 @@
 #include <spdlog/spdlog.h>
 
 #include <algorithm>
-#include <array>
+#include <cmath>
+#include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <iterator>
 
 #define STB_TRUETYPE_IMPLEMENTATION
 #include <stb_truetype.h>
@@ -16,37 +18,61 @@ namespace slippygl::render
 {
 namespace
 {
-    // 지원 글리프: ASCII 32..126 (95자) + © (U+00A9). 총 96자.
-    constexpr int kAsciiFirst = 32;
-    constexpr int kAsciiLast  = 126;
-    constexpr int kAsciiCount = kAsciiLast - kAsciiFirst + 1; // 95
+    // init()에서 미리 올리는 글리프: ASCII 32..126 + © (U+00A9)
+    constexpr std::uint32_t kAsciiFirst = 32;
+    constexpr std::uint32_t kAsciiLast  = 126;
     constexpr std::uint32_t kCopyright = 0x00A9u;
-    constexpr int kGlyphCount = kAsciiCount + 1;              // 96
-    constexpr int kCopyrightIndex = kAsciiCount;              // 95
-    constexpr int kAtlasSize = 512;
+
+    // 동적 아틀라스: 폭 고정, 높이는 글리프가 늘면 두 배씩 (상한까지)
+    constexpr int kAtlasWidth = 1024;
+    constexpr int kAtlasInitialHeight = 256;
+    constexpr int kAtlasMaxHeight = 4096;
+    constexpr int kGlyphGap = 1;   // 선형 필터가 이웃 글리프를 끌어오지 않도록
+
+    // SDF: 32px로 구워 거리 4px까지 0..255에 담는다 (가장자리 = 128)
+    constexpr float kSdfBaseSize = 32.0f;
+    constexpr int kSdfPadding = 4;
+    constexpr unsigned char kSdfOnEdge = 128;
+    constexpr float kSdfDistScale = static_cast<float>(kSdfOnEdge) / kSdfPadding;
+
+    // 스트리밍 VBO 초기 용량 (정점). 디버그 오버레이 ~100타일 분량이면 넉넉하다.
+    constexpr std::size_t kStreamVertices = 16384;
+
+    // 레이아웃 캐시 상한 (문자열 개수)
+    constexpr std::size_t kMaxLayouts = 1024;
 
     const char* kVertexShader = R"(
 #version 330 core
 layout (location = 0) in vec2 aPos;
 layout (location = 1) in vec2 aUV;
+layout (location = 2) in vec4 aColor;
 out vec2 vUV;
+out vec4 vColor;
 uniform mat4 uProj;
 void main() {
     gl_Position = uProj * vec4(aPos, 0.0, 1.0);
     vUV = aUV;
+    vColor = aColor;
 }
 )";
 
     const char* kFragmentShader = R"(
 #version 330 core
 in vec2 vUV;
+in vec4 vColor;
 out vec4 FragColor;
 uniform sampler2D uTex;
-uniform vec4 uColor;
-uniform int uSolid;   // 1이면 텍스처 무시(단색), 0이면 글리프 커버리지 사용
+uniform bool uSdf;
+const float kEdge = 128.0 / 255.0;
 void main() {
-    float a = (uSolid == 1) ? 1.0 : texture(uTex, vUV).r;
-    FragColor = vec4(uColor.rgb, uColor.a * a);
+    // UV는 텍셀 단위 (아틀라스가 자라도 정점이 그대로 유효하도록)
+    float d = texture(uTex, vUV / vec2(textureSize(uTex, 0))).r;
+    // SDF: 화면 픽셀 약 한 칸 폭으로 가장자리를 안티에일리어싱. 비트맵: 커버리지 그대로
+    float w = max(0.7 * fwidth(d), 1e-4);
+    float coverage = uSdf ? smoothstep(kEdge - w, kEdge + w, d) : d;
+    // u < 0: 단색 정점(텍스처 무시)
+    float a = (vUV.x < 0.0) ? 1.0 : coverage;
+    FragColor = vec4(vColor.rgb, vColor.a * a);
 }
 )";
 
@@ -66,8 +92,29 @@ void main() {
         }
         return sh;
     }
+
+    std::string firstExisting(const char* const* candidates, std::size_t count)
+    {
+        namespace fs = std::filesystem;
+        std::error_code ec;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (fs::exists(candidates[i], ec)) {
+                return candidates[i];
+            }
+        }
+        return {};
+    }
 }
 
+struct TextRenderer::Font
+{
+    std::vector<unsigned char> data;   // stbtt_fontinfo가 가리키므로 폰트 수명 동안 유지
+    stbtt_fontinfo info{};
+    float scale = 1.0f;                // 폰트 단위 → 기준 크기 픽셀
+};
+
+TextRenderer::TextRenderer() = default;
+
 TextRenderer::~TextRenderer()
 {
     shutdown();
@@ -75,8 +122,7 @@ TextRenderer::~TextRenderer()
 
 std::string TextRenderer::findDefaultFontPath()
 {
-    namespace fs = std::filesystem;
-    const char* candidates[] = {
+    static const char* const candidates[] = {
         // Windows
         "C:/Windows/Fonts/segoeui.ttf",
         "C:/Windows/Fonts/arial.ttf",
@@ -90,95 +136,71 @@ std::string TextRenderer::findDefaultFontPath()
         "/usr/share/fonts/truetype/liberation/LiberationSans-Regular.ttf",
         "/usr/share/fonts/TTF/DejaVuSans.ttf",
     };
-    std::error_code ec;
-    for (const char* p : candidates) {
-        if (fs::exists(p, ec)) {
-            return p;
-        }
-    }
-    return {};
+    return firstExisting(candidates, std::size(candidates));
 }
 
-bool TextRenderer::init(const std::string& fontPath, float pixelHeight)
+std::string TextRenderer::findFallbackFontPath()
 {
+    // 한글 글리프가 있는 시스템 폰트 (기본 폰트에 없는 코드포인트를 처음 만날 때만 로드)
+    static const char* const candidates[] = {
+        // Windows
+        "C:/Windows/Fonts/malgun.ttf",
+        "C:/Windows/Fonts/gulim.ttc",
+        // macOS
+        "/System/Library/Fonts/AppleSDGothicNeo.ttc",
+        "/Library/Fonts/AppleGothic.ttf",
+        // Linux
+        "/usr/share/fonts/truetype/nanum/NanumGothic.ttf",
+        "/usr/share/fonts/opentype/noto/NotoSansCJK-Regular.ttc",
+        "/usr/share/fonts/noto-cjk/NotoSansCJK-Regular.ttc",
+        "/usr/share/fonts/google-noto-cjk/NotoSansCJK-Regular.ttc",
+    };
+    return firstExisting(candidates, std::size(candidates));
+}
+
+bool TextRenderer::init(const std::string& fontPath, float pixelHeight, GlyphMode mode)
+{
+    shutdown();
+    mode_ = mode;
     pixelHeight_ = pixelHeight;
+    baseSize_ = (mode_ == GlyphMode::kSdf) ? kSdfBaseSize : pixelHeight;
 
     const std::string path = fontPath.empty() ? findDefaultFontPath() : fontPath;
     if (path.empty()) {
         spdlog::error("TextRenderer: no usable TTF font found (attribution overlay disabled)");
         return false;
     }
-
-    // 폰트 파일 로드
-    std::ifstream ifs(path, std::ios::binary);
-    if (!ifs) {
-        spdlog::error("TextRenderer: failed to open font: {}", path);
-        return false;
-    }
-    std::vector<unsigned char> fontBytes(
-        (std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
-    if (fontBytes.empty()) {
-        spdlog::error("TextRenderer: empty font file: {}", path);
+    if (!loadFont(path)) {
         return false;
     }
 
-    // 코드포인트 목록: ASCII 32..126 + ©
-    std::array<int, kGlyphCount> codepoints{};
-    for (int i = 0; i < kAsciiCount; ++i) {
-        codepoints[i] = kAsciiFirst + i;
-    }
-    codepoints[kCopyrightIndex] = static_cast<int>(kCopyright);
-
-    // 글리프 아틀라스(R8) 굽기
-    std::vector<unsigned char> bitmap(static_cast<size_t>(kAtlasSize) * kAtlasSize, 0);
-    auto* packed = new stbtt_packedchar[kGlyphCount];
-
-    stbtt_pack_context pc;
-    if (!stbtt_PackBegin(&pc, bitmap.data(), kAtlasSize, kAtlasSize, 0, 1, nullptr)) {
-        spdlog::error("TextRenderer: stbtt_PackBegin failed");
-        delete[] packed;
-        return false;
-    }
-    stbtt_PackSetOversampling(&pc, 1, 1);
-
-    stbtt_pack_range range{};
-    range.font_size = pixelHeight_;
-    range.first_unicode_codepoint_in_range = 0;
-    range.array_of_unicode_codepoints = codepoints.data();
-    range.num_chars = kGlyphCount;
-    range.chardata_for_range = packed;
-
-    const int packOk = stbtt_PackFontRanges(&pc, fontBytes.data(), 0, &range, 1);
-    stbtt_PackEnd(&pc);
-    if (!packOk) {
-        spdlog::warn("TextRenderer: some glyphs failed to pack (atlas may be too small)");
-    }
-
-    packed_ = packed;
-    atlasW_ = kAtlasSize;
-    atlasH_ = kAtlasSize;
-
-    // GL 텍스처 업로드 (단일 채널)
+    // 아틀라스 텍스처 (단일 채널). 처음엔 작게 잡고 글리프가 늘면 높이를 키운다.
+    atlasW_ = kAtlasWidth;
+    atlasH_ = kAtlasInitialHeight;
+    atlasPixels_.assign(static_cast<std::size_t>(atlasW_) * atlasH_, 0);
     glGenTextures(1, &atlasTex_);
     glBindTexture(GL_TEXTURE_2D, atlasTex_);
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, kAtlasSize, kAtlasSize, 0,
-                 GL_RED, GL_UNSIGNED_BYTE, bitmap.data());
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glBindTexture(GL_TEXTURE_2D, 0);
+    uploadAtlas();
 
-    // VAO/VBO
+    // VAO/VBO (프레임 간 재사용하는 스트리밍 버퍼)
     glGenVertexArrays(1, &vao_);
     glGenBuffers(1, &vbo_);
     glBindVertexArray(vao_);
     glBindBuffer(GL_ARRAY_BUFFER, vbo_);
+    vboCapacity_ = kStreamVertices;
+    vboOffset_ = 0;
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vboCapacity_ * sizeof(Vert)), nullptr, GL_STREAM_DRAW);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vert), (void*)0);
     glEnableVertexAttribArray(1);
     glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vert), (void*)(2 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vert), (void*)(4 * sizeof(float)));
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindVertexArray(0);
 
@@ -187,7 +209,39 @@ bool TextRenderer::init(const std::string& fontPath, float pixelHeight)
         return false;
     }
 
-    spdlog::info("TextRenderer initialized (font: {}, {}px)", path, pixelHeight_);
+    // 저작자 표시/디버그 라벨에 쓰는 글리프는 미리 올려 첫 프레임에 래스터가 몰리지 않게 한다
+    for (std::uint32_t cp = kAsciiFirst; cp <= kAsciiLast; ++cp) {
+        glyph(cp);
+    }
+    glyph(kCopyright);
+
+    spdlog::info("TextRenderer initialized (font: {}, {}px, {})", path, pixelHeight_,
+                 mode_ == GlyphMode::kSdf ? "SDF" : "bitmap");
+    return true;
+}
+
+bool TextRenderer::loadFont(const std::string& path)
+{
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs) {
+        spdlog::error("TextRenderer: failed to open font: {}", path);
+        return false;
+    }
+    auto font = std::make_unique<Font>();
+    font->data.assign((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+    if (font->data.empty()) {
+        spdlog::error("TextRenderer: empty font file: {}", path);
+        return false;
+    }
+
+    // .ttc는 첫 번째 폰트를 쓴다
+    const int offset = stbtt_GetFontOffsetForIndex(font->data.data(), 0);
+    if (offset < 0 || !stbtt_InitFont(&font->info, font->data.data(), offset)) {
+        spdlog::error("TextRenderer: unsupported font file: {}", path);
+        return false;
+    }
+    font->scale = stbtt_ScaleForPixelHeight(&font->info, baseSize_);
+    fonts_.push_back(std::move(font));
     return true;
 }
 
@@ -221,8 +275,7 @@ bool TextRenderer::compileShaders()
 
     uProjLoc_  = glGetUniformLocation(program_, "uProj");
     uTexLoc_   = glGetUniformLocation(program_, "uTex");
-    uColorLoc_ = glGetUniformLocation(program_, "uColor");
-    uSolidLoc_ = glGetUniformLocation(program_, "uSolid");
+    uSdfLoc_   = glGetUniformLocation(program_, "uSdf");
     return true;
 }
 
@@ -232,7 +285,31 @@ void TextRenderer::shutdown()
     if (vbo_)     { glDeleteBuffers(1, &vbo_); vbo_ = 0; }
     if (vao_)     { glDeleteVertexArrays(1, &vao_); vao_ = 0; }
     if (atlasTex_){ glDeleteTextures(1, &atlasTex_); atlasTex_ = 0; }
-    if (packed_)  { delete[] static_cast<stbtt_packedchar*>(packed_); packed_ = nullptr; }
+    vboCapacity_ = 0;
+    vboOffset_ = 0;
+    pending_.clear();
+    batching_ = false;
+
+    fonts_.clear();
+    fallbackTried_ = false;
+    atlasPixels_.clear();
+    atlasPixels_.shrink_to_fit();
+    atlasW_ = 0;
+    atlasH_ = 0;
+    shelfX_ = 0;
+    shelfY_ = 0;
+    shelfH_ = 0;
+    atlasFullWarned_ = false;
+    glyphs_.clear();
+    layouts_.clear();
+}
+
+std::uint32_t TextRenderer::packColor(const glm::vec4& c)
+{
+    const auto byte = [](float v) {
+        return static_cast<std::uint32_t>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    return byte(c.r) | (byte(c.g) << 8) | (byte(c.b) << 16) | (byte(c.a) << 24);
 }
 
 std::vector<std::uint32_t> TextRenderer::decodeUtf8(const std::string& s)
@@ -258,61 +335,228 @@ std::vector<std::uint32_t> TextRenderer::decodeUtf8(const std::string& s)
     return out;
 }
 
-int TextRenderer::glyphIndex(std::uint32_t cp) const
+bool TextRenderer::findGlyph(std::uint32_t cp, int& font, int& index)
+{
+    for (std::size_t i = 0; i < fonts_.size(); ++i) {
+        const int gi = stbtt_FindGlyphIndex(&fonts_[i]->info, static_cast<int>(cp));
+        if (gi != 0) {
+            font = static_cast<int>(i);
+            index = gi;
+            return true;
+        }
+    }
+    if (fallbackTried_) {
+        return false;
+    }
+
+    // 기본 폰트에 없는 첫 코드포인트: 폴백 폰트를 한 번만 찾아 붙인다
+    fallbackTried_ = true;
+    const std::string path = findFallbackFontPath();
+    if (path.empty() || !loadFont(path)) {
+        spdlog::warn("TextRenderer: no fallback font for U+{:04X}; such glyphs are skipped", cp);
+        return false;
+    }
+    spdlog::info("TextRenderer: fallback font loaded: {}", path);
+    return findGlyph(cp, font, index);
+}
+
+bool TextRenderer::allocate(int w, int h, int& x, int& y)
 {
-    if (cp >= static_cast<std::uint32_t>(kAsciiFirst) &&
-        cp <= static_cast<std::uint32_t>(kAsciiLast)) {
-        return static_cast<int>(cp) - kAsciiFirst;
+    const int cellW = w + kGlyphGap;
+    const int cellH = h + kGlyphGap;
+    if (cellW > atlasW_) {
+        return false;
     }
-    if (cp == kCopyright) {
-        return kCopyrightIndex;
+    if (shelfX_ + cellW > atlasW_) {   // 현재 선반이 찼으면 다음 선반
+        shelfY_ += shelfH_;
+        shelfX_ = 0;
+        shelfH_ = 0;
     }
-    return -1;
+    while (shelfY_ + cellH > atlasH_) {
+        if (atlasH_ * 2 > kAtlasMaxHeight) {
+            return false;
+        }
+        // 행 우선 배열이라 아래에 행을 덧붙이면 기존 글리프 좌표가 그대로다
+        atlasH_ *= 2;
+        atlasPixels_.resize(static_cast<std::size_t>(atlasW_) * atlasH_, 0);
+        uploadAtlas();
+    }
+    x = shelfX_;
+    y = shelfY_;
+    shelfX_ += cellW;
+    shelfH_ = std::max(shelfH_, cellH);
+    return true;
 }
 
-float TextRenderer::buildQuads(const std::vector<std::uint32_t>& cps,
-                               float originX, float originBaselineY,
-                               std::vector<Vert>& out,
-                               glm::vec4& bbox) const
+void TextRenderer::uploadAtlas()
 {
-    auto* packed = static_cast<stbtt_packedchar*>(packed_);
-    float xpos = originX;
-    float ypos = originBaselineY;
+    glBindTexture(GL_TEXTURE_2D, atlasTex_);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, atlasW_, atlasH_, 0,
+                 GL_RED, GL_UNSIGNED_BYTE, atlasPixels_.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+const TextRenderer::Glyph& TextRenderer::glyph(std::uint32_t cp)
+{
+    const auto it = glyphs_.find(cp);
+    if (it != glyphs_.end()) {
+        return it->second;
+    }
+
+    Glyph g;
+    if (cp >= kAsciiFirst && findGlyph(cp, g.font, g.index)) {
+        const Font& f = *fonts_[g.font];
+        int advance = 0, lsb = 0;
+        stbtt_GetGlyphHMetrics(&f.info, g.index, &advance, &lsb);
+        g.advance = static_cast<float>(advance) * f.scale;
+
+        int w = 0, h = 0, xoff = 0, yoff = 0;
+        const bool sdf = (mode_ == GlyphMode::kSdf);
+        unsigned char* bmp = sdf
+            ? stbtt_GetGlyphSDF(&f.info, f.scale, g.index, kSdfPadding, kSdfOnEdge, kSdfDistScale,
+                                &w, &h, &xoff, &yoff)
+            : stbtt_GetGlyphBitmap(&f.info, f.scale, f.scale, g.index, &w, &h, &xoff, &yoff);
+
+        // 공백처럼 잉크가 없는 글리프는 bmp가 없다 (진행 폭만 쓴다)
+        if (bmp && w > 0 && h > 0) {
+            if (allocate(w, h, g.x, g.y)) {
+                g.w = w;
+                g.h = h;
+                g.xoff = static_cast<float>(xoff);
+                g.yoff = static_cast<float>(yoff);
+                for (int row = 0; row < h; ++row) {
+                    std::memcpy(&atlasPixels_[static_cast<std::size_t>(g.y + row) * atlasW_ + g.x],
+                                bmp + static_cast<std::size_t>(row) * w, static_cast<std::size_t>(w));
+                }
+                glBindTexture(GL_TEXTURE_2D, atlasTex_);
+                glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+                glTexSubImage2D(GL_TEXTURE_2D, 0, g.x, g.y, w, h, GL_RED, GL_UNSIGNED_BYTE, bmp);
+                glBindTexture(GL_TEXTURE_2D, 0);
+            } else if (!atlasFullWarned_) {
+                spdlog::warn("TextRenderer: glyph atlas full ({}x{}); new glyphs are drawn blank",
+                             atlasW_, atlasH_);
+                atlasFullWarned_ = true;
+            }
+        }
+        if (bmp) {
+            if (sdf) stbtt_FreeSDF(bmp, nullptr);
+            else     stbtt_FreeBitmap(bmp, nullptr);
+        }
+    }
+    return glyphs_.emplace(cp, g).first->second;
+}
+
+const TextRenderer::Layout& TextRenderer::layout(const std::string& utf8)
+{
+    auto it = layouts_.find(utf8);
+    if (it != layouts_.end()) {
+        return it->second;
+    }
+    if (layouts_.size() >= kMaxLayouts) {
+        layouts_.clear();
+    }
+    Layout l;
+    shape(utf8, l);
+    return layouts_.emplace(utf8, std::move(l)).first->second;
+}
+
+void TextRenderer::shape(const std::string& utf8, Layout& out)
+{
+    // SDF 사각형은 거리장 패딩만큼 잉크보다 크므로 bbox에서는 패딩을 뺀다
+    const float inset = (mode_ == GlyphMode::kSdf) ? static_cast<float>(kSdfPadding) : 0.0f;
+    float pen = 0.0f;
+    const Glyph* prev = nullptr;
     bool any = false;
     float minX = 0, minY = 0, maxX = 0, maxY = 0;
 
-    for (std::uint32_t cp : cps) {
-        const int gi = glyphIndex(cp);
-        if (gi < 0) {
+    for (std::uint32_t cp : decodeUtf8(utf8)) {
+        const Glyph& g = glyph(cp);
+        if (g.font < 0) {
             continue; // 미지원 글리프는 건너뜀
         }
-        stbtt_aligned_quad q;
-        stbtt_GetPackedQuad(packed, atlasW_, atlasH_, gi, &xpos, &ypos, &q, 1);
-
-        // 2 삼각형
-        out.push_back({ q.x0, q.y0, q.s0, q.t0 });
-        out.push_back({ q.x1, q.y0, q.s1, q.t0 });
-        out.push_back({ q.x0, q.y1, q.s0, q.t1 });
-        out.push_back({ q.x1, q.y0, q.s1, q.t0 });
-        out.push_back({ q.x1, q.y1, q.s1, q.t1 });
-        out.push_back({ q.x0, q.y1, q.s0, q.t1 });
-
-        if (!any) { minX = q.x0; minY = q.y0; maxX = q.x1; maxY = q.y1; any = true; }
-        else {
-            minX = std::min(minX, q.x0); minY = std::min(minY, q.y0);
-            maxX = std::max(maxX, q.x1); maxY = std::max(maxY, q.y1);
+        if (prev && prev->font == g.font) {
+            const Font& f = *fonts_[g.font];
+            pen += static_cast<float>(stbtt_GetGlyphKernAdvance(&f.info, prev->index, g.index)) * f.scale;
+        }
+        prev = &g;
+
+        if (g.w > 0) {
+            // 비트맵 글리프는 정수 픽셀에 놓아야 번지지 않는다
+            float x0 = pen + g.xoff;
+            if (mode_ == GlyphMode::kBitmap) x0 = std::round(x0);
+            const float y0 = g.yoff;
+            const float x1 = x0 + static_cast<float>(g.w);
+            const float y1 = y0 + static_cast<float>(g.h);
+            const float s0 = static_cast<float>(g.x), t0 = static_cast<float>(g.y);
+            const float s1 = s0 + static_cast<float>(g.w), t1 = t0 + static_cast<float>(g.h);
+
+            // 2 삼각형
+            out.verts.push_back({ x0, y0, s0, t0, 0 });
+            out.verts.push_back({ x1, y0, s1, t0, 0 });
+            out.verts.push_back({ x0, y1, s0, t1, 0 });
+            out.verts.push_back({ x1, y0, s1, t0, 0 });
+            out.verts.push_back({ x1, y1, s1, t1, 0 });
+            out.verts.push_back({ x0, y1, s0, t1, 0 });
+
+            const float ix0 = x0 + inset, iy0 = y0 + inset, ix1 = x1 - inset, iy1 = y1 - inset;
+            if (!any) { minX = ix0; minY = iy0; maxX = ix1; maxY = iy1; any = true; }
+            else {
+                minX = std::min(minX, ix0); minY = std::min(minY, iy0);
+                maxX = std::max(maxX, ix1); maxY = std::max(maxY, iy1);
+            }
         }
+        pen += g.advance;
     }
 
-    bbox = glm::vec4(minX, minY, maxX, maxY);
-    return xpos - originX;
+    out.bbox = glm::vec4(minX, minY, maxX, maxY);
 }
 
-void TextRenderer::uploadAndDraw(const std::vector<Vert>& verts,
-                                 const glm::vec4& color, bool solid,
-                                 int fbW, int fbH)
+float TextRenderer::layoutScale(float pixelHeight) const
 {
-    if (verts.empty() || program_ == 0 || fbW <= 0 || fbH <= 0) {
+    return (pixelHeight > 0.0f ? pixelHeight : pixelHeight_) / baseSize_;
+}
+
+void TextRenderer::appendLayout(const Layout& l, float originX, float originBaselineY,
+                                float scale, std::uint32_t rgba)
+{
+    // 원점을 정수 픽셀에 맞춰 팬 중에 글자가 서브픽셀로 흔들리지 않게 한다
+    const float dx = std::round(originX);
+    const float dy = std::round(originBaselineY);
+    const std::size_t base = pending_.size();
+    pending_.resize(base + l.verts.size());
+    Vert* dst = pending_.data() + base;
+    for (const Vert& v : l.verts) {
+        *dst++ = { v.x * scale + dx, v.y * scale + dy, v.u, v.v, rgba };
+    }
+}
+
+void TextRenderer::beginBatch(int fbW, int fbH)
+{
+    // 배치 밖에서 쌓인 정점이 남아 있을 수 없다 (submit이 바로 비운다)
+    batching_ = true;
+    batchW_ = fbW;
+    batchH_ = fbH;
+}
+
+void TextRenderer::endBatch()
+{
+    if (!batching_) return;
+    batching_ = false;
+    flush(batchW_, batchH_);
+}
+
+void TextRenderer::submit(int fbW, int fbH)
+{
+    if (!batching_) {
+        flush(fbW, fbH);
+    }
+}
+
+void TextRenderer::flush(int fbW, int fbH)
+{
+    if (pending_.empty() || program_ == 0 || fbW <= 0 || fbH <= 0) {
+        pending_.clear();
         return;
     }
 
@@ -325,16 +569,33 @@ void TextRenderer::uploadAndDraw(const std::vector<Vert>& verts,
     proj[3][1] =  1.0f;
     proj[3][3] =  1.0f;
 
+    // 스트리밍 버퍼: 이어 쓰다가 끝에 닿으면 orphan(새 저장소 할당)하고 처음부터.
+    // GPU가 아직 읽는 영역은 덮어쓰지 않으므로 UNSYNCHRONIZED 매핑이 안전하다.
+    const std::size_t count = pending_.size();
     glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-    glBufferData(GL_ARRAY_BUFFER,
-                 static_cast<GLsizeiptr>(verts.size() * sizeof(Vert)),
-                 verts.data(), GL_DYNAMIC_DRAW);
+    if (count > vboCapacity_) {
+        vboCapacity_ = std::max(count, vboCapacity_ * 2);
+        vboOffset_ = vboCapacity_;   // 아래에서 새 크기로 orphan
+    }
+    if (vboOffset_ + count > vboCapacity_) {
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vboCapacity_ * sizeof(Vert)), nullptr, GL_STREAM_DRAW);
+        vboOffset_ = 0;
+    }
+    const GLintptr byteOffset = static_cast<GLintptr>(vboOffset_ * sizeof(Vert));
+    const GLsizeiptr byteSize = static_cast<GLsizeiptr>(count * sizeof(Vert));
+    void* dst = glMapBufferRange(GL_ARRAY_BUFFER, byteOffset, byteSize,
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+    if (dst) {
+        std::memcpy(dst, pending_.data(), static_cast<std::size_t>(byteSize));
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    } else {
+        glBufferSubData(GL_ARRAY_BUFFER, byteOffset, byteSize, pending_.data());
+    }
 
     glUseProgram(program_);
     glUniformMatrix4fv(uProjLoc_, 1, GL_FALSE, glm::value_ptr(proj));
-    glUniform4fv(uColorLoc_, 1, glm::value_ptr(color));
-    glUniform1i(uSolidLoc_, solid ? 1 : 0);
     glUniform1i(uTexLoc_, 0);
+    glUniform1i(uSdfLoc_, mode_ == GlyphMode::kSdf ? 1 : 0);
 
     glActiveTexture(GL_TEXTURE0);
     glBindTexture(GL_TEXTURE_2D, atlasTex_);
@@ -343,35 +604,43 @@ void TextRenderer::uploadAndDraw(const std::vector<Vert>& verts,
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     glBindVertexArray(vao_);
-    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(verts.size()));
+    glDrawArrays(GL_TRIANGLES, static_cast<GLint>(vboOffset_), static_cast<GLsizei>(count));
     glBindVertexArray(0);
 
     glDisable(GL_BLEND);
     glBindTexture(GL_TEXTURE_2D, 0);
     glUseProgram(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    vboOffset_ += count;
+    pending_.clear();
+}
+
+void TextRenderer::appendRect(float x, float y, float w, float h, std::uint32_t rgba)
+{
+    const float x0 = x, y0 = y, x1 = x + w, y1 = y + h;
+    pending_.push_back({ x0, y0, -1.0f, 0.0f, rgba });
+    pending_.push_back({ x1, y0, -1.0f, 0.0f, rgba });
+    pending_.push_back({ x0, y1, -1.0f, 0.0f, rgba });
+    pending_.push_back({ x1, y0, -1.0f, 0.0f, rgba });
+    pending_.push_back({ x1, y1, -1.0f, 0.0f, rgba });
+    pending_.push_back({ x0, y1, -1.0f, 0.0f, rgba });
 }
 
 void TextRenderer::drawText(const std::string& utf8, float x, float y,
-                            const glm::vec4& color, int fbW, int fbH)
+                            const glm::vec4& color, int fbW, int fbH, float pixelHeight)
 {
     if (!ready()) return;
-    const auto cps = decodeUtf8(utf8);
-    std::vector<Vert> verts;
-    glm::vec4 bbox(0.0f);
-    buildQuads(cps, x, y, verts, bbox);
-    uploadAndDraw(verts, color, /*solid*/false, fbW, fbH);
+    appendLayout(layout(utf8), x, y, layoutScale(pixelHeight), packColor(color));
+    submit(fbW, fbH);
 }
 
 void TextRenderer::drawRect(float x, float y, float w, float h,
                             const glm::vec4& color, int fbW, int fbH)
 {
     if (!ready()) return;
-    const float x0 = x, y0 = y, x1 = x + w, y1 = y + h;
-    std::vector<Vert> verts = {
-        { x0, y0, 0, 0 }, { x1, y0, 0, 0 }, { x0, y1, 0, 0 },
-        { x1, y0, 0, 0 }, { x1, y1, 0, 0 }, { x0, y1, 0, 0 },
-    };
-    uploadAndDraw(verts, color, /*solid*/true, fbW, fbH);
+    appendRect(x, y, w, h, packColor(color));
+    submit(fbW, fbH);
 }
 
 void TextRenderer::drawRectOutline(float x, float y, float w, float h, float thickness,
@@ -379,50 +648,46 @@ void TextRenderer::drawRectOutline(float x, float y, float w, float h, float thi
 {
     if (!ready() || w <= 0 || h <= 0) return;
     const float t = thickness;
-    drawRect(x,         y,         w, t,         color, fbW, fbH); // top
-    drawRect(x,         y + h - t, w, t,         color, fbW, fbH); // bottom
-    drawRect(x,         y,         t, h,         color, fbW, fbH); // left
-    drawRect(x + w - t, y,         t, h,         color, fbW, fbH); // right
+    const std::uint32_t rgba = packColor(color);
+    appendRect(x,         y,         w, t, rgba); // top
+    appendRect(x,         y + h - t, w, t, rgba); // bottom
+    appendRect(x,         y,         t, h, rgba); // left
+    appendRect(x + w - t, y,         t, h, rgba); // right
+    submit(fbW, fbH);
 }
 
-bool TextRenderer::measure(const std::string& utf8, float& outW, float& outH) const
+bool TextRenderer::measure(const std::string& utf8, float& outW, float& outH, float pixelHeight)
 {
     if (!ready()) return false;
-    const auto cps = decodeUtf8(utf8);
-    std::vector<Vert> probe;
-    glm::vec4 bbox(0.0f);
-    buildQuads(cps, 0.0f, 0.0f, probe, bbox);
-    outW = bbox.z - bbox.x;
-    outH = bbox.w - bbox.y;
+    const glm::vec4& bbox = layout(utf8).bbox;
+    const float s = layoutScale(pixelHeight);
+    outW = (bbox.z - bbox.x) * s;
+    outH = (bbox.w - bbox.y) * s;
     return true;
 }
 
 void TextRenderer::drawTextBoxed(const std::string& utf8, float tlx, float tly,
                                  const glm::vec4& textColor, const glm::vec4& bgColor,
-                                 float pad, int fbW, int fbH)
+                                 float pad, int fbW, int fbH, float pixelHeight)
 {
     if (!ready()) return;
-    const auto cps = decodeUtf8(utf8);
 
     // 베이스라인 (0,0) 기준 bbox로 크기/오프셋 계산
-    std::vector<Vert> probe;
-    glm::vec4 bbox(0.0f);
-    buildQuads(cps, 0.0f, 0.0f, probe, bbox);
+    const Layout& l = layout(utf8);
+    const float s = layoutScale(pixelHeight);
+    const glm::vec4 bbox(l.bbox.x * s, l.bbox.y * s, l.bbox.z * s, l.bbox.w * s);
     const float w = bbox.z - bbox.x;
     const float h = bbox.w - bbox.y;
 
     if (bgColor.a > 0.0f) {
-        drawRect(tlx, tly, w + 2.0f * pad, h + 2.0f * pad, bgColor, fbW, fbH);
+        appendRect(tlx, tly, w + 2.0f * pad, h + 2.0f * pad, packColor(bgColor));
     }
 
     // 텍스트 bbox의 top-left이 (tlx+pad, tly+pad)에 오도록 베이스라인 원점 보정
     const float originX = (tlx + pad) - bbox.x;
     const float originY = (tly + pad) - bbox.y;
-
-    std::vector<Vert> verts;
-    glm::vec4 ignore(0.0f);
-    buildQuads(cps, originX, originY, verts, ignore);
-    uploadAndDraw(verts, textColor, /*solid*/false, fbW, fbH);
+    appendLayout(l, originX, originY, s, packColor(textColor));
+    submit(fbW, fbH);
 }
 
 void TextRenderer::drawAttribution(int fbW, int fbH)
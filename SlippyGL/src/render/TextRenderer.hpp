@@ -1,5 +1,7 @@
 #pragma once
 #include <string>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <cstdint>
 #include <glm/glm.hpp>
@@ -9,38 +11,66 @@ namespace slippygl::render
     /**
      * TTF 기반 텍스트 오버레이 렌더러.
      *
-     * stb_truetype로 폰트 글리프 아틀라스를 한 번 구워(R8 텍스처) 화면 공간(top-left
-     * origin, y-down)에 텍스트와 단색 사각형을 그린다. ASCII(32~126) + © (U+00A9)를
-     * 지원하므로 OSM 저작자 표시(`© OpenStreetMap contributors`)를 진짜 © 글자로 렌더한다.
+     * stb_truetype로 글리프를 필요할 때 래스터해 단일 채널(R8) 아틀라스에 채워 넣고, 화면
+     * 공간(top-left origin, y-down)에 텍스트와 단색 사각형을 그린다. ASCII + ©는 init()에서
+     * 미리 올리고, 그 외 코드포인트(한글 지명 등)는 처음 쓰일 때 추가한다. 기본 폰트에 없는
+     * 글리프는 한글을 가진 시스템 폰트를 폴백으로 찾아 쓴다.
      *
-     * 추후 Step 8 디버그 오버레이(타일 z/x/y 텍스트)에서도 재사용한다.
+     * 기본 모드(GlyphMode::kSdf)는 글리프를 부호 거리장으로 구워 한 아틀라스로 모든 글자
+     * 크기와 HiDPI 배율을 선명하게 그린다. kBitmap은 init() 크기 그대로 래스터한다.
+     *
+     * 색상은 정점별(RGBA8)이고 단색/글리프 정점이 한 스트림에 섞이므로, beginBatch()와
+     * endBatch() 사이의 호출들은 드로우 한 번으로 그려진다 (디버그 오버레이의 타일당
+     * 사각형 4개 + 라벨이 수백 번의 드로우가 되지 않도록).
+     *
+     * 문자열별 레이아웃(베이스라인 원점 기준 글리프 정점 + bbox)은 캐시해 두고, 그릴 때는
+     * 평행이동과 색만 입힌다. 저작자 표시처럼 매 프레임 같은 문자열은 디코드/셰이핑/할당이 없다.
      */
     class TextRenderer
     {
     public:
-        TextRenderer() = default;
+        /** 글리프 아틀라스 방식 */
+        enum class GlyphMode
+        {
+            kBitmap,  // init() 픽셀 높이로 래스터. 그 크기에서만 선명하다
+            kSdf,     // 부호 거리장. 어떤 크기/배율로 그려도 가장자리가 선명하다
+        };
+
+        TextRenderer();
         ~TextRenderer();
 
         TextRenderer(const TextRenderer&) = delete;
         TextRenderer& operator=(const TextRenderer&) = delete;
 
         /**
-         * 폰트를 로드해 글리프 아틀라스를 굽고 GL 리소스를 준비한다.
+         * 폰트를 로드하고 아틀라스/GL 리소스를 준비한다.
          * @param fontPath  TTF 경로. 빈 문자열이면 시스템 폰트를 자동 탐색한다.
-         * @param pixelHeight  글리프 픽셀 높이(ascender~descender)
+         * @param pixelHeight  기본 글자 픽셀 높이(ascender~descender). draw*에 크기를 안 주면 이 값.
+         * @param mode  아틀라스 방식
          * @return 성공 시 true
          */
-        bool init(const std::string& fontPath = "", float pixelHeight = 16.0f);
+        bool init(const std::string& fontPath = "", float pixelHeight = 16.0f,
+                  GlyphMode mode = GlyphMode::kSdf);
 
         void shutdown();
 
         bool ready() const { return program_ != 0 && atlasTex_ != 0; }
 
+        /**
+         * 배치 시작. endBatch()까지의 draw* 호출은 정점만 쌓는다 (호출 순서 = 그리는 순서).
+         * 배치 밖의 draw* 호출은 호출마다 바로 그린다.
+         */
+        void beginBatch(int fbW, int fbH);
+
+        /** 쌓인 정점을 스트리밍 버퍼에 한 번 올리고 한 번에 그린다. */
+        void endBatch();
+
         /**
          * 텍스트를 그린다. (x, y)는 첫 글자의 베이스라인 펜 위치(화면 픽셀, y-down).
+         * pixelHeight가 0이면 init() 크기.
          */
         void drawText(const std::string& utf8, float x, float y,
-                      const glm::vec4& color, int fbW, int fbH);
+                      const glm::vec4& color, int fbW, int fbH, float pixelHeight = 0.0f);
 
         /** 단색 사각형(반투명 배경 바 등)을 그린다. */
         void drawRect(float x, float y, float w, float h,
@@ -56,10 +86,13 @@ namespace slippygl::render
          */
         void drawTextBoxed(const std::string& utf8, float tlx, float tly,
                            const glm::vec4& textColor, const glm::vec4& bgColor,
-                           float pad, int fbW, int fbH);
+                           float pad, int fbW, int fbH, float pixelHeight = 0.0f);
 
-        /** 텍스트 픽셀 크기(폭/높이)를 측정한다. 미초기화면 false. */
-        bool measure(const std::string& utf8, float& outW, float& outH) const;
+        /**
+         * 텍스트 픽셀 크기(폭/높이)를 측정한다. 미초기화면 false.
+         * 처음 보는 글리프는 이때 아틀라스에 올라가므로 const가 아니다.
+         */
+        bool measure(const std::string& utf8, float& outW, float& outH, float pixelHeight = 0.0f);
 
         /**
          * `© OpenStreetMap contributors`를 화면 우하단에 반투명 배경과 함께 상시 표시.
@@ -68,27 +101,69 @@ namespace slippygl::render
         void drawAttribution(int fbW, int fbH);
 
     private:
-        // 한 정점: 화면 픽셀 좌표(x,y) + 아틀라스 UV(u,v)
-        struct Vert { float x, y, u, v; };
+        // 한 정점: 화면 픽셀 좌표(x,y) + 아틀라스 텍셀 좌표(u,v) + 색(RGBA8, 메모리 순서 r,g,b,a)
+        // u < 0이면 단색(텍스처 무시) 정점이다. UV를 텍셀로 두므로 아틀라스가 자라도 유효하다.
+        struct Vert { float x, y, u, v; std::uint32_t rgba; };
+
+        // 로드된 폰트 (stbtt_fontinfo는 구현 파일에서 정의)
+        struct Font;
+
+        // 아틀라스에 올라간 글리프. 좌표/크기는 기준 크기(baseSize_) 픽셀
+        struct Glyph
+        {
+            int font = -1;                  // fonts_ 인덱스. -1이면 어느 폰트에도 없음
+            int index = 0;                  // 폰트 내 글리프 인덱스 (커닝용)
+            int x = 0, y = 0, w = 0, h = 0; // 아틀라스 사각형(텍셀). w == 0이면 잉크 없음(공백 등)
+            float xoff = 0.0f;              // 펜 위치 → 사각형 좌상단
+            float yoff = 0.0f;
+            float advance = 0.0f;
+        };
+
+        // 베이스라인 원점 (0,0), 기준 크기로 셰이핑된 문자열 (정점 색은 비어 있음)
+        struct Layout
+        {
+            std::vector<Vert> verts;
+            glm::vec4 bbox{ 0.0f };   // 잉크 영역 minX, minY, maxX, maxY
+        };
+
+        static std::uint32_t packColor(const glm::vec4& c);
 
         // UTF-8 → 코드포인트 디코드 (1~4바이트)
         static std::vector<std::uint32_t> decodeUtf8(const std::string& s);
-        // 코드포인트 → 아틀라스 글리프 인덱스. 미지원이면 -1
-        int glyphIndex(std::uint32_t cp) const;
 
-        // 코드포인트열을 (originX, originBaselineY)에서 시작해 삼각형 정점으로 펼친다.
-        // bbox(minX,minY,maxX,maxY)를 갱신하고, 펜 진행 후 너비를 반환한다.
-        float buildQuads(const std::vector<std::uint32_t>& cps,
-                         float originX, float originBaselineY,
-                         std::vector<Vert>& out,
-                         glm::vec4& bbox) const;
+        // 코드포인트의 글리프. 처음이면 래스터해 아틀라스에 올린다 (없는 글리프도 캐시)
+        const Glyph& glyph(std::uint32_t cp);
+
+        // 코드포인트를 가진 폰트를 찾는다. 기본 폰트에 없으면 폴백 폰트를 한 번 로드해 본다.
+        bool findGlyph(std::uint32_t cp, int& font, int& index);
+        bool loadFont(const std::string& path);
 
-        void uploadAndDraw(const std::vector<Vert>& verts,
-                           const glm::vec4& color, bool solid,
-                           int fbW, int fbH);
+        // 아틀라스에 w×h 자리를 잡는다 (선반 패킹). 모자라면 높이를 두 배로 키운다.
+        bool allocate(int w, int h, int& x, int& y);
+        void uploadAtlas();
+
+        // 캐시된 레이아웃을 돌려준다. 없으면 셰이핑해서 넣는다.
+        const Layout& layout(const std::string& utf8);
+        void shape(const std::string& utf8, Layout& out);
+
+        // 기준 크기 레이아웃을 pixelHeight로 배율하고 (originX, originBaselineY)로 옮겨,
+        // 색을 입혀 pending_에 붙인다
+        void appendLayout(const Layout& l, float originX, float originBaselineY,
+                          float scale, std::uint32_t rgba);
+        // draw*의 pixelHeight(0 = 기본) → 레이아웃 배율
+        float layoutScale(float pixelHeight) const;
+
+        void appendRect(float x, float y, float w, float h, std::uint32_t rgba);
+
+        // 배치 중이 아니면 쌓인 정점을 바로 그린다
+        void submit(int fbW, int fbH);
+
+        // 스트리밍 VBO에 정점을 올리고 그린다. 용량을 넘으면 orphan 후 처음부터 쓴다.
+        void flush(int fbW, int fbH);
 
         bool compileShaders();
         static std::string findDefaultFontPath();
+        static std::string findFallbackFontPath();
 
         unsigned int vao_ = 0;
         unsigned int vbo_ = 0;
@@ -97,15 +172,39 @@ namespace slippygl::render
 
         int uProjLoc_ = -1;
         int uTexLoc_ = -1;
-        int uColorLoc_ = -1;
-        int uSolidLoc_ = -1;
+        int uSdfLoc_ = -1;
 
+        // 스트리밍 버퍼 상태 (정점 단위)
+        std::size_t vboCapacity_ = 0;
+        std::size_t vboOffset_ = 0;
+
+        std::vector<Vert> pending_;
+        bool batching_ = false;
+        int batchW_ = 0;
+        int batchH_ = 0;
+
+        GlyphMode mode_ = GlyphMode::kSdf;
+        float pixelHeight_ = 16.0f;   // draw* 기본 크기
+        float baseSize_ = 16.0f;      // 아틀라스에 구운 크기 (레이아웃 단위)
+
+        // 폰트 [0] = 기본, 이후 = 폴백
+        std::vector<std::unique_ptr<Font>> fonts_;
+        bool fallbackTried_ = false;
+
+        // 동적 아틀라스: CPU 사본(성장 시 재업로드용) + 선반 패커 상태
+        std::vector<unsigned char> atlasPixels_;
         int atlasW_ = 0;
         int atlasH_ = 0;
-        float pixelHeight_ = 16.0f;
+        int shelfX_ = 0;
+        int shelfY_ = 0;
+        int shelfH_ = 0;
+        bool atlasFullWarned_ = false;
+
+        std::unordered_map<std::uint32_t, Glyph> glyphs_;
 
-        // 베이크된 글리프 메타데이터(stbtt_packedchar). 불투명 포인터로 보관해
-        // 헤더에 stb_truetype 의존을 노출하지 않는다.
-        void* packed_ = nullptr;  // stbtt_packedchar[kGlyphCount]
+        // 문자열 → 레이아웃. 글리프 위치는 아틀라스가 자라도 바뀌지 않고 기준 크기도 init()에서만
+        // 바뀌므로(그때 비움) 키는 내용만으로 충분하다.
+        // 팬할 때마다 바뀌는 디버그 라벨로 무한히 자라지 않도록 상한을 넘으면 통째로 비운다.
+        std::unordered_map<std::string, Layout> layouts_;
     };
 }
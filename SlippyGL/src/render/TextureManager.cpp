@@ -1,6 +1,13 @@
 ﻿#include "TextureManager.hpp"
+#include "../core/Profiler.hpp"
 #include <glad/glad.h>
 #include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstring>
+
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT 0x83F0
+#endif
 
 namespace slippygl::render
 {
@@ -10,11 +17,51 @@ TextureManager::~TextureManager()
     destroyAll();
 }
 
-TexHandle TextureManager::createRGBA8(int w, int h, const std::uint8_t* pixels)
+TexHandle TextureManager::createRGBA8(int w, int h, const std::uint8_t* pixels, bool mipmaps)
+{
+    return upload(w, h, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, pixels, mipmaps, TexFormat::kRGBA8);
+}
+
+TexHandle TextureManager::createRGB(int w, int h, TexFormat format, const void* texels, bool mipmaps)
+{
+    if (format == TexFormat::kRGB565) {
+        return upload(w, h, GL_RGB565, GL_RGB, GL_UNSIGNED_SHORT_5_6_5, texels, mipmaps, format);
+    }
+    if (format == TexFormat::kRGB8) {
+        return upload(w, h, GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, texels, mipmaps, format);
+    }
+    spdlog::error("TextureManager: createRGB needs kRGB8 or kRGB565");
+    return 0;
+}
+
+TexHandle TextureManager::createIndexed8(int w, int h, const std::uint8_t* indices,
+                                         const std::uint8_t* palette, int paletteSize)
+{
+    if (w <= 0 || h <= 0 || !indices || !palette || paletteSize < 1 || paletteSize > std::min(w, 256)) {
+        spdlog::error("TextureManager: invalid indexed parameters (w={}, h={}, palette={})", w, h, paletteSize);
+        return 0;
+    }
+
+    // Indices on top, then one row per palette channel
+    const std::size_t imageBytes = static_cast<std::size_t>(w) * static_cast<std::size_t>(h);
+    std::vector<std::uint8_t> texels(imageBytes + static_cast<std::size_t>(w) * 4, 0);
+    std::memcpy(texels.data(), indices, imageBytes);
+    for (int i = 0; i < paletteSize; ++i) {
+        for (int c = 0; c < 4; ++c) {
+            texels[imageBytes + static_cast<std::size_t>(c) * w + i] = palette[i * 4 + c];
+        }
+    }
+    return upload(w, h + 4, GL_R8, GL_RED, GL_UNSIGNED_BYTE, texels.data(), false, TexFormat::kIndexed8);
+}
+
+TexHandle TextureManager::upload(int w, int h, unsigned int internalFormat, unsigned int format, unsigned int type,
+                                 const void* data, bool mipmaps, TexFormat texFormat)
 {
-    if (w <= 0 || h <= 0 || !pixels) {
+    SLIPPYGL_ZONE("gl.upload");
+
+    if (w <= 0 || h <= 0 || !data) {
         spdlog::error("TextureManager: invalid parameters (w={}, h={}, pixels={})", 
-                      w, h, pixels ? "valid" : "null");
+                      w, h, data ? "valid" : "null");
         return 0;
     }
 
@@ -27,7 +74,8 @@ TexHandle TextureManager::createRGBA8(int w, int h, const std::uint8_t* pixels)
 
     glBindTexture(GL_TEXTURE_2D, tex);
 
-    // Filtering: NEAREST for sharp tile map rendering
+    // Filtering: NEAREST for sharp tile map rendering. Minified draws bind a
+    // trilinear sampler instead, which overrides these parameters.
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
@@ -35,8 +83,13 @@ TexHandle TextureManager::createRGBA8(int w, int h, const std::uint8_t* pixels)
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-    // Upload texture data
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, w, h, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    // Upload texture data (RGB8 / R8 rows aren't 4-byte aligned for every width)
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(internalFormat), w, h, 0, format, type, data);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    if (mipmaps) {
+        glGenerateMipmap(GL_TEXTURE_2D);
+    }
 
     glBindTexture(GL_TEXTURE_2D, 0);
 
@@ -48,12 +101,86 @@ TexHandle TextureManager::createRGBA8(int w, int h, const std::uint8_t* pixels)
         return 0;
     }
 
-    textures_.insert(tex);
-    spdlog::debug("TextureManager: created texture {} ({}x{})", tex, w, h);
+    textures_[tex] = texFormat;
+    spdlog::debug("TextureManager: created texture {} ({}x{}, format {}{})", tex, w, h,
+                  static_cast<int>(texFormat), mipmaps ? ", mipmapped" : "");
 
     return tex;
 }
 
+TexHandle TextureManager::createBC1(int w, int h, const std::uint8_t* blocks, std::size_t size, int levels)
+{
+    SLIPPYGL_ZONE("gl.upload");
+
+    if (w <= 0 || h <= 0 || !blocks || levels < 1) {
+        spdlog::error("TextureManager: invalid BC1 parameters (w={}, h={}, levels={})", w, h, levels);
+        return 0;
+    }
+
+    GLuint tex = 0;
+    glGenTextures(1, &tex);
+    if (tex == 0) {
+        spdlog::error("TextureManager: glGenTextures failed");
+        return 0;
+    }
+
+    glBindTexture(GL_TEXTURE_2D, tex);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    // Levels are uploaded as given; cap the chain so a trilinear sampler sees a complete texture
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);
+
+    std::size_t offset = 0;
+    for (int level = 0, lw = w, lh = h; level < levels; ++level) {
+        const std::size_t bytes = static_cast<std::size_t>((lw + 3) / 4) * static_cast<std::size_t>((lh + 3) / 4) * 8;
+        if (offset + bytes > size) {
+            spdlog::error("TextureManager: BC1 data too short ({} bytes for {} levels of {}x{})", size, levels, w, h);
+            glBindTexture(GL_TEXTURE_2D, 0);
+            glDeleteTextures(1, &tex);
+            return 0;
+        }
+        glCompressedTexImage2D(GL_TEXTURE_2D, level, GL_COMPRESSED_RGB_S3TC_DXT1_EXT, lw, lh, 0,
+                               static_cast<GLsizei>(bytes), blocks + offset);
+        offset += bytes;
+        lw = std::max(1, lw / 2);
+        lh = std::max(1, lh / 2);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    GLenum err = glGetError();
+    if (err != GL_NO_ERROR) {
+        spdlog::error("TextureManager: OpenGL error {} (BC1 upload)", err);
+        glDeleteTextures(1, &tex);
+        return 0;
+    }
+
+    textures_[tex] = TexFormat::kBC1;
+    spdlog::debug("TextureManager: created BC1 texture {} ({}x{}, {} levels)", tex, w, h, levels);
+
+    return tex;
+}
+
+bool TextureManager::supportsBC1()
+{
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; ++i) {
+        const char* ext = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+        if (ext && std::strcmp(ext, "GL_EXT_texture_compression_s3tc") == 0) return true;
+    }
+    return false;
+}
+
+TexFormat TextureManager::format(TexHandle tex) const
+{
+    auto it = textures_.find(tex);
+    return it != textures_.end() ? it->second : TexFormat::kRGBA8;
+}
+
 void TextureManager::destroy(TexHandle tex)
 {
     if (tex == 0) return;
@@ -68,8 +195,8 @@ void TextureManager::destroy(TexHandle tex)
 
 void TextureManager::destroyAll()
 {
-    for (TexHandle tex : textures_) {
-        glDeleteTextures(1, &tex);
+    for (const auto& entry : textures_) {
+        glDeleteTextures(1, &entry.first);
     }
     spdlog::debug("TextureManager: destroyed {} textures", textures_.size());
     textures_.clear();
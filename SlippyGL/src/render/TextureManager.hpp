@@ -1,16 +1,32 @@
 ﻿#pragma once
+#include <cstddef>
 #include <cstdint>
 #include <vector>
-#include <unordered_set>
+#include <unordered_map>
 
 namespace slippygl::render 
 {
 	using TexHandle = unsigned int; // GLuint
 
+	/**
+	 * Texel storage of a texture
+	 */
+	enum class TexFormat : std::uint8_t
+	{
+		kRGBA8,     // 4 bytes per texel
+		kRGB8,      // 3 bytes uploaded; drivers pad to 4 in VRAM
+		kRGB565,    // 2 bytes per texel (lossy)
+		kIndexed8,  // R8 indices + 4 palette rows below the image, looked up in the shader
+		kBC1,       // 8 bytes per 4x4 block
+	};
+
 	/**
 	 * OpenGL texture manager
 	 * RGBA8 image -> texture create/destroy
 	 * CLAMP_TO_EDGE, NEAREST filtering (for sharp tile rendering)
+	 * Optional mip chain for minified drawing (sampled via QuadRenderer::setTrilinear)
+	 * BC1 (S3TC DXT1) upload of pre-compressed blocks where the GPU supports it
+	 * Remembers each texture's TexFormat (indexed textures draw differently)
 	 */
 	class TextureManager 
 	{
@@ -27,9 +43,54 @@ namespace slippygl::render
 		 * @param w Image width
 		 * @param h Image height
 		 * @param pixels RGBA8 pixel data (w*h*4 bytes)
+		 * @param mipmaps Build the mip chain (glGenerateMipmap); adds a third to the size
+		 * @return OpenGL texture handle (0 on failure)
+		 */
+		TexHandle createRGBA8(int w, int h, const std::uint8_t* pixels, bool mipmaps = false);
+
+		/**
+		 * Create texture from RGB8 (w*h*3 bytes) or RGB565 (w*h 16-bit texels) data
+		 * @param format TexFormat::kRGB8 or TexFormat::kRGB565
+		 * @param texels Row-major texel data, tightly packed
+		 * @param mipmaps Build the mip chain (glGenerateMipmap)
+		 * @return OpenGL texture handle (0 on failure)
+		 */
+		TexHandle createRGB(int w, int h, TexFormat format, const void* texels, bool mipmaps = false);
+
+		/**
+		 * Create an indexed texture: R8 of w x (h + 4), the image's indices on
+		 * top and the palette's R, G, B, A channels in the four rows below it
+		 * (entry i in column i). One texture handle per tile, like the other formats.
+		 * No mip chain: indices can't be filtered. Draw with QuadRenderer's indexed flag.
+		 * @param indices w*h bytes
+		 * @param palette paletteSize RGBA8 entries
+		 * @param paletteSize 1..256, at most w
+		 * @return OpenGL texture handle (0 on failure)
+		 */
+		TexHandle createIndexed8(int w, int h, const std::uint8_t* indices,
+		                         const std::uint8_t* palette, int paletteSize);
+
+		/**
+		 * Create texture from BC1 blocks (decode::Bc1Encoder output)
+		 * @param w Level 0 width
+		 * @param h Level 0 height
+		 * @param blocks Levels 0..levels-1 back to back, ((w+3)/4)*((h+3)/4)*8 bytes each
+		 * @param size Byte count of blocks
+		 * @param levels Number of mip levels in blocks (1 = no mipmaps)
 		 * @return OpenGL texture handle (0 on failure)
 		 */
-		TexHandle createRGBA8(int w, int h, const std::uint8_t* pixels);
+		TexHandle createBC1(int w, int h, const std::uint8_t* blocks, std::size_t size, int levels = 1);
+
+		/**
+		 * Whether the current context can sample BC1 textures
+		 * (GL_EXT_texture_compression_s3tc; not core in any GL version). Needs a current context.
+		 */
+		static bool supportsBC1();
+
+		/**
+		 * Storage format of a texture created here (kRGBA8 if unknown)
+		 */
+		TexFormat format(TexHandle tex) const;
 
 		/**
 		 * Destroy texture
@@ -42,6 +103,10 @@ namespace slippygl::render
 		void destroyAll();
 
 	private:
-		std::unordered_set<TexHandle> textures_;
+		// Shared glTexImage2D path (GLenum arguments)
+		TexHandle upload(int w, int h, unsigned int internalFormat, unsigned int format, unsigned int type,
+		                 const void* data, bool mipmaps, TexFormat texFormat);
+
+		std::unordered_map<TexHandle, TexFormat> textures_;
 	};
 }
@@ -0,0 +1,76 @@
+#include "ZoomBlend.hpp"
+#include "Camera2D.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace slippygl::render
+{
+
+void ZoomBlend::reset(int tileZoom) noexcept
+{
+    zoom_ = tileZoom;
+    fromZoom_ = -1;
+    blend_ = 1.0f;
+    elapsed_ = 0.0;
+}
+
+bool ZoomBlend::update(Camera2D& camera, int& tileZoom, int minZoom, int maxZoom) noexcept
+{
+    const int before = zoom_ < 0 ? tileZoom : zoom_;
+
+    const float up = static_cast<float>(std::exp2(kSwitchLog2));
+    const float down = static_cast<float>(std::exp2(-kSwitchLog2));
+    while (camera.scale() > up && tileZoom < maxZoom)
+    {
+        ++tileZoom;
+        camera.applyZoomStep(2.0);   // worldOrigin*2, scale/2
+    }
+    while (camera.scale() < down && tileZoom > minZoom)
+    {
+        --tileZoom;
+        camera.applyZoomStep(0.5);   // worldOrigin/2, scale*2
+    }
+
+    zoom_ = tileZoom;
+    if (tileZoom == before) return false;
+
+    if (fading() && tileZoom == fromZoom_)
+    {
+        // Back to the backdrop level mid-fade: swap roles, keep what is on screen
+        fromZoom_ = before;
+        blend_ = 1.0f - blend_;
+    }
+    else if (std::abs(tileZoom - before) == 1)
+    {
+        fromZoom_ = before;
+        blend_ = 0.0f;
+    }
+    else
+    {
+        // Multi-level jumps (fly-to, reset) have no useful backdrop
+        fromZoom_ = -1;
+        blend_ = 1.0f;
+    }
+    elapsed_ = 0.0;
+    return true;
+}
+
+void ZoomBlend::advance(double dt, double coverage) noexcept
+{
+    if (!fading()) return;
+
+    elapsed_ += dt;
+    const double limit = elapsed_ >= kMaxHoldSec ? 1.0 : std::clamp(coverage, 0.0, 1.0);
+    const double step = std::clamp(dt, 0.0, kMaxStepSec) / kFadeSec;
+    const double next = std::min(limit, static_cast<double>(blend_) + step);
+    blend_ = std::max(blend_, static_cast<float>(next));
+    if (blend_ >= 1.0f)
+    {
+        blend_ = 1.0f;
+        fromZoom_ = -1;
+    }
+}
+
+} // namespace slippygl::render
@@ -0,0 +1,63 @@
+#pragma once
+
+namespace slippygl::render
+{
+    class Camera2D;
+
+    /**
+     * Tile zoom level selection with hysteresis, plus cross-fade state.
+     *
+     * The camera zooms continuously; its scale is the residual between the
+     * fractional view zoom and the integer tile level. The level switches only
+     * once the residual passes 2^±kSwitchLog2, which leaves a band of
+     * 2 * (kSwitchLog2 - 0.5) zoom units where going back does not switch again,
+     * so wobbling around a threshold doesn't thrash the cache and the network.
+     *
+     * After a one-level switch the previous level stays on screen as a
+     * backdrop and the new level fades in over it. The fade (blend) advances
+     * with time but never gets ahead of the share of new-level tiles that have
+     * imagery, so it tracks tile arrival. It completes after kMaxHoldSec
+     * regardless, so a failed tile can't pin the backdrop forever.
+     */
+    class ZoomBlend
+    {
+    public:
+        static constexpr double kSwitchLog2 = 0.6;   // switch at scale > 1.52 or < 0.66
+        static constexpr double kFadeSec = 0.3;      // full fade when all tiles are ready
+        static constexpr double kMaxHoldSec = 2.0;   // finish the fade even if tiles are missing
+        static constexpr double kMaxStepSec = 0.1;   // dt cap (frames after an idle wait)
+
+        /**
+         * Start tracking at a level without a fade
+         */
+        void reset(int tileZoom) noexcept;
+
+        /**
+         * Pick the tile level for the camera's scale
+         * Remaps the camera for each switched level (Camera2D::applyZoomStep)
+         * so the view does not move. A level changed elsewhere since the last
+         * call (CameraPath::apply) is picked up the same way.
+         * @param tileZoom In/out tile zoom level of the app loop
+         * @return true if the level changed
+         */
+        bool update(Camera2D& camera, int& tileZoom, int minZoom, int maxZoom) noexcept;
+
+        /**
+         * Advance the fade
+         * @param dt Seconds since the previous call
+         * @param coverage Share [0,1] of visible current-level tiles that have imagery
+         */
+        void advance(double dt, double coverage) noexcept;
+
+        bool fading() const noexcept { return fromZoom_ >= 0; }
+        int fromZoom() const noexcept { return fromZoom_; }   // backdrop level, -1 when not fading
+        float blend() const noexcept { return blend_; }        // opacity of the current level
+
+    private:
+        int zoom_ = -1;
+        int fromZoom_ = -1;
+        float blend_ = 1.0f;
+        double elapsed_ = 0.0;
+    };
+
+} // namespace slippygl::render
@@ -0,0 +1,287 @@
+#include "PmTilesSource.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace slippygl::tile
+{
+namespace
+{
+    constexpr std::size_t kHeaderSize = 127;
+    constexpr int kMaxDirectoryDepth = 4;  // root + up to 3 leaf levels
+
+    std::uint64_t readU64(const std::uint8_t* p) noexcept
+    {
+        std::uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    // LEB128 unsigned varint. Returns false on truncated/overlong input.
+    bool readVarint(const std::uint8_t*& p, const std::uint8_t* end, std::uint64_t& out) noexcept
+    {
+        std::uint64_t v = 0;
+        for (int shift = 0; shift < 64 && p < end; shift += 7)
+        {
+            const std::uint8_t b = *p++;
+            v |= static_cast<std::uint64_t>(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+            {
+                out = v;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // gzip (RFC 1952) stream -> out. Output size is unknown, so grow as needed.
+    bool gunzip(core::ByteSpan in, std::vector<std::uint8_t>& out)
+    {
+        z_stream zs{};
+        if (inflateInit2(&zs, 16 + MAX_WBITS) != Z_OK) return false;
+
+        out.resize(std::max<std::size_t>(in.size() * 4, 4096));
+        zs.next_in = const_cast<Bytef*>(in.data());
+        zs.avail_in = static_cast<uInt>(in.size());
+
+        int rc = Z_OK;
+        while (rc == Z_OK)
+        {
+            if (zs.total_out == out.size()) out.resize(out.size() * 2);
+            zs.next_out = out.data() + zs.total_out;
+            zs.avail_out = static_cast<uInt>(out.size() - zs.total_out);
+            rc = inflate(&zs, Z_NO_FLUSH);
+        }
+        const bool ok = (rc == Z_STREAM_END);
+        out.resize(zs.total_out);
+        inflateEnd(&zs);
+        return ok;
+    }
+}
+
+std::uint64_t PmTilesSource::zxyToTileId(int z, int x, int y) noexcept
+{
+    // Tiles of all lower zoom levels come first: sum(4^i, i < z) = (4^z - 1) / 3
+    const std::uint64_t base = ((std::uint64_t{ 1 } << (2 * z)) - 1) / 3;
+
+    // Hilbert curve index of (x, y) within the 2^z x 2^z grid
+    std::uint64_t d = 0;
+    std::int64_t tx = x, ty = y;
+    for (std::int64_t s = (std::int64_t{ 1 } << z) / 2; s > 0; s /= 2)
+    {
+        const std::int64_t rx = (tx & s) > 0 ? 1 : 0;
+        const std::int64_t ry = (ty & s) > 0 ? 1 : 0;
+        d += static_cast<std::uint64_t>(s) * static_cast<std::uint64_t>(s)
+           * static_cast<std::uint64_t>((3 * rx) ^ ry);
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                tx = s - 1 - (tx & (s - 1));
+                ty = s - 1 - (ty & (s - 1));
+            }
+            std::swap(tx, ty);
+        }
+    }
+    return base + d;
+}
+
+bool PmTilesSource::open(const std::string& path, std::string* err)
+{
+    close();
+
+    if (!file_.open(path, err)) return false;
+
+    const auto fail = [&](const char* msg) {
+        if (err) *err = std::string(msg) + ": " + path;
+        close();
+        return false;
+    };
+
+    const core::ByteSpan bytes = file_.bytes();
+    if (bytes.size() < kHeaderSize) return fail("File too small for PMTiles header");
+
+    const std::uint8_t* h = bytes.data();
+    if (std::memcmp(h, "PMTiles", 7) != 0) return fail("Not a PMTiles archive");
+    if (h[7] != 3) return fail("Unsupported PMTiles version (need v3)");
+
+    rootDirOffset_  = readU64(h + 8);
+    rootDirLength_  = readU64(h + 16);
+    leafDirsOffset_ = readU64(h + 40);
+    leafDirsLength_ = readU64(h + 48);
+    tileDataOffset_ = readU64(h + 56);
+    tileDataLength_ = readU64(h + 64);
+    internalCompression_ = h[97];
+    tileCompression_     = h[98];
+    tileType_            = h[99];
+    minZoom_             = h[100];
+    maxZoom_             = h[101];
+
+    if (internalCompression_ != kCompressionNone && internalCompression_ != kCompressionGzip)
+        return fail("Unsupported PMTiles directory compression (need none or gzip)");
+
+    // Zero-copy spans are only possible when tiles are stored as-is
+    if (tileCompression_ != kCompressionNone && tileCompression_ != kCompressionUnknown)
+        return fail("Unsupported PMTiles tile compression (need none)");
+
+    if (bytes.subspan(tileDataOffset_, tileDataLength_).size() != tileDataLength_)
+        return fail("PMTiles tile data section out of bounds");
+    if (bytes.subspan(leafDirsOffset_, leafDirsLength_).size() != leafDirsLength_)
+        return fail("PMTiles leaf directory section out of bounds");
+
+    const core::ByteSpan rootRaw = bytes.subspan(rootDirOffset_, rootDirLength_);
+    if (rootRaw.empty()) return fail("PMTiles root directory out of bounds");
+
+    std::string dirErr;
+    if (!decodeDirectory(rootRaw, root_, &dirErr))
+    {
+        if (err) *err = dirErr + ": " + path;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void PmTilesSource::close() noexcept
+{
+    file_.close();
+    root_.clear();
+    leaves_.clear();
+    leafLru_.clear();
+    inflateBuf_.clear();
+    inflateBuf_.shrink_to_fit();
+}
+
+bool PmTilesSource::decodeDirectory(core::ByteSpan raw, Directory& out, std::string* err)
+{
+    out.clear();
+
+    if (internalCompression_ == kCompressionGzip)
+    {
+        if (!gunzip(raw, inflateBuf_))
+        {
+            if (err) *err = "Corrupt gzip directory";
+            return false;
+        }
+        raw = core::ByteSpan(inflateBuf_);
+    }
+
+    const std::uint8_t* p = raw.begin();
+    const std::uint8_t* end = raw.end();
+    const auto bad = [&]() {
+        if (err) *err = "Corrupt PMTiles directory";
+        out.clear();
+        return false;
+    };
+
+    std::uint64_t count = 0;
+    if (!readVarint(p, end, count)) return bad();
+    // Every entry needs at least 4 bytes, which bounds the allocation
+    if (count > raw.size()) return bad();
+    out.resize(static_cast<std::size_t>(count));
+
+    // Column layout: tileId deltas, run lengths, lengths, offsets
+    std::uint64_t lastId = 0;
+    for (auto& e : out)
+    {
+        std::uint64_t v = 0;
+        if (!readVarint(p, end, v)) return bad();
+        lastId += v;
+        e.tileId = lastId;
+    }
+    for (auto& e : out)
+    {
+        std::uint64_t v = 0;
+        if (!readVarint(p, end, v) || v > UINT32_MAX) return bad();
+        e.runLength = static_cast<std::uint32_t>(v);
+    }
+    for (auto& e : out)
+    {
+        std::uint64_t v = 0;
+        if (!readVarint(p, end, v) || v > UINT32_MAX) return bad();
+        e.length = static_cast<std::uint32_t>(v);
+    }
+    for (std::size_t i = 0; i < out.size(); ++i)
+    {
+        std::uint64_t v = 0;
+        if (!readVarint(p, end, v)) return bad();
+        // 0 = contiguous with the previous entry, otherwise offset + 1
+        if (v == 0 && i > 0) out[i].offset = out[i - 1].offset + out[i - 1].length;
+        else if (v == 0) return bad();
+        else out[i].offset = v - 1;
+    }
+    return true;
+}
+
+const PmTilesSource::DirEntry* PmTilesSource::findEntry(const Directory& dir, std::uint64_t tileId) noexcept
+{
+    // Last entry with entry.tileId <= tileId
+    auto it = std::upper_bound(dir.begin(), dir.end(), tileId,
+        [](std::uint64_t id, const DirEntry& e) { return id < e.tileId; });
+    if (it == dir.begin()) return nullptr;
+    --it;
+
+    // Leaf pointers cover everything up to the next entry
+    if (it->runLength == 0) return &*it;
+    if (tileId - it->tileId < it->runLength) return &*it;
+    return nullptr;
+}
+
+const PmTilesSource::Directory* PmTilesSource::leafDirectory(std::uint64_t offset, std::uint64_t length)
+{
+    auto it = leaves_.find(offset);
+    if (it != leaves_.end())
+    {
+        leafLru_.splice(leafLru_.begin(), leafLru_, it->second.lruIter);
+        return &it->second.dir;
+    }
+
+    const core::ByteSpan raw = file_.bytes()
+        .subspan(leafDirsOffset_, leafDirsLength_)
+        .subspan(offset, length);
+    if (raw.empty()) return nullptr;
+
+    Directory dir;
+    if (!decodeDirectory(raw, dir, nullptr)) return nullptr;
+
+    if (leaves_.size() >= kMaxCachedLeaves)
+    {
+        leaves_.erase(leafLru_.back());
+        leafLru_.pop_back();
+    }
+
+    leafLru_.push_front(offset);
+    LeafNode& node = leaves_[offset];
+    node.dir = std::move(dir);
+    node.lruIter = leafLru_.begin();
+    return &node.dir;
+}
+
+bool PmTilesSource::find(const TileKey& key, core::ByteSpan& out)
+{
+    if (!isOpen() || !key.isValid()) return false;
+    if (key.z < minZoom_ || key.z > maxZoom_) return false;
+
+    const std::uint64_t tileId = zxyToTileId(key.z, key.x, key.y);
+    const Directory* dir = &root_;
+
+    for (int depth = 0; depth < kMaxDirectoryDepth && dir; ++depth)
+    {
+        const DirEntry* e = findEntry(*dir, tileId);
+        if (!e) return false;
+
+        if (e->runLength > 0)
+        {
+            out = file_.bytes()
+                .subspan(tileDataOffset_, tileDataLength_)
+                .subspan(e->offset, e->length);
+            return !out.empty();
+        }
+        dir = leafDirectory(e->offset, e->length);
+    }
+    return false;
+}
+
+} // namespace slippygl::tile
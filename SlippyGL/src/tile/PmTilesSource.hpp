@@ -0,0 +1,120 @@
+#pragma once
+
+#include "TileSource.hpp"
+#include "../core/MappedFile.hpp"
+
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace slippygl::tile
+{
+    /**
+     * PMTiles v3 single-file archive reader
+     * - Memory-maps the archive; tile bytes are returned as spans into the map
+     * - Root directory is decoded once at open(); leaf directories are decoded
+     *   on first use and kept in a small LRU
+     * - Lookup: binary search per directory level (O(log n)), no syscalls
+     * - Internal compression: none or gzip. Tile compression must be none
+     *   (PNG/JPEG/WebP are already compressed) so spans can feed PngCodec directly
+     * - Thread-unsafe (single-threaded rendering assumed)
+     */
+    class PmTilesSource final : public TileSource
+    {
+    public:
+        /// Maximum number of decoded leaf directories kept in memory
+        static constexpr std::size_t kMaxCachedLeaves = 64;
+
+        PmTilesSource() = default;
+        ~PmTilesSource() override = default;
+
+        // Non-copyable
+        PmTilesSource(const PmTilesSource&) = delete;
+        PmTilesSource& operator=(const PmTilesSource&) = delete;
+
+        /**
+         * Map the archive and decode its header + root directory
+         * @param path Path to .pmtiles file
+         * @param err Error message on failure (can be nullptr)
+         * @return true on success
+         */
+        bool open(const std::string& path, std::string* err = nullptr);
+
+        /**
+         * Unmap the archive and drop cached directories
+         */
+        void close() noexcept;
+
+        bool isOpen() const noexcept { return file_.isOpen(); }
+
+        bool find(const TileKey& key, core::ByteSpan& out) override;
+
+        int minZoom() const noexcept override { return minZoom_; }
+        int maxZoom() const noexcept override { return maxZoom_; }
+
+        /// Tile type byte from the header (2 = PNG)
+        std::uint8_t tileType() const noexcept { return tileType_; }
+        std::size_t cachedLeafCount() const noexcept { return leaves_.size(); }
+
+        /**
+         * PMTiles tile ID: tiles of lower zooms first, then Hilbert order
+         * within the zoom level
+         */
+        static std::uint64_t zxyToTileId(int z, int x, int y) noexcept;
+
+        /// Header compression codes (PMTiles v3 spec)
+        enum Compression : std::uint8_t
+        {
+            kCompressionUnknown = 0,
+            kCompressionNone = 1,
+            kCompressionGzip = 2,
+            kCompressionBrotli = 3,
+            kCompressionZstd = 4
+        };
+
+    private:
+        struct DirEntry
+        {
+            std::uint64_t tileId = 0;
+            std::uint64_t offset = 0;
+            std::uint32_t length = 0;
+            std::uint32_t runLength = 0;  // 0 = pointer to a leaf directory
+        };
+        using Directory = std::vector<DirEntry>;
+
+        core::MappedFile file_;
+
+        std::uint64_t rootDirOffset_ = 0;
+        std::uint64_t rootDirLength_ = 0;
+        std::uint64_t leafDirsOffset_ = 0;
+        std::uint64_t leafDirsLength_ = 0;
+        std::uint64_t tileDataOffset_ = 0;
+        std::uint64_t tileDataLength_ = 0;
+        std::uint8_t internalCompression_ = kCompressionUnknown;
+        std::uint8_t tileCompression_ = kCompressionUnknown;
+        std::uint8_t tileType_ = 0;
+        int minZoom_ = 0;
+        int maxZoom_ = 0;
+
+        Directory root_;
+
+        // Leaf directory LRU: front = most recently used, keyed by leaf offset
+        std::list<std::uint64_t> leafLru_;
+        struct LeafNode
+        {
+            Directory dir;
+            std::list<std::uint64_t>::iterator lruIter;
+        };
+        std::unordered_map<std::uint64_t, LeafNode> leaves_;
+
+        // Scratch buffer for gzip-compressed directories
+        std::vector<std::uint8_t> inflateBuf_;
+
+        bool decodeDirectory(core::ByteSpan raw, Directory& out, std::string* err);
+        const Directory* leafDirectory(std::uint64_t offset, std::uint64_t length);
+        static const DirEntry* findEntry(const Directory& dir, std::uint64_t tileId) noexcept;
+    };
+
+} // namespace slippygl::tile
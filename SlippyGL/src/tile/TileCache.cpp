@@ -1,12 +1,13 @@
 #include "TileCache.hpp"
-#include <glad/glad.h>
+#include "../core/Profiler.hpp"
 #include <spdlog/spdlog.h>
 
 namespace slippygl::tile
 {
 
-TileCache::TileCache(std::size_t budgetBytes)
+TileCache::TileCache(std::size_t budgetBytes, TextureDeleter deleter)
     : budgetBytes_(budgetBytes)
+    , deleter_(std::move(deleter))
 {
     spdlog::info("TileCache initialized with {} MB budget", budgetBytes / (1024 * 1024));
 }
@@ -18,6 +19,8 @@ TileCache::~TileCache()
 
 bool TileCache::get(const TileKey& key, render::TexHandle& outTex)
 {
+    SLIPPYGL_ZONE("cache.get");
+
     auto it = cache_.find(key);
     if (it == cache_.end())
     {
@@ -37,18 +40,26 @@ bool TileCache::get(const TileKey& key, render::TexHandle& outTex)
     return true;
 }
 
-void TileCache::put(const TileKey& key, render::TexHandle tex, std::size_t sizeBytes)
+void TileCache::put(const TileKey& key, render::TexHandle tex, std::size_t sizeBytes, std::uint64_t contentHash)
 {
+    SLIPPYGL_ZONE("cache.put");
+
     // If already exists, remove old entry first
     auto it = cache_.find(key);
     if (it != cache_.end())
     {
-        usedBytes_ -= it->second.entry.sizeBytes;
+        release(it->second.entry);
         lruList_.erase(it->second.lruIter);
-        glDeleteTextures(1, &it->second.entry.texture);
         cache_.erase(it);
     }
 
+    // Content already resident under another texture (caller skipped putShared):
+    // keep this one private rather than track two textures for one hash
+    if (contentHash != 0 && shared_.count(contentHash) != 0)
+    {
+        contentHash = 0;
+    }
+
     // Evict if needed before adding new entry
     evictIfNeeded(budgetBytes_ - sizeBytes);
 
@@ -59,10 +70,18 @@ void TileCache::put(const TileKey& key, render::TexHandle tex, std::size_t sizeB
     node.entry.texture = tex;
     node.entry.sizeBytes = sizeBytes;
     node.entry.lastUsed = std::chrono::steady_clock::now();
+    node.entry.contentHash = contentHash;
     node.lruIter = lruList_.begin();
     
     cache_[key] = std::move(node);
     usedBytes_ += sizeBytes;
+    ++generation_;
+
+    if (contentHash != 0)
+    {
+        shared_[contentHash] = SharedTexture{ tex, sizeBytes, 1 };
+        ++sharedRefs_;
+    }
 
     spdlog::debug("TileCache: put {} ({} KB), total {} MB / {} MB",
         key.toString(), 
@@ -71,6 +90,43 @@ void TileCache::put(const TileKey& key, render::TexHandle tex, std::size_t sizeB
         budgetBytes_ / (1024 * 1024));
 }
 
+bool TileCache::putShared(const TileKey& key, std::uint64_t contentHash, render::TexHandle& outTex)
+{
+    if (contentHash == 0) return false;
+    auto shared = shared_.find(contentHash);
+    if (shared == shared_.end()) return false;
+
+    // Take the reference first: key's old entry may hold this same texture
+    ++shared->second.refs;
+    const SharedTexture tex = shared->second;
+
+    auto it = cache_.find(key);
+    if (it != cache_.end())
+    {
+        release(it->second.entry);
+        lruList_.erase(it->second.lruIter);
+        cache_.erase(it);
+    }
+
+    lruList_.push_front(key);
+
+    CacheNode node;
+    node.entry.texture = tex.texture;
+    node.entry.sizeBytes = tex.sizeBytes;
+    node.entry.lastUsed = std::chrono::steady_clock::now();
+    node.entry.contentHash = contentHash;
+    node.lruIter = lruList_.begin();
+
+    cache_[key] = std::move(node);
+    ++sharedRefs_;
+    ++generation_;
+
+    spdlog::debug("TileCache: {} shares a resident texture ({} keys)", key.toString(), tex.refs);
+
+    outTex = tex.texture;
+    return true;
+}
+
 bool TileCache::contains(const TileKey& key) const
 {
     return cache_.find(key) != cache_.end();
@@ -93,18 +149,25 @@ void TileCache::clear()
 {
     for (auto& [key, node] : cache_)
     {
-        if (node.entry.texture != 0)
+        if (node.entry.contentHash == 0)
         {
-            glDeleteTextures(1, &node.entry.texture);
+            destroyTexture(node.entry.texture);
         }
     }
+    for (auto& [hash, shared] : shared_)
+    {
+        destroyTexture(shared.texture);
+    }
     
     spdlog::info("TileCache: cleared {} entries, freed {} MB",
         cache_.size(), usedBytes_ / (1024 * 1024));
 
     cache_.clear();
     lruList_.clear();
+    shared_.clear();
+    sharedRefs_ = 0;
     usedBytes_ = 0;
+    ++generation_;
 }
 
 void TileCache::moveToFront(const TileKey& key)
@@ -131,17 +194,40 @@ void TileCache::evictOne()
         spdlog::debug("TileCache: evicting {} ({} KB)",
             lruKey.toString(), it->second.entry.sizeBytes / 1024);
 
-        // Delete OpenGL texture
-        if (it->second.entry.texture != 0)
-        {
-            glDeleteTextures(1, &it->second.entry.texture);
-        }
-
-        usedBytes_ -= it->second.entry.sizeBytes;
+        // Free the texture (shared ones with their last key)
+        release(it->second.entry);
         cache_.erase(it);
+        ++generation_;
     }
 
     lruList_.pop_back();
 }
 
+void TileCache::release(const CacheEntry& entry)
+{
+    if (entry.contentHash != 0)
+    {
+        --sharedRefs_;
+        auto shared = shared_.find(entry.contentHash);
+        if (shared != shared_.end() && --shared->second.refs == 0)
+        {
+            destroyTexture(shared->second.texture);
+            usedBytes_ -= shared->second.sizeBytes;
+            shared_.erase(shared);
+        }
+        return;
+    }
+
+    destroyTexture(entry.texture);
+    usedBytes_ -= entry.sizeBytes;
+}
+
+void TileCache::destroyTexture(render::TexHandle tex)
+{
+    if (tex != 0 && deleter_)
+    {
+        deleter_(tex);
+    }
+}
+
 } // namespace slippygl::tile
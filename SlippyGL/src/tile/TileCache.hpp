@@ -2,10 +2,12 @@
 
 #include "TileKey.hpp"
 #include "../render/TextureManager.hpp"
+#include <algorithm>
 #include <unordered_map>
 #include <list>
 #include <cstdint>
 #include <chrono>
+#include <functional>
 
 namespace slippygl::tile
 {
@@ -17,12 +19,17 @@ namespace slippygl::tile
         render::TexHandle texture = 0;
         std::size_t sizeBytes = 0;
         std::chrono::steady_clock::time_point lastUsed;
+        std::uint64_t contentHash = 0;   // != 0: texture shared by all keys with this content
     };
 
     /**
      * LRU texture cache for map tiles
      * - Stores OpenGL textures by TileKey
      * - Evicts least recently used entries when budget exceeded
+     * - Keys whose fetched bytes are identical (ocean, empty land) can share
+     *   one reference-counted texture, counted once against the budget
+     * - Evicted textures go back through the deleter of whoever created them,
+     *   so TextureManager's format table never outlives a GL name
      * - Thread-unsafe (single-threaded rendering assumed)
      */
     class TileCache
@@ -31,7 +38,15 @@ namespace slippygl::tile
         /// Default cache budget: 128 MB
         static constexpr std::size_t kDefaultBudgetBytes = 128 * 1024 * 1024;
 
-        explicit TileCache(std::size_t budgetBytes = kDefaultBudgetBytes);
+        /// Frees one texture the cache owned (typically TextureManager::destroy)
+        using TextureDeleter = std::function<void(render::TexHandle)>;
+
+        /**
+         * @param budgetBytes Texture memory budget
+         * @param deleter Called once per texture when its last key leaves the cache;
+         *                null = textures aren't freed (bookkeeping only, e.g. handle 0)
+         */
+        explicit TileCache(std::size_t budgetBytes = kDefaultBudgetBytes, TextureDeleter deleter = nullptr);
         ~TileCache();
 
         // Non-copyable
@@ -51,8 +66,20 @@ namespace slippygl::tile
          * @param key Tile key
          * @param tex Texture handle (cache takes ownership)
          * @param sizeBytes Texture memory size in bytes
+         * @param contentHash Hash of the tile's source bytes (core::ContentHash),
+         *                    0 = don't share. Later keys with the same hash can
+         *                    reuse tex through putShared().
+         */
+        void put(const TileKey& key, render::TexHandle tex, std::size_t sizeBytes, std::uint64_t contentHash = 0);
+
+        /**
+         * Cache key as another reference to the resident texture with this content
+         * No upload and no extra bytes; the texture is freed once its last key is evicted.
+         * @param contentHash Hash passed to put() for the original tile (0 never matches)
+         * @param outTex Shared texture handle
+         * @return true if shared, false if no resident tile has this content
          */
-        void put(const TileKey& key, render::TexHandle tex, std::size_t sizeBytes);
+        bool putShared(const TileKey& key, std::uint64_t contentHash, render::TexHandle& outTex);
 
         /**
          * Check if tile is in cache (without updating LRU)
@@ -74,11 +101,68 @@ namespace slippygl::tile
          * Get current cache statistics
          */
         std::size_t size() const noexcept { return cache_.size(); }
+        std::size_t textureCount() const noexcept { return cache_.size() - sharedRefs_ + shared_.size(); }
         std::size_t usedBytes() const noexcept { return usedBytes_; }
         std::size_t budgetBytes() const noexcept { return budgetBytes_; }
         std::size_t hitCount() const noexcept { return hitCount_; }
         std::size_t missCount() const noexcept { return missCount_; }
 
+        /**
+         * Resident-set version
+         * Bumped whenever a tile is added or removed, so the render loop can
+         * tell whether anything new became drawable since its last frame.
+         */
+        std::uint64_t generation() const noexcept { return generation_; }
+
+        /**
+         * GPU memory of a texture, for sizeBytes in put()
+         * A full mip chain adds the 1/4 + 1/16 + ... levels, about a third more.
+         */
+        static constexpr std::size_t textureBytes(int w, int h, int bytesPerPixel, bool mipmaps) noexcept
+        {
+            std::size_t total = 0;
+            while (w > 0 && h > 0)
+            {
+                total += static_cast<std::size_t>(w) * static_cast<std::size_t>(h) * static_cast<std::size_t>(bytesPerPixel);
+                if (!mipmaps || (w == 1 && h == 1)) break;
+                w = std::max(1, w / 2);
+                h = std::max(1, h / 2);
+            }
+            return total;
+        }
+
+        /**
+         * GPU memory of a texture in a given storage format
+         * RGB8 counts 4 bytes per texel (drivers pad it); indexed textures carry
+         * four palette rows and no mips; BC1 rounds each level up to 4x4 blocks.
+         */
+        static constexpr std::size_t textureBytes(int w, int h, render::TexFormat format, bool mipmaps) noexcept
+        {
+            switch (format)
+            {
+            case render::TexFormat::kRGB565:
+                return textureBytes(w, h, 2, mipmaps);
+            case render::TexFormat::kIndexed8:
+                return textureBytes(w, h + 4, 1, false);
+            case render::TexFormat::kBC1:
+            {
+                std::size_t total = 0;
+                while (w > 0 && h > 0)
+                {
+                    total += static_cast<std::size_t>((w + 3) / 4) * static_cast<std::size_t>((h + 3) / 4) * 8;
+                    if (!mipmaps || (w == 1 && h == 1)) break;
+                    w = std::max(1, w / 2);
+                    h = std::max(1, h / 2);
+                }
+                return total;
+            }
+            case render::TexFormat::kRGBA8:
+            case render::TexFormat::kRGB8:
+                break;
+            }
+            return textureBytes(w, h, 4, mipmaps);
+        }
+
         /**
          * Reset hit/miss counters
          */
@@ -86,9 +170,11 @@ namespace slippygl::tile
 
     private:
         std::size_t budgetBytes_;
+        TextureDeleter deleter_;
         std::size_t usedBytes_ = 0;
         std::size_t hitCount_ = 0;
         std::size_t missCount_ = 0;
+        std::uint64_t generation_ = 0;
 
         // LRU list: front = most recently used, back = least recently used
         std::list<TileKey> lruList_;
@@ -101,8 +187,22 @@ namespace slippygl::tile
         };
         std::unordered_map<TileKey, CacheNode> cache_;
 
+        // Content hash -> texture referenced by every entry with that hash
+        struct SharedTexture
+        {
+            render::TexHandle texture = 0;
+            std::size_t sizeBytes = 0;
+            int refs = 0;
+        };
+        std::unordered_map<std::uint64_t, SharedTexture> shared_;
+        std::size_t sharedRefs_ = 0;   // entries in cache_ with a content hash
+
         void moveToFront(const TileKey& key);
         void evictOne();
+        void destroyTexture(render::TexHandle tex);
+
+        // Drop one entry's hold on its texture (deletes it and frees its bytes when last)
+        void release(const CacheEntry& entry);
     };
 
 } // namespace slippygl::tile
@@ -1,5 +1,6 @@
 #include "TileDownloader.hpp"
 #include <spdlog/spdlog.h>
+#include <chrono>
 
 namespace slippygl::tile {
 
@@ -8,13 +9,25 @@ TileDownloader::TileDownloader(slippygl::net::HttpClient& http,
 : http_(http), ep_(endpoint)
 {}
 
-FetchResult TileDownloader::ensureRaster(const slippygl::core::TileID& id)
+FetchResult TileDownloader::ensureRaster(const slippygl::core::TileID& id,
+                                         slippygl::net::BodySink* sink)
 {
     FetchResult r;
 
     // Network download (no disk cache — OSM policy).
-    const std::string url = ep_.rasterUrl(id);
-    const auto resp = http_.get(url);
+    // 호스트 샤딩: 선택된 미러의 지연/실패를 endpoint에 되돌려 가중치를 갱신
+    const auto target = ep_.resolveRaster(id);
+    const std::string& url = target.url;
+    // 지연은 미러의 전송 시간만: governor 대기와 재시도 백오프는 제외한다.
+    // 연결조차 못 한 실패는 전송 시간이 0이라 벽시계 시간으로 대신한다.
+    const auto t0 = std::chrono::steady_clock::now();
+    const auto resp = http_.get(url, nullptr, nullptr, sink);
+    const double transferMs = resp.timings().totalMs;
+    const double ms = transferMs > 0.0
+        ? transferMs
+        : std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+    const bool healthy = resp.status() != 0 && resp.status() != 429 && resp.status() < 500;
+    ep_.report(target.host, ms, healthy);
 
     r.httpStatus   = resp.status();
     r.effectiveUrl = resp.effectiveUrl();
@@ -40,7 +40,9 @@ public:
 		slippygl::net::TileEndpoint& endpoint);
 
 	// Download the tile PNG over HTTP. No caching at this layer.
-	FetchResult ensureRaster(const slippygl::core::TileID& id);
+	// An optional sink receives the body while it downloads (streaming decode).
+	FetchResult ensureRaster(const slippygl::core::TileID& id,
+		slippygl::net::BodySink* sink = nullptr);
 
 private:
 	slippygl::net::HttpClient& http_;
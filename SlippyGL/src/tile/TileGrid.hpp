@@ -2,6 +2,7 @@
 
 #include "TileKey.hpp"
 #include "../render/Camera2D.hpp"
+#include <algorithm>
 #include <vector>
 #include <cmath>
 
@@ -9,20 +10,32 @@ namespace slippygl::tile
 {
     /**
      * Visible tile range for a viewport
+     * X wraps around the antimeridian: minX/maxX are unwrapped columns, so
+     * values outside [0, 2^zoom - 1] are copies of the world to the left or
+     * right. TileGrid::spans() splits the range into real tile columns.
      */
     struct VisibleTileRange
     {
         int zoom = 0;
-        int minX = 0, maxX = 0;  // Inclusive tile X range
+        int minX = 0, maxX = 0;  // Inclusive tile X range (unwrapped)
         int minY = 0, maxY = 0;  // Inclusive tile Y range
 
-        /// Total number of visible tiles
+        /// Total number of visible tiles (world copies counted each time they're drawn)
         int tileCount() const noexcept
         {
             return (maxX - minX + 1) * (maxY - minY + 1);
         }
     };
 
+    /**
+     * Run of visible tile columns inside one copy of the world
+     */
+    struct VisibleSpan
+    {
+        int minX = 0, maxX = 0;  // Inclusive tile X range, within [0, 2^zoom - 1]
+        int worldCopy = 0;       // Drawn this many world widths right of the real world (negative: left)
+    };
+
     /**
      * Computes visible tile grid from camera and viewport
      */
@@ -61,8 +74,8 @@ namespace slippygl::tile
             range.zoom = zoom;
 
             // Screen corners to world coordinates
-            const glm::vec2 topLeft = camera.screenToWorld(0.0f, 0.0f);
-            const glm::vec2 bottomRight = camera.screenToWorld(
+            const glm::dvec2 topLeft = camera.screenToWorld(0.0f, 0.0f);
+            const glm::dvec2 bottomRight = camera.screenToWorld(
                 static_cast<float>(fbW), 
                 static_cast<float>(fbH)
             );
@@ -73,42 +86,76 @@ namespace slippygl::tile
             const int rawMinY = TileCoord::worldPxToTileIndex(topLeft.y, tileSizePx);
             const int rawMaxY = TileCoord::worldPxToTileIndex(bottomRight.y, tileSizePx);
 
-            // Clamp every index to [0, 2^zoom - 1]. Clamping BOTH ends (not just
-            // min-with-0 and max-with-maxIdx) prevents an inverted minX>maxX
-            // range, which would silently render zero tiles. (no wrapping yet)
-            range.minX = TileCoord::clampTileIndex(rawMinX, zoom);
-            range.maxX = TileCoord::clampTileIndex(rawMaxX, zoom);
+            // X repeats the world, so it stays unwrapped (see spans()). Y is
+            // clamped to [0, 2^zoom - 1] at BOTH ends (not just min-with-0 and
+            // max-with-maxIdx), which prevents an inverted minY>maxY range that
+            // would silently render zero tiles.
+            range.minX = rawMinX;
+            range.maxX = rawMaxX;
             range.minY = TileCoord::clampTileIndex(rawMinY, zoom);
             range.maxY = TileCoord::clampTileIndex(rawMaxY, zoom);
 
             return range;
         }
 
+        /**
+         * Split a range's columns by world copy, left to right
+         * Usually one span, two across the antimeridian; at zoom 0-3 a viewport
+         * wider than the world gets one per copy, all naming the same tiles.
+         */
+        static std::vector<VisibleSpan> spans(const VisibleTileRange& range)
+        {
+            std::vector<VisibleSpan> out;
+            const int worldTiles = 1 << range.zoom;
+            for (int x = range.minX; x <= range.maxX;)
+            {
+                VisibleSpan span;
+                span.minX = TileCoord::wrapTileIndex(x, range.zoom);
+                span.worldCopy = (x - span.minX) / worldTiles;
+                span.maxX = std::min(worldTiles - 1, span.minX + (range.maxX - x));
+                out.push_back(span);
+                x += span.maxX - span.minX + 1;
+            }
+            return out;
+        }
+
         /**
          * Convert range to vector of TileKeys
+         * Each tile appears once, however many world copies show it.
          */
         static std::vector<TileKey> rangeToKeys(const VisibleTileRange& range)
         {
+            const int worldTiles = 1 << range.zoom;
+            const int columns = std::min(range.maxX - range.minX + 1, worldTiles);
+
             std::vector<TileKey> keys;
-            keys.reserve(range.tileCount());
+            keys.reserve(static_cast<std::size_t>(columns) * (range.maxY - range.minY + 1));
 
             for (int y = range.minY; y <= range.maxY; ++y)
             {
-                for (int x = range.minX; x <= range.maxX; ++x)
+                for (int x = range.minX; x < range.minX + columns; ++x)
                 {
-                    keys.emplace_back(range.zoom, x, y);
+                    keys.emplace_back(range.zoom, TileCoord::wrapTileIndex(x, range.zoom), y);
                 }
             }
 
             return keys;
         }
 
+        /**
+         * World pixel width of one world copy at zoom (2^zoom tiles)
+         */
+        static double worldWidthPx(int zoom, int tileSizePx = kTileSizePx)
+        {
+            return std::ldexp(static_cast<double>(tileSizePx), zoom);
+        }
+
         /**
          * Calculate world pixel position of a tile's top-left corner
          */
-        static glm::vec2 tileWorldPosition(const TileKey& key, int tileSizePx = kTileSizePx)
+        static glm::dvec2 tileWorldPosition(const TileKey& key, int tileSizePx = kTileSizePx)
         {
-            return glm::vec2(
+            return glm::dvec2(
                 TileCoord::tileIndexToWorldPx(key.x, tileSizePx),
                 TileCoord::tileIndexToWorldPx(key.y, tileSizePx)
             );
@@ -66,6 +66,7 @@ namespace slippygl::tile
     /**
      * Coordinate conversion utilities for tile mapping
      * All functions use Y-down coordinate system
+     * World pixels are doubles: float can't address single pixels past z16
      */
     namespace TileCoord
     {
@@ -75,9 +76,9 @@ namespace slippygl::tile
          * @param tileSizePx Tile size in pixels (default 256)
          * @return Tile index
          */
-        inline int worldPxToTileIndex(float worldPx, int tileSizePx = kTileSizePx)
+        inline int worldPxToTileIndex(double worldPx, int tileSizePx = kTileSizePx)
         {
-            return static_cast<int>(std::floor(worldPx / static_cast<float>(tileSizePx)));
+            return static_cast<int>(std::floor(worldPx / static_cast<double>(tileSizePx)));
         }
 
         /**
@@ -86,9 +87,9 @@ namespace slippygl::tile
          * @param tileSizePx Tile size in pixels
          * @return Pixel offset within tile (0 to tileSizePx-1)
          */
-        inline float worldPxToTileOffset(float worldPx, int tileSizePx = kTileSizePx)
+        inline double worldPxToTileOffset(double worldPx, int tileSizePx = kTileSizePx)
         {
-            float tilePx = std::floor(worldPx / static_cast<float>(tileSizePx)) * tileSizePx;
+            const double tilePx = std::floor(worldPx / static_cast<double>(tileSizePx)) * tileSizePx;
             return worldPx - tilePx;
         }
 
@@ -98,9 +99,9 @@ namespace slippygl::tile
          * @param tileSizePx Tile size in pixels
          * @return World pixel coordinate of tile's top-left corner
          */
-        inline float tileIndexToWorldPx(int tileIndex, int tileSizePx = kTileSizePx)
+        inline double tileIndexToWorldPx(int tileIndex, int tileSizePx = kTileSizePx)
         {
-            return static_cast<float>(tileIndex * tileSizePx);
+            return static_cast<double>(tileIndex) * tileSizePx;
         }
 
         /**
@@ -116,16 +117,29 @@ namespace slippygl::tile
             if (index > maxIdx) return maxIdx;
             return index;
         }
+
+        /**
+         * Wrap a tile column around the antimeridian
+         * @param index Tile X index, any integer (columns past either edge repeat the world)
+         * @param zoom Zoom level
+         * @return Index in 0 to 2^zoom - 1
+         */
+        inline int wrapTileIndex(int index, int zoom)
+        {
+            const int n = 1 << zoom;
+            const int m = index % n;
+            return m < 0 ? m + n : m;
+        }
     }
 
     /**
      * Convert TileKey to world pixel coordinate (top-left of tile)
      * @param key TileKey with z, x, y
-     * @return World pixel coordinate of tile's top-left corner as glm::vec2
+     * @return World pixel coordinate of tile's top-left corner
      */
-    inline glm::vec2 tileToWorldPixel(const TileKey& key)
+    inline glm::dvec2 tileToWorldPixel(const TileKey& key)
     {
-        return glm::vec2(
+        return glm::dvec2(
             TileCoord::tileIndexToWorldPx(key.x),
             TileCoord::tileIndexToWorldPx(key.y)
         );
@@ -137,7 +151,7 @@ namespace slippygl::tile
      * @param zoom Zoom level
      * @return TileKey for the tile containing the pixel
      */
-    inline TileKey worldPixelToTile(const glm::vec2& worldPx, int zoom)
+    inline TileKey worldPixelToTile(const glm::dvec2& worldPx, int zoom)
     {
         return TileKey(
             zoom,
@@ -0,0 +1,208 @@
+#include "TilePack.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace slippygl::tile
+{
+namespace
+{
+    std::uint64_t loadU64(const std::uint8_t* p) noexcept
+    {
+        std::uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    std::uint32_t loadU32(const std::uint8_t* p) noexcept
+    {
+        return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8)
+             | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+    }
+
+    void storeU64(std::uint8_t* p, std::uint64_t v) noexcept
+    {
+        for (int i = 0; i < 8; ++i) p[i] = static_cast<std::uint8_t>(v >> (8 * i));
+    }
+
+    void storeU32(std::uint8_t* p, std::uint32_t v) noexcept
+    {
+        for (int i = 0; i < 4; ++i) p[i] = static_cast<std::uint8_t>(v >> (8 * i));
+    }
+}
+
+// ==== TilePackWriter ====
+
+bool TilePackWriter::open(const std::string& path, std::string* err)
+{
+    out_.open(path, std::ios::binary | std::ios::trunc);
+    if (!out_)
+    {
+        if (err) *err = "Cannot create pack file: " + path;
+        return false;
+    }
+
+    // Placeholder header; rewritten by finish()
+    const std::uint8_t zeros[TilePack::kHeaderSize] = {};
+    out_.write(reinterpret_cast<const char*>(zeros), sizeof(zeros));
+    writePos_ = TilePack::kHeaderSize;
+    entries_.clear();
+    minZoom_ = 255;
+    maxZoom_ = 0;
+    return static_cast<bool>(out_);
+}
+
+bool TilePackWriter::add(const TileKey& key, const std::uint8_t* data, std::size_t size, std::string* err)
+{
+    if (!out_.is_open())
+    {
+        if (err) *err = "Pack writer not open";
+        return false;
+    }
+    if (!key.isValid())
+    {
+        if (err) *err = "Invalid tile key " + key.toString();
+        return false;
+    }
+    if (size == 0 || size > TilePack::kMaxTileBytes)
+    {
+        if (err) *err = "Tile " + key.toString() + " has unsupported size " + std::to_string(size);
+        return false;
+    }
+
+    out_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    if (!out_)
+    {
+        if (err) *err = "Write failed for tile " + key.toString();
+        return false;
+    }
+
+    entries_.push_back({ TilePack::packKey(key), (writePos_ << 24) | size });
+    writePos_ += size;
+    minZoom_ = std::min(minZoom_, key.z);
+    maxZoom_ = std::max(maxZoom_, key.z);
+    return true;
+}
+
+bool TilePackWriter::finish(std::string* err)
+{
+    if (!out_.is_open())
+    {
+        if (err) *err = "Pack writer not open";
+        return false;
+    }
+
+    std::sort(entries_.begin(), entries_.end(),
+        [](const IndexEntry& a, const IndexEntry& b) { return a.key < b.key; });
+
+    const auto dup = std::adjacent_find(entries_.begin(), entries_.end(),
+        [](const IndexEntry& a, const IndexEntry& b) { return a.key == b.key; });
+    if (dup != entries_.end())
+    {
+        if (err) *err = "Duplicate tile " + TilePack::unpackKey(dup->key).toString();
+        out_.close();
+        return false;
+    }
+
+    // Align index to 8 bytes
+    const std::uint64_t pad = (8 - (writePos_ % 8)) % 8;
+    const char zeros[8] = {};
+    out_.write(zeros, static_cast<std::streamsize>(pad));
+    const std::uint64_t indexOffset = writePos_ + pad;
+
+    std::vector<std::uint8_t> buf(entries_.size() * 8);
+    for (std::size_t i = 0; i < entries_.size(); ++i) storeU64(&buf[i * 8], entries_[i].key);
+    out_.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+    for (std::size_t i = 0; i < entries_.size(); ++i) storeU64(&buf[i * 8], entries_[i].location);
+    out_.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+
+    std::uint8_t header[TilePack::kHeaderSize] = {};
+    std::memcpy(header, TilePack::kMagic, sizeof(TilePack::kMagic));
+    storeU32(header + 8, TilePack::kVersion);
+    storeU32(header + 12, static_cast<std::uint32_t>(entries_.size()));
+    header[16] = static_cast<std::uint8_t>(entries_.empty() ? 0 : minZoom_);
+    header[17] = static_cast<std::uint8_t>(maxZoom_);
+    storeU64(header + 24, indexOffset);
+    out_.seekp(0);
+    out_.write(reinterpret_cast<const char*>(header), sizeof(header));
+
+    out_.close();
+    if (out_.fail())
+    {
+        if (err) *err = "Failed to finalize pack file";
+        return false;
+    }
+    return true;
+}
+
+// ==== TilePackSource ====
+
+bool TilePackSource::open(const std::string& path, std::string* err)
+{
+    close();
+
+    if (!file_.open(path, err)) return false;
+
+    const auto fail = [&](const char* msg) {
+        if (err) *err = std::string(msg) + ": " + path;
+        close();
+        return false;
+    };
+
+    const core::ByteSpan bytes = file_.bytes();
+    if (bytes.size() < TilePack::kHeaderSize) return fail("File too small for tile pack header");
+
+    const std::uint8_t* h = bytes.data();
+    if (std::memcmp(h, TilePack::kMagic, sizeof(TilePack::kMagic)) != 0) return fail("Not a tile pack");
+    if (loadU32(h + 8) != TilePack::kVersion) return fail("Unsupported tile pack version");
+
+    const std::uint64_t count = loadU32(h + 12);
+    const std::uint64_t indexOffset = loadU64(h + 24);
+    if (bytes.subspan(indexOffset, count * 16).size() != count * 16)
+        return fail("Tile pack index out of bounds");
+
+    count_ = static_cast<std::size_t>(count);
+    minZoom_ = h[16];
+    maxZoom_ = h[17];
+    keys_ = h + indexOffset;
+    locations_ = keys_ + count_ * 8;
+    return true;
+}
+
+void TilePackSource::close() noexcept
+{
+    file_.close();
+    keys_ = nullptr;
+    locations_ = nullptr;
+    count_ = 0;
+}
+
+bool TilePackSource::find(const TileKey& key, core::ByteSpan& out)
+{
+    if (!isOpen() || !key.isValid()) return false;
+
+    const std::uint64_t target = TilePack::packKey(key);
+
+    // lower_bound over the mapped key array
+    std::size_t lo = 0, n = count_;
+    while (n > 0)
+    {
+        const std::size_t half = n / 2;
+        if (loadU64(keys_ + (lo + half) * 8) < target)
+        {
+            lo += half + 1;
+            n -= half + 1;
+        }
+        else
+        {
+            n = half;
+        }
+    }
+    if (lo == count_ || loadU64(keys_ + lo * 8) != target) return false;
+
+    const std::uint64_t loc = loadU64(locations_ + lo * 8);
+    out = file_.bytes().subspan(loc >> 24, loc & TilePack::kMaxTileBytes);
+    return !out.empty();
+}
+
+} // namespace slippygl::tile
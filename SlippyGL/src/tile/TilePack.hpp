@@ -0,0 +1,131 @@
+#pragma once
+
+#include "TileSource.hpp"
+#include "../core/MappedFile.hpp"
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace slippygl::tile
+{
+    /**
+     * Flat tile pack format (little-endian, mmap-friendly)
+     *
+     *   [0]   magic "SGLTPACK"
+     *   [8]   u32 version (1)
+     *   [12]  u32 entry count N
+     *   [16]  u8 min zoom, u8 max zoom, u16 reserved, u32 reserved
+     *   [24]  u64 index offset (8-byte aligned)
+     *   [32]  tile blobs ...
+     *   [idx] u64 keys[N]       sorted packed keys (see packKey)
+     *         u64 locations[N]  (offset << 24) | length, offset relative to file start
+     *
+     * Keys and locations are separate arrays so the binary search only touches
+     * the dense key array (8 bytes per tile).
+     */
+    namespace TilePack
+    {
+        constexpr char kMagic[8] = { 'S','G','L','T','P','A','C','K' };
+        constexpr std::uint32_t kVersion = 1;
+        constexpr std::size_t kHeaderSize = 32;
+        constexpr std::uint32_t kMaxTileBytes = (1u << 24) - 1;  // 16 MB per tile
+
+        /// z(6 bits) | x(29 bits) | y(29 bits); numeric order == TileKey order
+        inline std::uint64_t packKey(const TileKey& key) noexcept
+        {
+            return (static_cast<std::uint64_t>(key.z) << 58)
+                 | (static_cast<std::uint64_t>(key.x) << 29)
+                 |  static_cast<std::uint64_t>(key.y);
+        }
+
+        inline TileKey unpackKey(std::uint64_t packed) noexcept
+        {
+            constexpr std::uint64_t kMask29 = (std::uint64_t{ 1 } << 29) - 1;
+            return TileKey(static_cast<int>(packed >> 58),
+                           static_cast<int>((packed >> 29) & kMask29),
+                           static_cast<int>(packed & kMask29));
+        }
+    }
+
+    /**
+     * Streams tiles into a pack file
+     * - Blobs are written as they are added; only the 16-byte index entries
+     *   stay in memory until finish() sorts and appends the index
+     */
+    class TilePackWriter
+    {
+    public:
+        TilePackWriter() = default;
+        ~TilePackWriter() = default;
+
+        // Non-copyable
+        TilePackWriter(const TilePackWriter&) = delete;
+        TilePackWriter& operator=(const TilePackWriter&) = delete;
+
+        bool open(const std::string& path, std::string* err = nullptr);
+
+        /**
+         * Append one encoded tile
+         * @return false on invalid key, oversized tile or I/O error
+         */
+        bool add(const TileKey& key, const std::uint8_t* data, std::size_t size, std::string* err = nullptr);
+
+        /**
+         * Sort index, write it and the header, close the file
+         * @return false on duplicate keys or I/O error
+         */
+        bool finish(std::string* err = nullptr);
+
+        std::size_t count() const noexcept { return entries_.size(); }
+
+    private:
+        struct IndexEntry
+        {
+            std::uint64_t key = 0;
+            std::uint64_t location = 0;
+        };
+
+        std::ofstream out_;
+        std::uint64_t writePos_ = 0;
+        std::vector<IndexEntry> entries_;
+        int minZoom_ = 255;
+        int maxZoom_ = 0;
+    };
+
+    /**
+     * TileSource over a memory-mapped pack
+     * - open() only validates the header: startup cost is the mmap itself
+     * - find() binary-searches the key array in place (no allocation, no syscalls)
+     */
+    class TilePackSource final : public TileSource
+    {
+    public:
+        TilePackSource() = default;
+        ~TilePackSource() override = default;
+
+        // Non-copyable
+        TilePackSource(const TilePackSource&) = delete;
+        TilePackSource& operator=(const TilePackSource&) = delete;
+
+        bool open(const std::string& path, std::string* err = nullptr);
+        void close() noexcept;
+        bool isOpen() const noexcept { return file_.isOpen(); }
+
+        bool find(const TileKey& key, core::ByteSpan& out) override;
+
+        int minZoom() const noexcept override { return minZoom_; }
+        int maxZoom() const noexcept override { return maxZoom_; }
+        std::size_t count() const noexcept { return count_; }
+
+    private:
+        core::MappedFile file_;
+        const std::uint8_t* keys_ = nullptr;
+        const std::uint8_t* locations_ = nullptr;
+        std::size_t count_ = 0;
+        int minZoom_ = 0;
+        int maxZoom_ = 0;
+    };
+
+} // namespace slippygl::tile
@@ -1,10 +1,72 @@
 #include "TileRenderer.hpp"
+#include "../core/ContentHash.hpp"
+#include "../core/Profiler.hpp"
+#include "../decode/Bc1Encoder.hpp"
+#include "../decode/PngStreamDecoder.hpp"
+#include "../decode/TexelPack.hpp"
 #include <spdlog/spdlog.h>
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 namespace slippygl::tile
 {
 
+namespace
+{
+    // Feeds the HTTP body into the incremental PNG decoder as it arrives
+    class PngStreamSink : public net::BodySink
+    {
+    public:
+        void onBegin() override { decoder.reset(); }
+        void onData(const std::uint8_t* data, std::size_t size) override
+        {
+            SLIPPYGL_ZONE("decode.stream");
+            if (decoder.state() == decode::PngStreamDecoder::State::kNeedMore) decoder.feed(data, size);
+        }
+
+        decode::PngStreamDecoder decoder;
+    };
+
+    // Cache content hash of a tile body; never 0, which TileCache reads as "don't share"
+    std::uint64_t tileContentHash(const std::uint8_t* data, std::size_t size)
+    {
+        return core::ContentHash::hash(data, size) | 1u;
+    }
+
+    // Tile that holds the imagery for key (its z19 ancestor when over-zoomed)
+    TileKey dataKeyFor(const TileKey& key)
+    {
+        const int overzoom = std::max(0, key.z - TileRenderer::kMaxDataZoom);
+        return TileKey(key.z - overzoom, key.x >> overzoom, key.y >> overzoom);
+    }
+
+    // Quad for key in anchor-relative world pixels of the current level, where
+    // one tile of key's level spans sizePx, shifted copyOffsetPx for a wrapped
+    // world copy. Over-zoomed tiles sample a (256 >> overzoom)-px window of the
+    // ancestor tile.
+    render::Quad tileQuad(const TileKey& key, int sizePx, const glm::dvec2& anchor, bool placeholder,
+                          double copyOffsetPx)
+    {
+        const glm::dvec2 worldPos = TileGrid::tileWorldPosition(key, sizePx) + glm::dvec2(copyOffsetPx, 0.0);
+        const int overzoom = std::max(0, key.z - TileRenderer::kMaxDataZoom);
+        const int subSize = kTileSizePx >> overzoom;
+        const int mask = (1 << overzoom) - 1;
+
+        // Exact integers: anchor and tile corners are whole pixels
+        render::Quad q;
+        q.x = static_cast<int>(worldPos.x - anchor.x);
+        q.y = static_cast<int>(worldPos.y - anchor.y);
+        q.w = sizePx;
+        q.h = sizePx;
+        q.sx = placeholder ? 0 : (key.x & mask) * subSize;
+        q.sy = placeholder ? 0 : (key.y & mask) * subSize;
+        q.sw = placeholder ? kTileSizePx : subSize;
+        q.sh = placeholder ? kTileSizePx : subSize;
+        return q;
+    }
+}
+
 TileRenderer::TileRenderer(TileCache& cache, TileDownloader& downloader, render::TextureManager& texMgr)
     : cache_(cache)
     , downloader_(downloader)
@@ -15,93 +77,174 @@ TileRenderer::TileRenderer(TileCache& cache, TileDownloader& downloader, render:
     spdlog::info("TileRenderer initialized with placeholder texture");
 }
 
+bool TileRenderer::setCompression(bool enabled)
+{
+    compress_ = false;
+    if (!enabled) return false;
+
+    if (!render::TextureManager::supportsBC1())
+    {
+        spdlog::warn("TileRenderer: GPU has no BC1 (S3TC) support, tiles stay RGBA8");
+        return false;
+    }
+    compress_ = true;
+    spdlog::info("TileRenderer: storing opaque tiles BC1-compressed");
+    return true;
+}
+
 int TileRenderer::drawTiles(
     render::QuadRenderer& quadRenderer,
     const render::Camera2D& camera,
     int zoom,
-    int fbW, int fbH)
+    int fbW, int fbH,
+    int fadeFromZoom,
+    float fadeIn)
 {
+    SLIPPYGL_ZONE("tile.draw");
+
     // Reset frame statistics
     lastTileCount_ = 0;
     lastCacheHits_ = 0;
     lastDownloads_ = 0;
+    lastLocalLoads_ = 0;
+    lastBytesFetched_ = 0;
+    lastPending_ = 0;
+    lastSharedLoads_ = 0;
 
     // Compute visible tile range
     const auto range = TileGrid::computeVisibleRange(camera, fbW, fbH, zoom);
     
-    spdlog::debug("TileRenderer: zoom={}, visible range: x[{},{}] y[{},{}] = {} tiles",
-        zoom, range.minX, range.maxX, range.minY, range.maxY, range.tileCount());
+    const auto spans = TileGrid::spans(range);
+    const int worldTiles = 1 << zoom;
+    const double worldPx = TileGrid::worldWidthPx(zoom);
+
+    spdlog::debug("TileRenderer: zoom={}, visible range: x[{},{}] y[{},{}] = {} tiles in {} spans",
+        zoom, range.minX, range.maxX, range.minY, range.maxY, range.tileCount(), spans.size());
     
-    // Get MVP matrix from camera
+    // Get MVP matrix from camera. Quads are built relative to the camera's
+    // render anchor so they stay small integers even at z22 (2^30 px world).
     const glm::mat4 mvp = camera.mvp(fbW, fbH);
+    const glm::dvec2 anchor = camera.renderAnchor();
+
+    // Zoom cross-fade: previous level underneath, this level blended over it
+    const bool fading = fadeFromZoom >= 0 && fadeIn < 1.0f;
+    if (fading)
+    {
+        drawBackdrop(quadRenderer, camera, zoom, fadeFromZoom, fbW, fbH, mvp);
+    }
+
+    // Minified tiles sample their mip chain (the placeholder always has one)
+    quadRenderer.setTrilinear(mipmaps_ && camera.scale() < 1.0f);
 
     // 프레임당 최대 다운로드 제한 (너무 많으면 블로킹됨)
     constexpr int kMaxDownloadsPerFrame = 3;
     int downloadsThisFrame = 0;
 
-    // Draw each visible tile
+    // Draw each visible tile, row by row across the world copies (left to right)
     for (int y = range.minY; y <= range.maxY; ++y)
     {
-        for (int x = range.minX; x <= range.maxX; ++x)
+        for (const VisibleSpan& span : spans)
         {
-            TileKey key(zoom, x, y);
-            
-            // 캐시에 있는지 먼저 확인
-            render::TexHandle tex = 0;
-            bool inCache = cache_.get(key, tex);
-            
-            if (!inCache)
+            for (int x = span.minX; x <= span.maxX; ++x)
             {
-                // 캐시 미스 - 다운로드 시도 (프레임당 제한)
-                if (downloadsThisFrame < kMaxDownloadsPerFrame)
+                const TileKey key(zoom, x, y);
+                const TileKey dataKey = dataKeyFor(key);
+
+                // 같은 타일이 여러 월드 사본에 보이면 첫 사본만 로드하고 나머지는 캐시된 텍스처를 그린다
+                const bool firstCopy = x + span.worldCopy * worldTiles - range.minX < worldTiles;
+
+                // 캐시에 있는지 먼저 확인
+                render::TexHandle tex = 0;
+                bool inCache = cache_.get(dataKey, tex);
+                
+                if (!inCache)
                 {
-                    tex = getOrLoadTexture(key);
-                    if (tex != 0) {
-                        ++downloadsThisFrame;
+                    // 캐시 미스 - 다운로드 시도 (프레임당 제한)
+                    if (firstCopy && downloadsThisFrame < kMaxDownloadsPerFrame)
+                    {
+                        tex = getOrLoadTexture(dataKey);
+                        if (tex != 0) {
+                            ++downloadsThisFrame;
+                        }
                     }
                 }
-            }
-            else
-            {
-                ++lastCacheHits_;
-            }
-            
-            // 텍스처가 없으면 placeholder 사용
-            if (tex == 0)
-            {
-                spdlog::debug("TileRenderer: using placeholder for tile {}", key.toString());
-                tex = getPlaceholderTexture();
-            }
+                else
+                {
+                    ++lastCacheHits_;
+                }
+                
+                // 텍스처가 없으면 placeholder 사용 (크로스페이드 중이면 이전 레벨이 보이도록 비워 둔다)
+                if (tex == 0)
+                {
+                    ++lastPending_;
+                    if (fading) continue;
+                    spdlog::debug("TileRenderer: using placeholder for tile {}", key.toString());
+                    tex = getPlaceholderTexture();
+                }
 
-            if (tex == 0) 
-            {
-                spdlog::warn("TileRenderer: no texture available for tile {}", key.toString());
-                continue;  // Skip if no placeholder either
-            }
+                if (tex == 0) 
+                {
+                    spdlog::warn("TileRenderer: no texture available for tile {}", key.toString());
+                    continue;  // Skip if no placeholder either
+                }
 
-            // Calculate tile world position
-            const glm::vec2 worldPos = TileGrid::tileWorldPosition(key);
-
-            // Create quad in world coordinates (integer snapped)
-            render::Quad q;
-            q.x = static_cast<int>(std::floor(worldPos.x));
-            q.y = static_cast<int>(std::floor(worldPos.y));
-            q.w = kTileSizePx;
-            q.h = kTileSizePx;
-            q.sx = 0;
-            q.sy = 0;
-            q.sw = kTileSizePx;
-            q.sh = kTileSizePx;
-
-            // Draw tile
-            quadRenderer.draw(tex, q, kTileSizePx, kTileSizePx, mvp);
-            ++lastTileCount_;
+                // Draw tile
+                const render::Quad q = tileQuad(key, kTileSizePx, anchor, tex == placeholderTex_,
+                    span.worldCopy * worldPx);
+                quadRenderer.draw(tex, q, kTileSizePx, kTileSizePx, mvp, fading ? fadeIn : 1.0f,
+                    texMgr_.format(tex) == render::TexFormat::kIndexed8);
+                ++lastTileCount_;
+            }
         }
     }
 
+    quadRenderer.setTrilinear(false);
+
+    const int visible = range.tileCount();
+    lastCoverage_ = visible > 0 ? static_cast<double>(visible - lastPending_) / visible : 1.0;
     return lastTileCount_;
 }
 
+void TileRenderer::drawBackdrop(
+    render::QuadRenderer& quadRenderer,
+    const render::Camera2D& camera,
+    int zoom, int backdropZoom,
+    int fbW, int fbH,
+    const glm::mat4& mvp)
+{
+    SLIPPYGL_ZONE("tile.backdrop");
+
+    // One backdrop tile in current-level world pixels: 128 one level finer, 512 one coarser
+    const int sizePx = static_cast<int>(std::ldexp(static_cast<double>(kTileSizePx), zoom - backdropZoom));
+    if (sizePx <= 0) return;
+    const glm::dvec2 anchor = camera.renderAnchor();
+    const auto range = TileGrid::computeVisibleRange(camera, fbW, fbH, backdropZoom, sizePx);
+    const auto spans = TileGrid::spans(range);
+    const double worldPx = TileGrid::worldWidthPx(backdropZoom, sizePx);
+    quadRenderer.setTrilinear(mipmaps_ && camera.scale() * sizePx < static_cast<float>(kTileSizePx));
+
+    for (int y = range.minY; y <= range.maxY; ++y)
+    {
+        for (const VisibleSpan& span : spans)
+        {
+            for (int x = span.minX; x <= span.maxX; ++x)
+            {
+                const TileKey key(backdropZoom, x, y);
+
+                // Only what is already resident; the current level owns the load budget
+                render::TexHandle tex = 0;
+                if (!cache_.get(dataKeyFor(key), tex)) tex = getPlaceholderTexture();
+                if (tex == 0) continue;
+
+                const render::Quad q = tileQuad(key, sizePx, anchor, tex == placeholderTex_,
+                    span.worldCopy * worldPx);
+                quadRenderer.draw(tex, q, kTileSizePx, kTileSizePx, mvp, 1.0f,
+                    texMgr_.format(tex) == render::TexFormat::kIndexed8);
+            }
+        }
+    }
+}
+
 void TileRenderer::drawDebugOverlay(
     render::TextRenderer& text,
     const render::Camera2D& camera,
@@ -111,6 +254,8 @@ void TileRenderer::drawDebugOverlay(
     if (!text.ready()) return;
 
     const auto range = TileGrid::computeVisibleRange(camera, fbW, fbH, zoom);
+    const auto spans = TileGrid::spans(range);
+    const double worldPx = TileGrid::worldWidthPx(zoom);
 
     const glm::vec4 borderColor(1.0f, 1.0f, 0.0f, 0.6f);  // 반투명 노랑
     const glm::vec4 labelColor (1.0f, 1.0f, 0.2f, 1.0f);  // 밝은 노랑 텍스트
@@ -118,72 +263,125 @@ void TileRenderer::drawDebugOverlay(
 
     for (int y = range.minY; y <= range.maxY; ++y)
     {
-        for (int x = range.minX; x <= range.maxX; ++x)
+        for (const VisibleSpan& span : spans)
         {
-            const TileKey key(zoom, x, y);
-            const glm::vec2 wpos = TileGrid::tileWorldPosition(key);
-
-            // 타일 코너를 화면 좌표로 투영 (축 정렬 사각형)
-            const glm::vec2 tl = camera.worldToScreen(wpos.x, wpos.y);
-            const glm::vec2 br = camera.worldToScreen(
-                wpos.x + kTileSizePx, wpos.y + kTileSizePx);
-            const float sw = br.x - tl.x;
-            const float sh = br.y - tl.y;
-
-            // 타일 경계선
-            text.drawRectOutline(tl.x, tl.y, sw, sh, 1.0f, borderColor, fbW, fbH);
-
-            // z/x/y 라벨 (좌상단에서 약간 안쪽, 고정 화면 크기)
-            text.drawTextBoxed(key.toString(), tl.x + 3.0f, tl.y + 3.0f,
-                               labelColor, labelBg, 2.0f, fbW, fbH);
+            for (int x = span.minX; x <= span.maxX; ++x)
+            {
+                const TileKey key(zoom, x, y);
+                const glm::dvec2 wpos = TileGrid::tileWorldPosition(key) + glm::dvec2(span.worldCopy * worldPx, 0.0);
+
+                // 타일 코너를 화면 좌표로 투영 (축 정렬 사각형)
+                const glm::vec2 tl = camera.worldToScreen(wpos.x, wpos.y);
+                const glm::vec2 br = camera.worldToScreen(
+                    wpos.x + kTileSizePx, wpos.y + kTileSizePx);
+                const float sw = br.x - tl.x;
+                const float sh = br.y - tl.y;
+
+                // 타일 경계선
+                text.drawRectOutline(tl.x, tl.y, sw, sh, 1.0f, borderColor, fbW, fbH);
+
+                // z/x/y 라벨 (좌상단에서 약간 안쪽, 고정 화면 크기)
+                text.drawTextBoxed(key.toString(), tl.x + 3.0f, tl.y + 3.0f,
+                                   labelColor, labelBg, 2.0f, fbW, fbH);
+            }
         }
     }
 }
 
 render::TexHandle TileRenderer::getOrLoadTexture(const TileKey& key)
 {
+    SLIPPYGL_ZONE("tile.load");
+
     // 이 함수는 캐시 미스 시에만 호출됨 (drawTiles에서 이미 확인)
-    // 바로 다운로드 + 디코딩 + 캐싱
-    
-    spdlog::info("TileRenderer: downloading tile {}", key.toString());
-    
-    // Convert TileKey to TileID for downloader
-    core::TileID tileId(key.z, key.x, key.y);
+    // 로컬 소스(아카이브) 우선, 없으면 다운로드 + 디코딩 + 캐싱
+    decode::Image img;
+    std::string decodeErr;
+    bool fromLocal = false;
+    std::uint64_t contentHash = 0;
 
-    auto result = downloader_.ensureRaster(tileId);
-    if (!result.ok())
+    core::ByteSpan localBytes;
+    if (source_ && source_->find(key, localBytes))
     {
-        spdlog::warn("TileRenderer: failed to download tile {} (HTTP {})", 
-            key.toString(), result.httpStatus);
-        return 0;
-    }
-    
-    spdlog::debug("TileRenderer: downloaded tile {} ({} bytes)", 
-        key.toString(), result.body.size());
+        fromLocal = true;
+        lastBytesFetched_ += localBytes.size();
 
-    // Decode PNG
-    decode::Image img;
-    std::string decodeErr;
-    if (!decode::PngCodec::decode(result.body, img, 4, &decodeErr))
+        // Same bytes as a resident tile (ocean, empty land): reuse its texture, no decode
+        contentHash = tileContentHash(localBytes.data(), localBytes.size());
+        render::TexHandle shared = 0;
+        if (cache_.putShared(key, contentHash, shared))
+        {
+            ++lastLocalLoads_;
+            ++lastSharedLoads_;
+            return shared;
+        }
+
+        // Zero-copy: decode straight from the source's (memory-mapped) storage
+        if (!decode::PngCodec::decode(localBytes.data(), localBytes.size(), img, 4, &decodeErr))
+        {
+            spdlog::warn("TileRenderer: failed to decode local tile {}: {}", key.toString(), decodeErr);
+            return 0;
+        }
+    }
+    else if (!networkFetch_)
     {
-        spdlog::warn("TileRenderer: failed to decode tile {}: {}", key.toString(), decodeErr);
         return 0;
     }
+    else
+    {
+        spdlog::info("TileRenderer: downloading tile {}", key.toString());
+
+        // Convert TileKey to TileID for downloader
+        core::TileID tileId(key.z, key.x, key.y);
+
+        PngStreamSink sink;
+        auto result = downloader_.ensureRaster(tileId, streamingDecode_ ? &sink : nullptr);
+        if (!result.ok())
+        {
+            spdlog::warn("TileRenderer: failed to download tile {} (HTTP {})", 
+                key.toString(), result.httpStatus);
+            return 0;
+        }
+
+        spdlog::debug("TileRenderer: downloaded tile {} ({} bytes)", 
+            key.toString(), result.body.size());
+        lastBytesFetched_ += result.body.size();
+
+        // Identical body already resident: share its texture and skip the decode
+        // fallback and upload (the streaming decoder has already run by now)
+        contentHash = tileContentHash(result.body.data(), result.body.size());
+        render::TexHandle shared = 0;
+        if (cache_.putShared(key, contentHash, shared))
+        {
+            ++lastDownloads_;
+            ++lastSharedLoads_;
+            return shared;
+        }
+
+        // Streamed pixels are usually complete by now; otherwise decode the buffered body
+        if (streamingDecode_ && sink.decoder.finish(img))
+        {
+            spdlog::debug("TileRenderer: tile {} decoded while downloading", key.toString());
+        }
+        else if (!decode::PngCodec::decode(result.body, img, 4, &decodeErr))
+        {
+            spdlog::warn("TileRenderer: failed to decode tile {}: {}", key.toString(), decodeErr);
+            return 0;
+        }
+    }
 
-    // Create texture
-    render::TexHandle tex = texMgr_.createRGBA8(img.width, img.height, img.pixels.data());
+    // Create texture in the smallest format the tile and settings allow
+    std::size_t texBytes = 0;
+    const render::TexHandle tex = createTileTexture(img, texBytes);
     if (tex == 0)
     {
         spdlog::warn("TileRenderer: failed to create texture for tile {}", key.toString());
         return 0;
     }
 
-    // Calculate texture size in bytes (RGBA8 = 4 bytes per pixel)
-    const std::size_t texBytes = static_cast<std::size_t>(img.width) * img.height * 4;
-
     // Put in cache
-    cache_.put(key, tex, texBytes);
-    ++lastDownloads_;
+    cache_.put(key, tex, texBytes, contentHash);
+    if (fromLocal) ++lastLocalLoads_;
+    else ++lastDownloads_;
 
     spdlog::debug("TileRenderer: loaded tile {} ({}x{}) into cache", 
         key.toString(), img.width, img.height);
@@ -191,6 +389,59 @@ render::TexHandle TileRenderer::getOrLoadTexture(const TileKey& key)
     return tex;
 }
 
+render::TexHandle TileRenderer::createTileTexture(const decode::Image& img, std::size_t& texBytes)
+{
+    const bool opaque = img.opaque();
+    render::TexHandle tex = 0;
+    render::TexFormat format = render::TexFormat::kRGBA8;
+
+    // BC1 when enabled (mip chain encoded on the CPU; compressed formats
+    // can't use glGenerateMipmap)
+    if (compress_ && opaque && decode::Bc1Encoder::encode(img, texelScratch_, mipmaps_))
+    {
+        format = render::TexFormat::kBC1;
+        tex = texMgr_.createBC1(img.width, img.height, texelScratch_.data(), texelScratch_.size(),
+            decode::Bc1Encoder::levelCount(img.width, img.height, mipmaps_));
+    }
+    else if (storage_ != TileStorage::kRGBA8)
+    {
+        // Indices can't be filtered, so palettes only when tiles aren't mipmapped.
+        // The palette rows are one texel per entry, so they must fit the width.
+        if (!mipmaps_ && decode::TexelPack::toIndexed(img, texelScratch_, paletteScratch_) &&
+            static_cast<int>(paletteScratch_.size() / 4) <= img.width)
+        {
+            format = render::TexFormat::kIndexed8;
+            tex = texMgr_.createIndexed8(img.width, img.height, texelScratch_.data(),
+                paletteScratch_.data(), static_cast<int>(paletteScratch_.size() / 4));
+        }
+        else if (opaque && storage_ == TileStorage::kCompact && decode::TexelPack::toRGB565(img, rgb565Scratch_))
+        {
+            format = render::TexFormat::kRGB565;
+            tex = texMgr_.createRGB(img.width, img.height, format, rgb565Scratch_.data(), mipmaps_);
+        }
+        else if (opaque && storage_ == TileStorage::kLossless && decode::TexelPack::toRGB8(img, texelScratch_))
+        {
+            format = render::TexFormat::kRGB8;
+            tex = texMgr_.createRGB(img.width, img.height, format, texelScratch_.data(), mipmaps_);
+        }
+    }
+
+    // Driver refused the smaller format (e.g. R8 on an old context): plain RGBA8 instead
+    if (tex == 0 && format != render::TexFormat::kRGBA8)
+    {
+        spdlog::debug("TileRenderer: {} upload failed, falling back to RGBA8", static_cast<int>(format));
+        format = render::TexFormat::kRGBA8;
+    }
+    if (format == render::TexFormat::kRGBA8)
+    {
+        tex = texMgr_.createRGBA8(img.width, img.height, img.pixels.data(), mipmaps_);
+    }
+
+    // Bytes the texture actually occupies (format, mip chain, palette rows)
+    texBytes = TileCache::textureBytes(img.width, img.height, format, mipmaps_);
+    return tex;
+}
+
 render::TexHandle TileRenderer::getPlaceholderTexture()
 {
     if (placeholderTex_ == 0)
@@ -205,24 +456,32 @@ void TileRenderer::createPlaceholderTexture()
     // Create a gray checkerboard pattern
     constexpr int size = 256;
     constexpr int checkSize = 16;
-    std::vector<uint8_t> pixels(size * size * 4);
+    constexpr std::size_t rowBytes = static_cast<std::size_t>(size) * 4;
+    std::vector<uint8_t> pixels(rowBytes * size);
 
-    for (int y = 0; y < size; ++y)
+    // Only two distinct scanlines (dark-first, light-first): build those,
+    // then copy them into every other row of their band
+    std::uint8_t* const bandRow[2] = { pixels.data(), pixels.data() + rowBytes * checkSize };
+    for (int band = 0; band < 2; ++band)
     {
         for (int x = 0; x < size; ++x)
         {
-            const int idx = (y * size + x) * 4;
-            const bool dark = ((x / checkSize) + (y / checkSize)) % 2 == 0;
+            const bool dark = ((x / checkSize) + band) % 2 == 0;
             const uint8_t gray = dark ? 180 : 200;
-            
-            pixels[idx + 0] = gray;  // R
-            pixels[idx + 1] = gray;  // G
-            pixels[idx + 2] = gray;  // B
-            pixels[idx + 3] = 255;   // A
+            std::uint8_t* px = bandRow[band] + static_cast<std::size_t>(x) * 4;
+            px[0] = px[1] = px[2] = gray;
+            px[3] = 255;
         }
     }
+    for (int y = 0; y < size; ++y)
+    {
+        std::uint8_t* row = pixels.data() + static_cast<std::size_t>(y) * rowBytes;
+        const std::uint8_t* src = bandRow[(y / checkSize) % 2];
+        if (row != src) std::memcpy(row, src, rowBytes);
+    }
 
-    placeholderTex_ = texMgr_.createRGBA8(size, size, pixels.data());
+    // Always mipmapped: it is drawn with whatever sampler the tiles use
+    placeholderTex_ = texMgr_.createRGBA8(size, size, pixels.data(), true);
     
     if (placeholderTex_ != 0)
     {
@@ -4,6 +4,7 @@
 #include "TileGrid.hpp"
 #include "TileCache.hpp"
 #include "TileDownloader.hpp"
+#include "TileSource.hpp"
 #include "../render/Camera2D.hpp"
 #include "../render/QuadRenderer.hpp"
 #include "../render/TextRenderer.hpp"
@@ -25,6 +26,20 @@ namespace slippygl::tile
     class TileRenderer
     {
     public:
+        /// Deepest zoom with source imagery (OSM raster tiles stop at z19).
+        /// Deeper views over-zoom: each tile draws its z19 ancestor's sub-rectangle.
+        static constexpr int kMaxDataZoom = 19;
+
+        /// Texture format policy for loaded tiles (see setStorage)
+        /// RGB8 only cuts upload bytes: most desktop drivers pad it to 4 bytes per
+        /// texel, so kLossless saves VRAM only on tiles that fit the palette.
+        enum class TileStorage
+        {
+            kRGBA8,      // every tile RGBA8 (default)
+            kLossless,   // paletted R8 (<= 256 colors, no mipmaps) > RGB8 (opaque) > RGBA8
+            kCompact,    // paletted R8 (<= 256 colors, no mipmaps) > RGB565 (opaque) > RGBA8
+        };
+
         /**
          * Constructor
          * @param cache Texture cache (shared ownership)
@@ -45,18 +60,25 @@ namespace slippygl::tile
          * @param zoom Tile zoom level
          * @param fbW Framebuffer width
          * @param fbH Framebuffer height
+         * @param fadeFromZoom Zoom cross-fade backdrop level (-1 = none). Its cached
+         *                     tiles are drawn first; current-level tiles without
+         *                     imagery are then left out so the backdrop shows through.
+         * @param fadeIn Opacity of current-level tiles while cross-fading
          * @return Number of tiles rendered
          */
         int drawTiles(
             render::QuadRenderer& quadRenderer,
             const render::Camera2D& camera,
             int zoom,
-            int fbW, int fbH);
+            int fbW, int fbH,
+            int fadeFromZoom = -1,
+            float fadeIn = 1.0f);
 
         /**
          * Draw debug overlay for the current view: tile borders + z/x/y labels.
          * Screen-space (fixed-size text), projected via camera.worldToScreen().
-         * No tile loading/downloading happens here.
+         * No tile loading/downloading happens here. Wrap in text.beginBatch()/
+         * endBatch() to draw the whole grid in a single draw call.
          * @param text Text renderer (reused; not stored)
          */
         void drawDebugOverlay(
@@ -65,6 +87,55 @@ namespace slippygl::tile
             int zoom,
             int fbW, int fbH);
 
+        /**
+         * Set optional local tile source (e.g. PMTiles archive)
+         * Tiles found there are decoded straight from the source's storage;
+         * misses fall back to the network downloader.
+         * @param source Tile source (not owned, nullptr = network only)
+         */
+        void setTileSource(TileSource* source) noexcept { source_ = source; }
+
+        /**
+         * Decode downloaded PNGs incrementally while the body is still arriving
+         * Images the streaming decoder can't handle fall back to PngCodec.
+         * @param enabled true = streaming decode (default), false = decode after download
+         */
+        void setStreamingDecode(bool enabled) noexcept { streamingDecode_ = enabled; }
+
+        /**
+         * Allow network downloads for tiles missing from the local source
+         * Disabled for replay benchmarks so runs don't depend on the network.
+         * @param enabled true = download misses (default), false = placeholder
+         */
+        void setNetworkFetch(bool enabled) noexcept { networkFetch_ = enabled; }
+
+        /**
+         * Build mip chains for tile textures and sample them trilinearly when
+         * minified (camera scale < 1), instead of aliasing NEAREST
+         * Set before the first tile loads; textures already cached keep their format.
+         * @param enabled true = mipmaps (default), false = level 0 only (3/4 the memory)
+         */
+        void setMipmaps(bool enabled) noexcept { mipmaps_ = enabled; }
+
+        /**
+         * Store opaque tiles BC1-compressed (decode::Bc1Encoder), 1/8 the
+         * memory of RGBA8, so the same cache budget holds 8x the tiles
+         * Tiles with transparency stay RGBA8. Needs a current GL context.
+         * @param enabled true = compress when the GPU supports BC1
+         * @return true if compression is active (false: unsupported or disabled)
+         */
+        bool setCompression(bool enabled);
+
+        /**
+         * Choose how tiles are stored (BC1, when enabled, still takes opaque tiles first)
+         * Paletted tiles store 1-byte indices and look the color up in the shader;
+         * they need setMipmaps(false), since indices can't be filtered.
+         * Set before the first tile loads; textures already cached keep their format.
+         * A compact upload the driver rejects falls back to RGBA8.
+         * @param storage Format policy (default kRGBA8)
+         */
+        void setStorage(TileStorage storage) noexcept { storage_ = storage; }
+
         /**
          * Get placeholder texture for failed/loading tiles
          */
@@ -76,11 +147,27 @@ namespace slippygl::tile
         int lastTileCount() const noexcept { return lastTileCount_; }
         int lastCacheHits() const noexcept { return lastCacheHits_; }
         int lastDownloads() const noexcept { return lastDownloads_; }
+        int lastLocalLoads() const noexcept { return lastLocalLoads_; }
+        std::size_t lastBytesFetched() const noexcept { return lastBytesFetched_; }  // compressed bytes
+        int lastPendingTiles() const noexcept { return lastPending_; }   // no imagery yet
+        int lastSharedLoads() const noexcept { return lastSharedLoads_; } // loads that reused an identical tile's texture
+        double lastCoverage() const noexcept { return lastCoverage_; }   // share of visible tiles with imagery
 
     private:
         TileCache& cache_;
         TileDownloader& downloader_;
         render::TextureManager& texMgr_;
+        TileSource* source_ = nullptr;
+        bool streamingDecode_ = true;
+        bool networkFetch_ = true;
+        bool mipmaps_ = true;
+        bool compress_ = false;
+        TileStorage storage_ = TileStorage::kRGBA8;
+
+        // Repacked texel data, reused across tiles
+        std::vector<std::uint8_t> texelScratch_;
+        std::vector<std::uint8_t> paletteScratch_;
+        std::vector<std::uint16_t> rgb565Scratch_;
 
         render::TexHandle placeholderTex_ = 0;
 
@@ -88,6 +175,11 @@ namespace slippygl::tile
         int lastTileCount_ = 0;
         int lastCacheHits_ = 0;
         int lastDownloads_ = 0;
+        int lastLocalLoads_ = 0;
+        std::size_t lastBytesFetched_ = 0;
+        int lastPending_ = 0;
+        int lastSharedLoads_ = 0;
+        double lastCoverage_ = 1.0;
 
         /**
          * Load or get texture for tile
@@ -96,6 +188,24 @@ namespace slippygl::tile
          */
         render::TexHandle getOrLoadTexture(const TileKey& key);
 
+        /**
+         * Upload a decoded tile in the format chosen by setCompression/setStorage
+         * @param texBytes Output GPU memory of the texture, for the cache budget
+         * @return Texture handle (0 if failed)
+         */
+        render::TexHandle createTileTexture(const decode::Image& img, std::size_t& texBytes);
+
+        /**
+         * Draw the cross-fade backdrop: cached tiles of another level, no loads
+         * @param backdropZoom Level to draw (adjacent to zoom)
+         */
+        void drawBackdrop(
+            render::QuadRenderer& quadRenderer,
+            const render::Camera2D& camera,
+            int zoom, int backdropZoom,
+            int fbW, int fbH,
+            const glm::mat4& mvp);
+
         /**
          * Create placeholder texture (gray checkerboard)
          */
@@ -0,0 +1,38 @@
+#include "TileSource.hpp"
+#include "PmTilesSource.hpp"
+#include "TilePack.hpp"
+
+#include <cstring>
+#include <fstream>
+
+namespace slippygl::tile
+{
+
+std::unique_ptr<TileSource> openTileSource(const std::string& path, std::string* err)
+{
+    char magic[8] = {};
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs || !ifs.read(magic, sizeof(magic)))
+    {
+        if (err) *err = "Cannot read archive: " + path;
+        return nullptr;
+    }
+
+    if (std::memcmp(magic, "PMTiles", 7) == 0)
+    {
+        auto src = std::make_unique<PmTilesSource>();
+        if (!src->open(path, err)) return nullptr;
+        return src;
+    }
+    if (std::memcmp(magic, TilePack::kMagic, sizeof(TilePack::kMagic)) == 0)
+    {
+        auto src = std::make_unique<TilePackSource>();
+        if (!src->open(path, err)) return nullptr;
+        return src;
+    }
+
+    if (err) *err = "Unknown archive format: " + path;
+    return nullptr;
+}
+
+} // namespace slippygl::tile
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "TileKey.hpp"
+#include "../core/ByteSpan.hpp"
+
+#include <memory>
+#include <string>
+
+namespace slippygl::tile
+{
+    /**
+     * Read-only source of encoded tile bytes (local archives, packs)
+     * - Returned spans point into storage owned by the source (zero-copy)
+     *   and stay valid until the source is closed or destroyed
+     * - Thread-unsafe unless the implementation says otherwise
+     */
+    class TileSource
+    {
+    public:
+        virtual ~TileSource() = default;
+
+        /**
+         * Look up encoded tile bytes (PNG etc.)
+         * @param key Tile key (XYZ scheme, Y-down)
+         * @param out Output span into source storage
+         * @return true if the tile exists in this source
+         */
+        virtual bool find(const TileKey& key, core::ByteSpan& out) = 0;
+
+        /// Zoom range covered by this source
+        virtual int minZoom() const noexcept = 0;
+        virtual int maxZoom() const noexcept = 0;
+    };
+
+    /**
+     * Open a local tile archive, choosing the reader by file magic
+     * (PMTiles v3 or SlippyGL tile pack)
+     * @param path Archive path
+     * @param err Error message on failure (can be nullptr)
+     * @return Opened source, or nullptr on failure
+     */
+    std::unique_ptr<TileSource> openTileSource(const std::string& path, std::string* err = nullptr);
+
+} // namespace slippygl::tile
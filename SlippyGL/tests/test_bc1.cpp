@@ -0,0 +1,139 @@
+#include "check.hpp"
+#include "decode/Bc1Encoder.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace slippygl::decode;
+
+namespace
+{
+    Image makeImage(int w, int h)
+    {
+        Image img;
+        img.width = w;
+        img.height = h;
+        img.channels = 4;
+        img.pixels.resize(static_cast<std::size_t>(w) * h * 4);
+        return img;
+    }
+
+    void setPixel(Image& img, int x, int y, int r, int g, int b)
+    {
+        std::uint8_t* p = &img.pixels[(static_cast<std::size_t>(y) * img.width + x) * 4];
+        p[0] = static_cast<std::uint8_t>(r);
+        p[1] = static_cast<std::uint8_t>(g);
+        p[2] = static_cast<std::uint8_t>(b);
+        p[3] = 255;
+    }
+
+    int maxError(const Image& a, const Image& b)
+    {
+        int worst = 0;
+        for (std::size_t i = 0; i < a.pixels.size(); ++i)
+        {
+            if (i % 4 == 3) continue;
+            worst = std::max(worst, std::abs(a.pixels[i] - b.pixels[i]));
+        }
+        return worst;
+    }
+}
+
+void test_bc1()
+{
+    std::printf("[bc1]\n");
+
+    // Sizes: 8 bytes per 4x4 block, partial blocks padded, chain down to 1x1
+    CHECK_EQ(Bc1Encoder::levelBytes(256, 256), 32768u);          // 1/8 of RGBA8
+    CHECK_EQ(Bc1Encoder::levelBytes(5, 3), 16u);
+    CHECK_EQ(Bc1Encoder::levelBytes(1, 1), 8u);
+    CHECK_EQ(Bc1Encoder::levelCount(256, 256, false), 1);
+    CHECK_EQ(Bc1Encoder::levelCount(256, 256, true), 9);
+    CHECK_EQ(Bc1Encoder::levelCount(4, 1, true), 3);
+
+    // Flat colors exactly representable in RGB565 survive unchanged
+    {
+        Image img = makeImage(8, 8);
+        for (int y = 0; y < 8; ++y)
+            for (int x = 0; x < 8; ++x) setPixel(img, x, y, 255, 0, 132);
+        std::vector<std::uint8_t> blocks;
+        CHECK(Bc1Encoder::encode(img, blocks));
+        CHECK_EQ(blocks.size(), 32u);
+        Image back;
+        CHECK(Bc1Encoder::decode(blocks.data(), blocks.size(), 8, 8, back));
+        CHECK_EQ(maxError(img, back), 0);
+    }
+
+    // Two colors in a block: both reproduced (within RGB565 precision), four-color mode
+    {
+        Image img = makeImage(4, 4);
+        for (int y = 0; y < 4; ++y)
+            for (int x = 0; x < 4; ++x)
+            {
+                if ((x + y) % 2) setPixel(img, x, y, 250, 250, 250);   // road
+                else setPixel(img, x, y, 170, 200, 150);              // park
+            }
+        std::uint8_t block[8];
+        Bc1Encoder::encodeBlock(img.pixels.data(), block);
+        const int c0 = block[0] | (block[1] << 8);
+        const int c1 = block[2] | (block[3] << 8);
+        CHECK(c0 > c1);
+        Image back;
+        CHECK(Bc1Encoder::decode(block, sizeof(block), 4, 4, back));
+        CHECK(maxError(img, back) <= 8);
+    }
+
+    // Smooth gradient with anti-correlated channels (red up, green down): the
+    // box diagonal must be flipped or every block collapses to grey
+    {
+        Image img = makeImage(16, 16);
+        for (int y = 0; y < 16; ++y)
+            for (int x = 0; x < 16; ++x) setPixel(img, x, y, x * 16, 255 - x * 16, x * 8);
+        std::vector<std::uint8_t> blocks;
+        CHECK(Bc1Encoder::encode(img, blocks));
+        Image back;
+        CHECK(Bc1Encoder::decode(blocks.data(), blocks.size(), 16, 16, back));
+        CHECK(maxError(img, back) <= 10);
+    }
+
+    // Odd sizes clamp the edge blocks; the mip chain follows level 0
+    {
+        Image img = makeImage(6, 5);
+        for (int y = 0; y < 5; ++y)
+            for (int x = 0; x < 6; ++x) setPixel(img, x, y, 0, 0, 255);
+        std::vector<std::uint8_t> blocks;
+        CHECK(Bc1Encoder::encode(img, blocks, true));
+        CHECK_EQ(blocks.size(), Bc1Encoder::levelBytes(6, 5) + Bc1Encoder::levelBytes(3, 2) + Bc1Encoder::levelBytes(1, 1));
+        Image back;
+        CHECK(Bc1Encoder::decode(blocks.data(), blocks.size(), 6, 5, back));
+        CHECK_EQ(maxError(img, back), 0);
+        CHECK(Bc1Encoder::decode(blocks.data() + 32, 8, 3, 2, back));
+        CHECK_EQ(back.pixels[2], 255);
+    }
+
+    // Opacity check gates the encoder in TileRenderer
+    {
+        Image img = makeImage(4, 4);
+        for (int y = 0; y < 4; ++y)
+            for (int x = 0; x < 4; ++x) setPixel(img, x, y, 10, 20, 30);
+        CHECK(img.opaque());
+        img.pixels[7] = 128;
+        CHECK(!img.opaque());
+    }
+
+    // Invalid input
+    {
+        Image img;
+        std::vector<std::uint8_t> blocks(1);
+        std::string err;
+        CHECK(!Bc1Encoder::encode(img, blocks, false, &err));
+        CHECK(blocks.empty());
+        CHECK(!err.empty());
+        Image back;
+        const std::uint8_t shortData[4] = {};
+        CHECK(!Bc1Encoder::decode(shortData, sizeof(shortData), 4, 4, back));
+    }
+}
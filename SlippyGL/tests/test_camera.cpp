@@ -11,28 +11,28 @@ void test_camera()
     // switch. After zoom-in (factor 2), the same geographic point is at world*2.
     {
         Camera2D cam;
-        cam.setWorldOrigin(glm::vec2(1000.0f, 2000.0f));   // scale 1.0
-        const glm::vec2 wp(1234.0f, 5678.0f);
+        cam.setWorldOrigin(glm::dvec2(1000.0, 2000.0));   // scale 1.0
+        const glm::dvec2 wp(1234.0, 5678.0);
         const glm::vec2 before = cam.worldToScreen(wp.x, wp.y);
 
-        cam.applyZoomStep(2.0f);
-        const glm::vec2 after = cam.worldToScreen(wp.x * 2.0f, wp.y * 2.0f);
+        cam.applyZoomStep(2.0);
+        const glm::vec2 after = cam.worldToScreen(wp.x * 2.0, wp.y * 2.0);
 
         CHECK_NEAR(before.x, after.x, 1e-3);
         CHECK_NEAR(before.y, after.y, 1e-3);
         CHECK_NEAR(cam.scale(), 0.5f, 1e-6);   // scale halved
 
         // zoom back out restores scale
-        cam.applyZoomStep(0.5f);
+        cam.applyZoomStep(0.5);
         CHECK_NEAR(cam.scale(), 1.0f, 1e-6);
     }
 
     // screenToWorld and worldToScreen are inverses
     {
         Camera2D cam;
-        cam.setWorldOrigin(glm::vec2(500.0f, 700.0f));
-        const glm::vec2 s = cam.worldToScreen(900.0f, 1300.0f);
-        const glm::vec2 w = cam.screenToWorld(s.x, s.y);
+        cam.setWorldOrigin(glm::dvec2(500.0, 700.0));
+        const glm::vec2 s = cam.worldToScreen(900.0, 1300.0);
+        const glm::dvec2 w = cam.screenToWorld(s.x, s.y);
         CHECK_NEAR(w.x, 900.0f, 1e-3);
         CHECK_NEAR(w.y, 1300.0f, 1e-3);
     }
@@ -40,9 +40,28 @@ void test_camera()
     // pan shifts worldOrigin by -delta/scale (scale 1.0 here)
     {
         Camera2D cam;
-        const glm::vec2 o0 = cam.worldOrigin();
+        const glm::dvec2 o0 = cam.worldOrigin();
         cam.pan(10.0f, -20.0f);
-        CHECK_NEAR(cam.worldOrigin().x, o0.x - 10.0f, 1e-4);
-        CHECK_NEAR(cam.worldOrigin().y, o0.y + 20.0f, 1e-4);
+        CHECK_NEAR(cam.worldOrigin().x, o0.x - 10.0, 1e-4);
+        CHECK_NEAR(cam.worldOrigin().y, o0.y + 20.0, 1e-4);
+    }
+
+    // z22 (world 2^30 px): sub-pixel pans accumulate exactly instead of being
+    // swallowed by float rounding, and the render anchor leaves only a
+    // sub-pixel translation for the GPU.
+    {
+        Camera2D cam;
+        const double x0 = 915566336.0 + 0.5, y0 = 415794944.0 + 0.75;   // Seoul at z22
+        cam.setWorldOrigin(glm::dvec2(x0, y0));
+        for (int i = 0; i < 1000; ++i) cam.pan(-0.25f, 0.0f);
+        CHECK_NEAR(cam.worldOrigin().x, x0 + 250.0, 1e-6);
+        CHECK_NEAR(cam.worldOrigin().y, y0, 1e-9);
+
+        const glm::dvec2 a = cam.renderAnchor();
+        CHECK_EQ(a.x, std::floor(x0 + 250.0));
+        CHECK_EQ(a.y, std::floor(y0));
+        const glm::vec2 s = cam.worldToScreen(a.x + 100.0, a.y);
+        CHECK_NEAR(s.x, 100.0 - 0.5, 1e-4);   // world - origin, exact in double
+        CHECK_NEAR(s.y, -0.75, 1e-4);
     }
 }
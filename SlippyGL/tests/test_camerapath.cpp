@@ -0,0 +1,71 @@
+#include "check.hpp"
+#include "render/Camera2D.hpp"
+#include "render/CameraPath.hpp"
+#include "tile/TileGrid.hpp"
+
+#include <cmath>
+#include <string>
+
+using namespace slippygl::render;
+
+void test_camerapath()
+{
+    std::printf("[camerapath]\n");
+
+    // Expansion: one pose per frame, commands applied in order
+    CameraPath path;
+    std::string err;
+    CHECK(CameraPath::parse(
+        "# comment\n"
+        "start 0 0 10\n"
+        "hold 5\n"
+        "pan 256 0 4      # one tile per frame at z10\n"
+        "zoom 2 10\n"
+        "flyto 10 10 10 20\n", path, &err));
+    CHECK_EQ(path.frameCount(), 39u);
+
+    const CameraPose p0 = path.pose(0);
+    CHECK_NEAR(p0.x, 0.5, 1e-12);
+    CHECK_NEAR(p0.y, 0.5, 1e-12);
+    CHECK_NEAR(p0.zoom, 10.0, 1e-12);
+    CHECK_NEAR(path.pose(8).x - 0.5, 4.0 / 1024.0, 1e-12);   // after 4 pans
+    CHECK_NEAR(path.pose(18).zoom, 12.0, 1e-12);             // end of zoom
+    const CameraPose end = path.pose(38);
+    const CameraPose target = CameraPath::fromLonLat(10.0, 10.0, 10.0);
+    CHECK_NEAR(end.x, target.x, 1e-12);
+    CHECK_NEAR(end.y, target.y, 1e-12);
+    CHECK_NEAR(end.zoom, 10.0, 1e-9);
+    CHECK(path.pose(28).zoom < 10.0);                        // long hop arcs out mid-flight
+    CHECK_NEAR(path.pose(39).x, p0.x, 1e-12);                // frame index wraps
+
+    // Zoom is clamped to the supported range
+    CHECK(CameraPath::parse("start 0 0 18\nzoom 5 2\n", path));
+    CHECK_NEAR(path.pose(1).zoom, CameraPath::kMaxZoom, 1e-12);
+
+    // Errors carry the line number and leave the output untouched
+    CHECK(!CameraPath::parse("start 0 0 3\nspin 4\n", path, &err));
+    CHECK(err.rfind("line 2:", 0) == 0);
+    CHECK_EQ(path.frameCount(), 2u);
+    CHECK(!CameraPath::parse("hold 3\n", path, &err));
+    CHECK(!CameraPath::parse("start 0 0 3\nhold 0\n", path, &err));
+    CHECK(!CameraPath::parse("", path, &err));
+    CHECK(!CameraPath::load("/nonexistent/path.txt", path, &err));
+
+    CHECK(CameraPath::builtin().frameCount() > 600u);
+
+    // apply(): nearest tile zoom, residual scale, pose centered on screen
+    Camera2D cam;
+    int z = 0;
+    const CameraPose seoul = CameraPath::fromLonLat(126.9780, 37.5665, 12.4);
+    CameraPath::apply(seoul, cam, z, 800, 600);
+    CHECK_EQ(z, 12);
+    CHECK_NEAR(cam.scale(), std::exp2(0.4), 1e-6);
+    const glm::dvec2 c = cam.screenToWorld(400.0f, 300.0f);
+    const double world = 256.0 * 4096.0;
+    CHECK_NEAR(c.x, seoul.x * world, 0.5);
+    CHECK_NEAR(c.y, seoul.y * world, 0.5);
+
+    CameraPath::apply(CameraPath::fromLonLat(0.0, 0.0, 7.6), cam, z, 800, 600);
+    CHECK_EQ(z, 8);
+    CHECK(cam.scale() > 0.5f && cam.scale() < 2.0f);         // no extra zoom step in the app loop
+}
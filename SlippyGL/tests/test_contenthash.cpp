@@ -0,0 +1,52 @@
+#include "check.hpp"
+#include "core/ContentHash.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <vector>
+
+using slippygl::core::ContentHash;
+
+namespace
+{
+    std::uint64_t hashString(const char* s)
+    {
+        return ContentHash::hash(reinterpret_cast<const std::uint8_t*>(s), std::strlen(s));
+    }
+}
+
+void test_contenthash()
+{
+    std::printf("[contenthash]\n");
+
+    // Reference XXH64 values (seed 0)
+    CHECK_EQ(hashString(""), 0xEF46DB3751D8E999ull);
+    CHECK_EQ(hashString("a"), 0xD24EC4F1A98C6E5Bull);
+    CHECK_EQ(hashString("abc"), 0x44BC2CF5AD770999ull);
+
+    // Every length through the 32-byte stripes and the 8/4/1-byte tails differs,
+    // and so does each single-bit flip of a tile-sized body
+    std::vector<std::uint8_t> body(20000);
+    for (std::size_t i = 0; i < body.size(); ++i) body[i] = static_cast<std::uint8_t>(i * 131 + 7);
+    std::set<std::uint64_t> seen;
+    for (std::size_t n = 0; n <= 80; ++n) seen.insert(ContentHash::hash(body.data(), n));
+    CHECK_EQ(seen.size(), 81u);
+
+    const std::uint64_t base = ContentHash::hash(body.data(), body.size());
+    CHECK_EQ(ContentHash::hash(body.data(), body.size()), base);   // deterministic
+    bool allDiffer = true;
+    for (std::size_t pos : { std::size_t{ 0 }, std::size_t{ 9999 }, body.size() - 1 })
+    {
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            body[pos] ^= static_cast<std::uint8_t>(1 << bit);
+            allDiffer = allDiffer && ContentHash::hash(body.data(), body.size()) != base;
+            body[pos] ^= static_cast<std::uint8_t>(1 << bit);
+        }
+    }
+    CHECK(allDiffer);
+
+    // Seed changes the value
+    CHECK(ContentHash::hash(body.data(), body.size(), 1) != base);
+}
@@ -0,0 +1,48 @@
+#include "check.hpp"
+#include "core/FrameStats.hpp"
+
+#include <string>
+
+using namespace slippygl::core;
+
+void test_framestats()
+{
+    std::printf("[framestats]\n");
+
+    FrameStats s;
+    CHECK_NEAR(s.percentileMs(50.0), 0.0, 1e-12);
+    CHECK_NEAR(s.cacheHitRatio(), 0.0, 1e-12);
+
+    // 100 frames of 1..100 ms; every frame draws 10 tiles, 8 from cache
+    for (int i = 1; i <= 100; ++i)
+    {
+        FrameSample f;
+        f.ms = i;
+        f.tilesDrawn = 10;
+        f.cacheHits = 8;
+        f.tilesLoaded = 2;
+        f.bytesFetched = 1000;
+        s.add(f);
+    }
+    CHECK_EQ(s.frames(), 100u);
+    CHECK_NEAR(s.percentileMs(50.0), 51.0, 1e-12);   // nearest rank over 0..99
+    CHECK_NEAR(s.percentileMs(95.0), 95.0, 1e-12);
+    CHECK_NEAR(s.percentileMs(99.0), 99.0, 1e-12);
+    CHECK_NEAR(s.maxMs(), 100.0, 1e-12);
+    CHECK_NEAR(s.meanMs(), 50.5, 1e-12);
+    CHECK_NEAR(s.totalMs(), 5050.0, 1e-9);
+    CHECK_NEAR(s.cacheHitRatio(), 0.8, 1e-12);
+    CHECK_EQ(s.tilesLoaded(), 200u);
+    CHECK_NEAR(s.tilesLoadedPerSec(), 200.0 / 5.05, 1e-9);
+    CHECK_EQ(s.bytesFetched(), 100000u);
+
+    const std::string json = s.toJson("paths/\"seoul\".txt");
+    CHECK(json.find("\"scenario\":\"paths/\\\"seoul\\\".txt\"") != std::string::npos);
+    CHECK(json.find("\"p95\":95.000") != std::string::npos);
+    CHECK(json.find("\"cache_hit_ratio\":0.8000") != std::string::npos);
+    CHECK(json.find("\"bytes_fetched\":100000}") != std::string::npos);
+
+    s.clear();
+    CHECK_EQ(s.frames(), 0u);
+    CHECK_EQ(s.tilesDrawn(), 0u);
+}
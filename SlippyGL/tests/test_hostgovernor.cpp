@@ -0,0 +1,65 @@
+#include "check.hpp"
+#include "net/HostGovernor.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace slippygl::net;
+
+void test_hostgovernor()
+{
+    std::printf("[hostgovernor]\n");
+
+    CHECK(HostGovernor::hostOf("https://a.tile.openstreetmap.org/1/2/3.png") == "a.tile.openstreetmap.org");
+    CHECK(HostGovernor::hostOf("http://127.0.0.1:8080/1/2/3.png") == "127.0.0.1:8080");
+    CHECK(HostGovernor::hostOf("https://user:pw@Tiles.Example.org?x=1") == "tiles.example.org");
+
+    CHECK_EQ(HostGovernor::parseRetryAfterSeconds("120"), 120000L);
+    CHECK_EQ(HostGovernor::parseRetryAfterSeconds(" 0 "), 0L);
+    CHECK_EQ(HostGovernor::parseRetryAfterSeconds("Wed, 21 Oct 2015 07:28:00 GMT"), -1L);
+    CHECK_EQ(HostGovernor::parseRetryAfterSeconds(""), -1L);
+
+    // Connection cap: third permit for the same host is refused until one is released
+    {
+        HostGovernor gov(GovernorConfig().setMaxConnectionsPerHost(2));
+        HostPermit a = gov.tryAcquire("h");
+        HostPermit b = gov.tryAcquire("h");
+        CHECK(a.valid() && b.valid());
+        CHECK(!gov.tryAcquire("h").valid());
+        CHECK(gov.tryAcquire("other").valid());    // limits are per host
+        CHECK_EQ(gov.stats("h").inFlight, 2);
+        a.release();
+        CHECK(gov.tryAcquire("h").valid());
+    }
+
+    // Token bucket: burst is granted immediately, the next request waits ~1/rate
+    {
+        HostGovernor gov(GovernorConfig().setRequestsPerSec(50.0).setBurst(2).setMaxConnectionsPerHost(0));
+        CHECK(gov.tryAcquire("h").valid());
+        CHECK(gov.tryAcquire("h").valid());
+        CHECK(!gov.tryAcquire("h").valid());
+        const auto t0 = std::chrono::steady_clock::now();
+        CHECK(gov.acquire("h").valid());
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+        CHECK(ms >= 5.0);
+        CHECK_EQ(gov.stats("h").waited, 1u);
+        CHECK(gov.stats("h").totalWaitMs > 0.0);
+    }
+
+    // 429 + Retry-After blocks the host and halves the rate; successes recover it
+    {
+        HostGovernor gov(GovernorConfig().setRequestsPerSec(100.0).setMaxConnectionsPerHost(0));
+        gov.onResponse("h", 429, 30);
+        CHECK(!gov.tryAcquire("h").valid());
+        CHECK_EQ(gov.stats("h").throttled, 1u);
+        CHECK_NEAR(gov.stats("h").rateFactor, 0.5, 1e-9);
+        std::this_thread::sleep_for(std::chrono::milliseconds(40));
+        CHECK(gov.acquire("h").valid());
+        for (int i = 0; i < 20; ++i) gov.onResponse("h", 200, -1);
+        CHECK_NEAR(gov.stats("h").rateFactor, 1.0, 1e-9);
+
+        // 503 without Retry-After is left to the client backoff
+        gov.onResponse("h", 503, -1);
+        CHECK_EQ(gov.stats("h").throttled, 1u);
+    }
+}
@@ -0,0 +1,55 @@
+#include "check.hpp"
+#include "net/HttpTypes.hpp"
+
+#include <string>
+
+using namespace slippygl::net;
+
+void test_httpheaders()
+{
+    std::printf("[httpheaders]\n");
+
+    CHECK(iequals("Content-Type", "content-type"));
+    CHECK(iequals("", ""));
+    CHECK(!iequals("ETag", "ETags"));
+    CHECK(!iequals("etag", "etaf"));
+
+    ResponseHeaders h;
+    h.parseLine("HTTP/1.1 200 OK\r\n");
+    h.parseLine("ETag: \"abc\"\r\n");
+    h.parseLine("CONTENT-TYPE:image/png\r\n");
+    h.parseLine("Content-Length: 1234 \r\n");
+    h.parseLine("last-modified: \tWed, 21 Oct 2015 07:28:00 GMT\r\n");
+    h.parseLine("Retry-After: 30\r\n");
+    h.parseLine("X-Unused: ignored\r\n");
+    h.parseLine("no colon here\r\n");
+    h.parseLine("\r\n");
+
+    CHECK(h.etag().has_value() && *h.etag() == "\"abc\"");
+    CHECK(h.contentType().has_value() && *h.contentType() == "image/png");
+    CHECK(h.contentLength().has_value() && *h.contentLength() == 1234);
+    CHECK(h.lastModified().has_value() && *h.lastModified() == "Wed, 21 Oct 2015 07:28:00 GMT");
+    CHECK(h.retryAfter().has_value() && *h.retryAfter() == "30");
+    CHECK(!h.contentEncoding().has_value());
+    CHECK(h.raw().empty());     // raw lines are opt-in
+
+    // Malformed length is dropped; a new status line (redirect) clears fields
+    h.parseLine("Content-Length: lots\r\n");
+    CHECK(*h.contentLength() == 1234);
+    h.parseLine("HTTP/2 301\r\n");
+    CHECK(!h.etag().has_value());
+    CHECK(!h.contentLength().has_value());
+
+    ResponseHeaders raw;
+    raw.parseLine("Content-Encoding: gzip\r\n", true);
+    CHECK_EQ(raw.raw().size(), 1u);
+    CHECK(raw.raw()[0] == "Content-Encoding: gzip\r\n");
+    CHECK(*raw.contentEncoding() == "gzip");
+
+    // Raw lines restart with each response too (only the final one is kept)
+    raw.parseLine("HTTP/1.1 200 OK\r\n", true);
+    raw.parseLine("ETag: \"x\"\r\n", true);
+    CHECK_EQ(raw.raw().size(), 2u);
+    CHECK(raw.raw()[0] == "HTTP/1.1 200 OK\r\n");
+    CHECK(!raw.contentEncoding().has_value());
+}
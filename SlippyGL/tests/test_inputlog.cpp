@@ -0,0 +1,127 @@
+#include "check.hpp"
+#include "render/InputLog.hpp"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace slippygl::render;
+
+void test_inputlog()
+{
+    std::printf("[inputlog]\n");
+
+    // A short session: cursor, drag, scroll, key press/release, frames
+    std::vector<InputEvent> events;
+    auto add = [&](InputEvent::Type t, std::uint64_t us, float x, float y, int code, int action, int mods) {
+        InputEvent e;
+        e.type = t;
+        e.timeUs = us;
+        e.x = x;
+        e.y = y;
+        e.code = code;
+        e.action = action;
+        e.mods = mods;
+        events.push_back(e);
+    };
+    add(InputEvent::Type::kCursor, 0, 400.5f, 300.25f, 0, 0, 0);
+    add(InputEvent::Type::kFrame, 16'667, 0.016667f, 0, 0, 0, 0);
+    add(InputEvent::Type::kMouseButton, 20'000, 0, 0, 0, 1, 0);
+    add(InputEvent::Type::kCursor, 25'000, 420.0f, 310.0f, 0, 0, 0);
+    add(InputEvent::Type::kScroll, 30'000, 0.0f, -1.0f, 0, 0, 0);
+    add(InputEvent::Type::kKey, 31'000, 0, 0, 87, 1, 2);        // W press, ctrl
+    add(InputEvent::Type::kFrame, 33'334, 0.016667f, 0, 0, 0, 0);
+    add(InputEvent::Type::kResize, 40'000, 0, 0, 1920, 1080, 0);
+    add(InputEvent::Type::kKey, 1'000'000, 0, 0, 87, 0, 0);     // W release after a stall
+    add(InputEvent::Type::kFrame, 1'000'100, 0.1f, 0, 0, 0, 0);
+
+    const auto path = (std::filesystem::temp_directory_path() / "slippygl_test.input").string();
+    {
+        InputLogWriter w;
+        std::string err;
+        CHECK(w.open(path, 800, 600, &err));
+        for (const auto& e : events) w.add(e);
+        CHECK_EQ(w.frames(), 3u);
+        CHECK(w.close(&err));
+    }
+
+    InputLog log;
+    std::string err;
+    CHECK(InputLog::load(path, log, &err));
+    CHECK_EQ(log.fbW, 800);
+    CHECK_EQ(log.fbH, 600);
+    CHECK_EQ(log.frameCount(), 3u);
+    bool same = log.events.size() == events.size();
+    for (std::size_t i = 0; same && i < events.size(); ++i)
+    {
+        const InputEvent& a = events[i];
+        const InputEvent& b = log.events[i];
+        same = a.type == b.type && a.timeUs == b.timeUs && a.x == b.x && a.y == b.y
+            && a.code == b.code && a.action == b.action && a.mods == b.mods;
+    }
+    CHECK(same);
+
+    // Compact: a frame 1/60 s after the last event is type + 3-byte varint + f32
+    std::vector<std::uint8_t> bytes;
+    std::uint64_t prev = 0;
+    InputLog::encode(events[1], prev, bytes);
+    CHECK_EQ(bytes.size(), 8u);
+    CHECK_EQ(prev, 16'667u);
+    bytes.clear();
+    InputEvent idle = events[1];
+    idle.timeUs = prev + 100;
+    InputLog::encode(idle, prev, bytes);
+    CHECK_EQ(bytes.size(), 6u);
+
+    // Corrupt input is rejected and leaves the output untouched
+    const std::vector<std::uint8_t> file = [&] {
+        std::vector<std::uint8_t> v(InputLog::kMagic, InputLog::kMagic + 8);
+        v.insert(v.end(), { 2, 0, 0, 0, 0x20, 0x03, 0x58, 0x02 });   // v2, 800x600
+        std::uint64_t t = 0;
+        InputLog::encode(events[3], t, v);
+        return v;
+    }();
+    CHECK(InputLog::parse(file.data(), file.size(), log, &err));
+    CHECK_EQ(log.events.size(), 1u);
+    CHECK(!InputLog::parse(file.data(), file.size() - 1, log, &err));      // truncated payload
+    CHECK(err.find("Truncated") != std::string::npos);
+    CHECK_EQ(log.events.size(), 1u);
+    std::vector<std::uint8_t> bad = file;
+    bad[16] = 9;                                                            // unknown event type
+    CHECK(!InputLog::parse(bad.data(), bad.size(), log, &err));
+    bad = file;
+    bad[8] = 3;                                                             // future version
+    CHECK(!InputLog::parse(bad.data(), bad.size(), log, &err));
+    bad[0] = 'X';
+    CHECK(!InputLog::parse(bad.data(), bad.size(), log, &err));
+    CHECK(!InputLog::load("/nonexistent/session.input", log, &err));
+
+    // Version 1 logs still load but cannot contain resize events
+    bad = file;
+    bad[8] = 1;
+    CHECK(InputLog::parse(bad.data(), bad.size(), log, &err));
+    {
+        std::vector<std::uint8_t> v1(bad.begin(), bad.begin() + InputLog::kHeaderSize);
+        std::uint64_t t = 0;
+        InputLog::encode(events[7], t, v1);
+        CHECK(!InputLog::parse(v1.data(), v1.size(), log, &err));
+    }
+
+    // Frames reach the file every kFlushFrames, well before close()
+    {
+        InputLogWriter w;
+        CHECK(w.open(path, 800, 600, &err));
+        InputEvent frame;
+        frame.x = 0.016f;
+        for (std::size_t i = 0; i < InputLogWriter::kFlushFrames; ++i)
+        {
+            frame.timeUs = (i + 1) * 16'667;
+            w.add(frame);
+        }
+        CHECK(InputLog::load(path, log, &err));
+        CHECK_EQ(log.frameCount(), InputLogWriter::kFlushFrames);
+        CHECK(w.close(&err));
+    }
+
+    std::filesystem::remove(path);
+}
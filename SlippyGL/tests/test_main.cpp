@@ -5,6 +5,23 @@ void test_tilemath();
 void test_tilekey();
 void test_tilegrid();
 void test_camera();
+void test_pmtiles();
+void test_tilepack();
+void test_hostgovernor();
+void test_tileendpoint();
+void test_pngstream();
+void test_httpheaders();
+void test_nettelemetry();
+void test_profiler();
+void test_camerapath();
+void test_framestats();
+void test_inputlog();
+void test_zoomblend();
+void test_tilecache();
+void test_bc1();
+void test_texelpack();
+void test_pixelkernels();
+void test_contenthash();
 
 int main()
 {
@@ -14,6 +31,23 @@ int main()
     test_tilekey();
     test_tilegrid();
     test_camera();
+    test_pmtiles();
+    test_tilepack();
+    test_hostgovernor();
+    test_tileendpoint();
+    test_pngstream();
+    test_httpheaders();
+    test_nettelemetry();
+    test_profiler();
+    test_camerapath();
+    test_framestats();
+    test_inputlog();
+    test_zoomblend();
+    test_tilecache();
+    test_bc1();
+    test_texelpack();
+    test_pixelkernels();
+    test_contenthash();
     std::printf("---------------------------\n");
     std::printf("%d checks, %d failures\n", slippytest::g_checks, slippytest::g_fails);
     std::printf("RESULT: %s\n", slippytest::g_fails == 0 ? "PASS" : "FAIL");
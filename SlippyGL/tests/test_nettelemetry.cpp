@@ -0,0 +1,63 @@
+#include "check.hpp"
+#include "net/NetTelemetry.hpp"
+
+#include <string>
+
+using namespace slippygl::net;
+
+void test_nettelemetry()
+{
+    std::printf("[nettelemetry]\n");
+
+    // Rolling window keeps only the most recent samples
+    RollingHistogram h(4);
+    for (int i = 1; i <= 6; ++i) h.add(i * 10.0);
+    CHECK_EQ(h.size(), 4u);
+    CHECK_EQ(h.total(), 6u);
+    CHECK_NEAR(h.percentile(0.0), 30.0, 1e-9);
+    CHECK_NEAR(h.percentile(100.0), 60.0, 1e-9);
+    CHECK_NEAR(h.mean(), 45.0, 1e-9);
+    CHECK_NEAR(h.max(), 60.0, 1e-9);
+    const auto b = h.buckets();                 // 30,40,50,60 -> [16,32) [32,64)
+    CHECK_EQ(b[5], 1u);
+    CHECK_EQ(b[6], 3u);
+    CHECK_NEAR(RollingHistogram().percentile(50.0), 0.0, 1e-9);
+
+    NetTelemetry t(16);
+    RequestTimings fresh;
+    fresh.dnsMs = 2.0;
+    fresh.connectMs = 5.0;
+    fresh.tlsMs = 20.0;
+    fresh.ttfbMs = 60.0;
+    fresh.totalMs = 80.0;
+    fresh.wireBytes = 1100;
+    fresh.decodedBytes = 2000;
+    fresh.httpVersion = 20;
+    t.record(fresh, 200);
+
+    RequestTimings reused = fresh;
+    reused.connectionReused = true;
+    reused.dnsMs = reused.connectMs = reused.tlsMs = 0.0;
+    reused.ttfbMs = 30.0;
+    reused.httpVersion = 11;
+    t.record(reused, 200);
+    t.record(RequestTimings{}, 0);
+
+    const auto s = t.summary();
+    CHECK_EQ(s.requests, 3u);
+    CHECK_EQ(s.failures, 1u);
+    CHECK_EQ(s.reusedConnections, 1u);
+    CHECK_EQ(s.http2, 1u);
+    CHECK_EQ(s.http1, 1u);
+    CHECK_EQ(s.wireBytes, 2200);
+    CHECK_EQ(s.decodedBytes, 4000);
+    CHECK_NEAR(s.ttfbP99, 60.0, 1e-9);         // failed request adds no TTFB sample
+
+    const std::string json = t.toJson();
+    CHECK(json.front() == '{' && json.back() == '}');
+    CHECK(json.find("\"reused_connections\":1") != std::string::npos);
+    CHECK(json.find("\"tls\":{\"n\":1,") != std::string::npos);   // reused connections skip handshake phases
+
+    t.reset();
+    CHECK_EQ(t.summary().requests, 0u);
+}
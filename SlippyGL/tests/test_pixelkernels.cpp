@@ -0,0 +1,150 @@
+#include "check.hpp"
+#include "decode/PixelKernels.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace slippygl::decode;
+using Isa = PixelKernels::Isa;
+
+namespace
+{
+    std::vector<std::uint8_t> randomBytes(std::size_t n, std::mt19937& rng)
+    {
+        std::vector<std::uint8_t> v(n);
+        for (auto& b : v) b = static_cast<std::uint8_t>(rng());
+        return v;
+    }
+
+    // Every kernel on one path must match the scalar path byte for byte
+    void compareWithScalar(Isa isa)
+    {
+        std::mt19937 rng(1234);
+        // Counts around the 4/8/16/32-pixel steps and their tails
+        const std::size_t counts[] = { 0, 1, 3, 7, 15, 16, 17, 31, 33, 63, 100, 257 };
+
+        bool expandOk = true, premulOk = true, packOk = true, opaqueOk = true;
+        for (std::size_t count : counts)
+        {
+            const std::vector<std::uint8_t> rgb = randomBytes(count * 3, rng);
+            std::vector<std::uint8_t> rgba = randomBytes(count * 4, rng);
+
+            // Guard bytes catch writes past the end
+            std::vector<std::uint8_t> a(count * 4 + 16, 0xCD), b(count * 4 + 16, 0xCD);
+            PixelKernels::force(Isa::kScalar);
+            PixelKernels::expandRGBtoRGBA(rgb.data(), a.data(), count);
+            PixelKernels::force(isa);
+            PixelKernels::expandRGBtoRGBA(rgb.data(), b.data(), count);
+            expandOk = expandOk && a == b;
+
+            a.assign(rgba.begin(), rgba.end());
+            b = a;
+            PixelKernels::force(Isa::kScalar);
+            PixelKernels::premultiplyAlpha(a.data(), count);
+            PixelKernels::force(isa);
+            PixelKernels::premultiplyAlpha(b.data(), count);
+            premulOk = premulOk && a == b;
+
+            std::vector<std::uint16_t> pa(count + 8, 0xCDCD), pb(count + 8, 0xCDCD);
+            PixelKernels::force(Isa::kScalar);
+            PixelKernels::packRGB565(rgba.data(), pa.data(), count);
+            PixelKernels::force(isa);
+            PixelKernels::packRGB565(rgba.data(), pb.data(), count);
+            packOk = packOk && pa == pb;
+
+            // Opaque, then one translucent pixel at each end
+            for (std::size_t i = 0; i < count; ++i) rgba[i * 4 + 3] = 255;
+            opaqueOk = opaqueOk && PixelKernels::allOpaque(rgba.data(), count);
+            if (count > 0)
+            {
+                rgba[3] = 254;
+                opaqueOk = opaqueOk && !PixelKernels::allOpaque(rgba.data(), count);
+                rgba[3] = 255;
+                rgba[(count - 1) * 4 + 3] = 0;
+                opaqueOk = opaqueOk && !PixelKernels::allOpaque(rgba.data(), count);
+            }
+        }
+        CHECK(expandOk);
+        CHECK(premulOk);
+        CHECK(packOk);
+        CHECK(opaqueOk);
+
+        // Odd, thin and wide images
+        const int sizes[][2] = { { 1, 1 }, { 1, 5 }, { 5, 1 }, { 2, 2 }, { 7, 3 }, { 17, 9 }, { 33, 4 }, { 64, 64 } };
+        bool downOk = true;
+        for (const auto& s : sizes)
+        {
+            const std::vector<std::uint8_t> src = randomBytes(static_cast<std::size_t>(s[0]) * s[1] * 4, rng);
+            const std::size_t dstBytes = static_cast<std::size_t>(std::max(1, s[0] / 2)) * std::max(1, s[1] / 2) * 4;
+            std::vector<std::uint8_t> a(dstBytes + 16, 0xCD), b(dstBytes + 16, 0xCD);
+            PixelKernels::force(Isa::kScalar);
+            PixelKernels::downsample2x2(src.data(), s[0], s[1], a.data());
+            PixelKernels::force(isa);
+            PixelKernels::downsample2x2(src.data(), s[0], s[1], b.data());
+            downOk = downOk && a == b;
+        }
+        CHECK(downOk);
+    }
+}
+
+void test_pixelkernels()
+{
+    std::printf("[pixelkernels]\n");
+
+    CHECK(PixelKernels::supported(Isa::kScalar));
+    CHECK(PixelKernels::supported(PixelKernels::active()));
+
+    // Known values on the scalar (reference) path
+    CHECK(PixelKernels::force(Isa::kScalar));
+    CHECK(PixelKernels::active() == Isa::kScalar);
+    {
+        const std::uint8_t rgb[6] = { 1, 2, 3, 250, 251, 252 };
+        std::uint8_t rgba[8];
+        PixelKernels::expandRGBtoRGBA(rgb, rgba, 2);
+        const std::uint8_t expect[8] = { 1, 2, 3, 255, 250, 251, 252, 255 };
+        CHECK(std::memcmp(rgba, expect, 8) == 0);
+    }
+    {
+        std::uint8_t px[12] = { 255, 128, 1, 128, 200, 100, 50, 0, 10, 20, 30, 255 };
+        PixelKernels::premultiplyAlpha(px, 3);
+        const std::uint8_t expect[12] = { 128, 64, 1, 128, 0, 0, 0, 0, 10, 20, 30, 255 };
+        CHECK(std::memcmp(px, expect, 12) == 0);
+    }
+    {
+        const std::uint8_t px[8] = { 255, 128, 0, 9, 8, 4, 250, 0 };
+        std::uint16_t out[2];
+        PixelKernels::packRGB565(px, out, 2);
+        CHECK_EQ(out[0], (31 << 11) | (32 << 5) | 0);
+        CHECK_EQ(out[1], (1 << 11) | (1 << 5) | 30);
+    }
+    {
+        // 3x2 -> 1x1 (last column dropped); 1x3 -> 1x1 (column paired with itself)
+        const std::uint8_t src[24] = { 0, 0, 0, 0,  1, 1, 1, 1,  99, 99, 99, 99,
+                                       2, 2, 2, 2,  3, 3, 3, 3,  99, 99, 99, 99 };
+        std::uint8_t dst[4];
+        PixelKernels::downsample2x2(src, 3, 2, dst);
+        CHECK_EQ(dst[0], 2);   // (0 + 1 + 2 + 3 + 2) / 4
+        const std::uint8_t column[12] = { 10, 0, 0, 255, 11, 0, 0, 255, 200, 0, 0, 255 };
+        PixelKernels::downsample2x2(column, 1, 3, dst);
+        CHECK_EQ(dst[0], 11);  // (10 + 10 + 11 + 11 + 2) / 4
+        CHECK_EQ(dst[3], 255);
+    }
+
+    // Every vector path this build and CPU can run
+    const Isa paths[] = { Isa::kSSE2, Isa::kAVX2, Isa::kNEON };
+    for (Isa isa : paths)
+    {
+        if (!PixelKernels::supported(isa))
+        {
+            CHECK(!PixelKernels::force(isa));
+            continue;
+        }
+        compareWithScalar(isa);
+    }
+
+    PixelKernels::reset();
+    CHECK(PixelKernels::active() != Isa::kScalar || !PixelKernels::supported(Isa::kSSE2));
+}
@@ -0,0 +1,176 @@
+#include "check.hpp"
+#include "tile/PmTilesSource.hpp"
+
+#include <zlib.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace slippygl;
+using namespace slippygl::tile;
+
+namespace
+{
+    using Bytes = std::vector<std::uint8_t>;
+
+    struct Entry { std::uint64_t tileId, offset; std::uint32_t length, runLength; };
+
+    void putVarint(Bytes& b, std::uint64_t v)
+    {
+        while (v >= 0x80) { b.push_back(static_cast<std::uint8_t>(v | 0x80)); v >>= 7; }
+        b.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    void putU64(Bytes& b, std::size_t at, std::uint64_t v)
+    {
+        for (int i = 0; i < 8; ++i) b[at + i] = static_cast<std::uint8_t>(v >> (8 * i));
+    }
+
+    Bytes serializeDir(const std::vector<Entry>& es)
+    {
+        Bytes b;
+        putVarint(b, es.size());
+        std::uint64_t last = 0;
+        for (const auto& e : es) { putVarint(b, e.tileId - last); last = e.tileId; }
+        for (const auto& e : es) putVarint(b, e.runLength);
+        for (const auto& e : es) putVarint(b, e.length);
+        for (std::size_t i = 0; i < es.size(); ++i) {
+            const bool contiguous = i > 0 && es[i].offset == es[i-1].offset + es[i-1].length;
+            putVarint(b, contiguous ? 0 : es[i].offset + 1);
+        }
+        return b;
+    }
+
+    Bytes gzip(const Bytes& in)
+    {
+        z_stream zs{};
+        deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+        Bytes out(deflateBound(&zs, static_cast<uLong>(in.size())) + 32);
+        zs.next_in = const_cast<Bytef*>(in.data());
+        zs.avail_in = static_cast<uInt>(in.size());
+        zs.next_out = out.data();
+        zs.avail_out = static_cast<uInt>(out.size());
+        deflate(&zs, Z_FINISH);
+        out.resize(zs.total_out);
+        deflateEnd(&zs);
+        return out;
+    }
+
+    // header | root dir | leaf dirs | tile data
+    std::string writeArchive(const char* name, const Bytes& root, const Bytes& leaves,
+                             const Bytes& data, std::uint8_t internalCompression)
+    {
+        Bytes file(127, 0);
+        const char magic[] = "PMTiles";
+        for (int i = 0; i < 7; ++i) file[i] = static_cast<std::uint8_t>(magic[i]);
+        file[7] = 3;
+        putU64(file, 8, 127);
+        putU64(file, 16, root.size());
+        putU64(file, 40, 127 + root.size());
+        putU64(file, 48, leaves.size());
+        putU64(file, 56, 127 + root.size() + leaves.size());
+        putU64(file, 64, data.size());
+        file[97] = internalCompression;
+        file[98] = PmTilesSource::kCompressionNone;
+        file[99] = 2;   // png
+        file[100] = 0;  // min zoom
+        file[101] = 2;  // max zoom
+        file.insert(file.end(), root.begin(), root.end());
+        file.insert(file.end(), leaves.begin(), leaves.end());
+        file.insert(file.end(), data.begin(), data.end());
+
+        const auto path = (std::filesystem::temp_directory_path() / name).string();
+        std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(file.data()),
+                                                    static_cast<std::streamsize>(file.size()));
+        return path;
+    }
+
+    std::string spanStr(const core::ByteSpan& s)
+    {
+        return std::string(reinterpret_cast<const char*>(s.data()), s.size());
+    }
+}
+
+void test_pmtiles()
+{
+    std::printf("[pmtiles]\n");
+
+    // Tile IDs from the PMTiles v3 spec (Hilbert order within each zoom)
+    CHECK_EQ(PmTilesSource::zxyToTileId(0, 0, 0), 0u);
+    CHECK_EQ(PmTilesSource::zxyToTileId(1, 0, 0), 1u);
+    CHECK_EQ(PmTilesSource::zxyToTileId(1, 0, 1), 2u);
+    CHECK_EQ(PmTilesSource::zxyToTileId(1, 1, 1), 3u);
+    CHECK_EQ(PmTilesSource::zxyToTileId(1, 1, 0), 4u);
+    CHECK_EQ(PmTilesSource::zxyToTileId(2, 0, 0), 5u);
+
+    // Tile data "AAAA" "BB" "CCC"; tile 1..3 share "BB" via a run length of 3
+    const Bytes data = { 'A','A','A','A', 'B','B', 'C','C','C' };
+
+    // Root-only directory
+    {
+        const Bytes root = serializeDir({
+            { 0, 0, 4, 1 },   // z0
+            { 1, 4, 2, 3 },   // z1 ids 1..3
+            { 4, 6, 3, 1 },   // z1 id 4 = (1,1,0)
+        });
+        const auto path = writeArchive("slippygl_test_root.pmtiles", root, {}, data,
+                                       PmTilesSource::kCompressionNone);
+        PmTilesSource src;
+        std::string err;
+        CHECK(src.open(path, &err));
+        CHECK_EQ(src.maxZoom(), 2);
+
+        core::ByteSpan s;
+        CHECK(src.find(TileKey(0, 0, 0), s));
+        CHECK(spanStr(s) == "AAAA");
+        CHECK(src.find(TileKey(1, 0, 1), s));   // id 2, inside the run
+        CHECK(spanStr(s) == "BB");
+        CHECK(src.find(TileKey(1, 1, 0), s));   // id 4
+        CHECK(spanStr(s) == "CCC");
+        CHECK(!src.find(TileKey(2, 0, 0), s));  // id 5, not stored
+        CHECK(!src.find(TileKey(9, 0, 0), s));  // outside zoom range
+
+        src.close();
+        std::filesystem::remove(path);
+    }
+
+    // gzip root pointing at a gzip leaf directory
+    {
+        const Bytes leaf = gzip(serializeDir({
+            { 0, 0, 4, 1 },
+            { 4, 6, 3, 1 },
+        }));
+        const Bytes root = gzip(serializeDir({ { 0, 0, static_cast<std::uint32_t>(leaf.size()), 0 } }));
+        const auto path = writeArchive("slippygl_test_leaf.pmtiles", root, leaf, data,
+                                       PmTilesSource::kCompressionGzip);
+        PmTilesSource src;
+        std::string err;
+        CHECK(src.open(path, &err));
+
+        core::ByteSpan s;
+        CHECK(src.find(TileKey(1, 1, 0), s));
+        CHECK(spanStr(s) == "CCC");
+        CHECK_EQ(src.cachedLeafCount(), 1u);
+        CHECK(src.find(TileKey(0, 0, 0), s));   // served from the cached leaf
+        CHECK(spanStr(s) == "AAAA");
+        CHECK_EQ(src.cachedLeafCount(), 1u);
+        CHECK(!src.find(TileKey(1, 0, 0), s));  // id 1 absent in leaf
+
+        src.close();
+        std::filesystem::remove(path);
+    }
+
+    // Rejects non-PMTiles input
+    {
+        const auto path = (std::filesystem::temp_directory_path() / "slippygl_test_bad.pmtiles").string();
+        std::ofstream(path, std::ios::binary) << std::string(200, 'x');
+        PmTilesSource src;
+        std::string err;
+        CHECK(!src.open(path, &err));
+        CHECK(!err.empty());
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,283 @@
+#include "check.hpp"
+#include "decode/PngCodec.hpp"
+#include "decode/PngStreamDecoder.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace slippygl::decode;
+
+namespace
+{
+    using Bytes = std::vector<std::uint8_t>;
+
+    void putBE32(Bytes& b, std::uint32_t v)
+    {
+        b.push_back(static_cast<std::uint8_t>(v >> 24));
+        b.push_back(static_cast<std::uint8_t>(v >> 16));
+        b.push_back(static_cast<std::uint8_t>(v >> 8));
+        b.push_back(static_cast<std::uint8_t>(v));
+    }
+
+    void putChunk(Bytes& png, const char* type, const Bytes& data)
+    {
+        putBE32(png, static_cast<std::uint32_t>(data.size()));
+        const std::size_t start = png.size();
+        png.insert(png.end(), type, type + 4);
+        png.insert(png.end(), data.begin(), data.end());
+        putBE32(png, static_cast<std::uint32_t>(crc32(0, png.data() + start, static_cast<uInt>(png.size() - start))));
+    }
+
+    // Minimal PNG writer: rows are already filtered (filter byte + bytes)
+    Bytes makePng(int w, int h, int depth, int colorType, const Bytes& filtered,
+                  const Bytes& plte = {}, const Bytes& trns = {}, int interlace = 0)
+    {
+        Bytes png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+        Bytes ihdr;
+        putBE32(ihdr, static_cast<std::uint32_t>(w));
+        putBE32(ihdr, static_cast<std::uint32_t>(h));
+        ihdr.push_back(static_cast<std::uint8_t>(depth));
+        ihdr.push_back(static_cast<std::uint8_t>(colorType));
+        ihdr.push_back(0);
+        ihdr.push_back(0);
+        ihdr.push_back(static_cast<std::uint8_t>(interlace));
+        putChunk(png, "IHDR", ihdr);
+        if (!plte.empty()) putChunk(png, "PLTE", plte);
+        if (!trns.empty()) putChunk(png, "tRNS", trns);
+        putChunk(png, "tEXt", Bytes{ 'k', 0, 'v' });
+
+        uLongf zlen = compressBound(static_cast<uLong>(filtered.size()));
+        Bytes z(zlen);
+        compress(z.data(), &zlen, filtered.data(), static_cast<uLong>(filtered.size()));
+        z.resize(zlen);
+        // Split image data across two IDAT chunks
+        const std::size_t half = z.size() / 2;
+        putChunk(png, "IDAT", Bytes(z.begin(), z.begin() + static_cast<std::ptrdiff_t>(half)));
+        putChunk(png, "IDAT", Bytes(z.begin() + static_cast<std::ptrdiff_t>(half), z.end()));
+        putChunk(png, "IEND", {});
+        return png;
+    }
+
+    // Filter raw rows with a random filter type per row
+    Bytes filterRows(const Bytes& raw, std::size_t rowBytes, std::size_t bpp, int h, std::mt19937& rng)
+    {
+        Bytes out;
+        for (int y = 0; y < h; ++y)
+        {
+            const std::uint8_t* cur = raw.data() + static_cast<std::size_t>(y) * rowBytes;
+            const std::uint8_t* up = y > 0 ? cur - rowBytes : nullptr;
+            const int type = static_cast<int>(rng() % 5);
+            out.push_back(static_cast<std::uint8_t>(type));
+            for (std::size_t k = 0; k < rowBytes; ++k)
+            {
+                const int a = k >= bpp ? cur[k - bpp] : 0;
+                const int b = up ? up[k] : 0;
+                const int c = (up && k >= bpp) ? up[k - bpp] : 0;
+                int pred = 0;
+                switch (type)
+                {
+                case 1: pred = a; break;
+                case 2: pred = b; break;
+                case 3: pred = (a + b) >> 1; break;
+                case 4:
+                {
+                    const int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+                    pred = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+                    break;
+                }
+                default: break;
+                }
+                out.push_back(static_cast<std::uint8_t>(cur[k] - pred));
+            }
+        }
+        return out;
+    }
+
+    bool decodeInSlices(const Bytes& png, std::size_t slice, Image& img, PngStreamDecoder& dec)
+    {
+        dec.reset();
+        for (std::size_t i = 0; i < png.size(); i += slice)
+        {
+            dec.feed(png.data() + i, std::min(slice, png.size() - i));
+        }
+        return dec.finish(img);
+    }
+}
+
+void test_pngstream()
+{
+    std::printf("[pngstream]\n");
+    PngStreamDecoder dec;
+    Image img;
+
+    // RGBA8 4x5, one row per filter type (None, Sub, Up, Average, Paeth)
+    {
+        const int w = 4, h = 5;
+        Bytes raw(static_cast<std::size_t>(w * h * 4));
+        for (std::size_t i = 0; i < raw.size(); ++i) raw[i] = static_cast<std::uint8_t>(i * 37 + 11);
+
+        const std::size_t stride = static_cast<std::size_t>(w) * 4;
+        Bytes filtered;
+        for (int y = 0; y < h; ++y)
+        {
+            const std::uint8_t* cur = raw.data() + y * stride;
+            const std::uint8_t* up = y > 0 ? raw.data() + (y - 1) * stride : nullptr;
+            filtered.push_back(static_cast<std::uint8_t>(y));   // filter 0..4
+            for (std::size_t k = 0; k < stride; ++k)
+            {
+                const int a = k >= 4 ? cur[k - 4] : 0;
+                const int b = up ? up[k] : 0;
+                const int c = (up && k >= 4) ? up[k - 4] : 0;
+                int pred = 0;
+                switch (y)
+                {
+                case 1: pred = a; break;
+                case 2: pred = b; break;
+                case 3: pred = (a + b) >> 1; break;
+                case 4:
+                {
+                    const int p = a + b - c, pa = std::abs(p - a), pb = std::abs(p - b), pc = std::abs(p - c);
+                    pred = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+                    break;
+                }
+                default: break;
+                }
+                filtered.push_back(static_cast<std::uint8_t>(cur[k] - pred));
+            }
+        }
+        const Bytes png = makePng(w, h, 8, 6, filtered);
+
+        // Byte-at-a-time and all-at-once give the same pixels
+        CHECK(decodeInSlices(png, 1, img, dec));
+        CHECK_EQ(img.width, w);
+        CHECK_EQ(img.height, h);
+        CHECK_EQ(img.channels, 4);
+        CHECK(img.pixels == raw);
+        CHECK(decodeInSlices(png, png.size(), img, dec));
+        CHECK(img.pixels == raw);
+
+        // Truncated stream: not done, finish() reports failure
+        dec.reset();
+        dec.feed(png.data(), png.size() - 30);
+        CHECK(dec.state() == PngStreamDecoder::State::kNeedMore);
+        CHECK(!dec.finish(img));
+    }
+
+    // 4-bit palette with tRNS (typical for OSM raster tiles)
+    {
+        const Bytes plte = { 255, 0, 0, 0, 255, 0, 0, 0, 255 };
+        const Bytes trns = { 128 };
+        // 3x1 pixels: indices 0,1,2 -> 0x01 0x20
+        const Bytes filtered = { 0, 0x01, 0x20 };
+        CHECK(decodeInSlices(makePng(3, 1, 4, 3, filtered, plte, trns), 3, img, dec));
+        const Bytes expect = { 255, 0, 0, 128, 0, 255, 0, 255, 0, 0, 255, 255 };
+        CHECK(img.pixels == expect);
+    }
+
+    // 16-bit gray with color key, 1-bit gray
+    {
+        const Bytes filtered = { 0, 0x12, 0x34, 0xFF, 0xFF };
+        CHECK(decodeInSlices(makePng(2, 1, 16, 0, filtered, {}, Bytes{ 0x12, 0x34 }), 5, img, dec));
+        const Bytes expect = { 0x12, 0x12, 0x12, 0, 255, 255, 255, 255 };
+        CHECK(img.pixels == expect);
+
+        CHECK(decodeInSlices(makePng(3, 1, 1, 0, Bytes{ 0, 0xA0 }), 7, img, dec));
+        const Bytes expect1 = { 255, 255, 255, 255, 0, 0, 0, 255, 255, 255, 255, 255 };
+        CHECK(img.pixels == expect1);
+    }
+
+    // Palette images need a PLTE that covers every index
+    {
+        const Bytes plte = { 255, 0, 0, 0, 255, 0, 0, 0, 255 };
+        CHECK(decodeInSlices(makePng(3, 1, 8, 3, Bytes{ 0, 0, 1, 2 }, plte), 4, img, dec));
+
+        // Same decoder, shorter palette: index 2 must not hit the previous image's entry
+        CHECK(!decodeInSlices(makePng(3, 1, 8, 3, Bytes{ 0, 0, 1, 2 }, Bytes{ 1, 2, 3, 4, 5, 6 }), 4, img, dec));
+        CHECK(dec.state() == PngStreamDecoder::State::kFailed);
+        CHECK(dec.error() == "Palette index out of range");
+
+        CHECK(!decodeInSlices(makePng(3, 1, 8, 3, Bytes{ 0, 0, 0, 0 }), 4, img, dec));
+        CHECK(dec.error() == "Missing PLTE");
+    }
+
+    // Fixture sweep against the full-buffer decoder (stb_image via PngCodec): every
+    // color type and bit depth, odd widths, random filters, fed in 13-byte slices
+    {
+        std::mt19937 rng(77);
+        struct Format { int colorType, depth, channels; };
+        const Format formats[] = {
+            { 0, 1, 1 }, { 0, 2, 1 }, { 0, 4, 1 }, { 0, 8, 1 }, { 0, 16, 1 },
+            { 2, 8, 3 }, { 2, 16, 3 },
+            { 3, 1, 1 }, { 3, 2, 1 }, { 3, 4, 1 }, { 3, 8, 1 },
+            { 4, 8, 2 }, { 4, 16, 2 },
+            { 6, 8, 4 }, { 6, 16, 4 },
+        };
+        bool allMatch = true;
+        for (const Format& f : formats)
+        {
+            for (int variant = 0; variant < 2; ++variant)
+            {
+                const int w = 13 + variant * 6, h = 7;
+                const std::size_t bits = static_cast<std::size_t>(f.channels) * static_cast<std::size_t>(f.depth);
+                const std::size_t rowBytes = (static_cast<std::size_t>(w) * bits + 7) / 8;
+                const std::size_t bpp = std::max<std::size_t>(1, bits / 8);
+                Bytes raw(rowBytes * h);
+                for (auto& b : raw) b = static_cast<std::uint8_t>(rng());
+
+                Bytes plte, trns;
+                if (f.colorType == 3)
+                {
+                    // Full palette for the depth so every random index is valid
+                    const int entries = 1 << f.depth;
+                    for (int k = 0; k < entries * 3; ++k) plte.push_back(static_cast<std::uint8_t>(rng()));
+                    if (variant == 1)
+                        for (int k = 0; k < entries / 2 + 1; ++k) trns.push_back(static_cast<std::uint8_t>(rng()));
+                }
+                else if (variant == 1 && (f.colorType == 0 || f.colorType == 2))
+                {
+                    // Color key equal to the first pixel so it is actually hit
+                    const std::uint32_t maxSample = (1u << f.depth) - 1u;
+                    for (int c = 0; c < f.channels; ++c)
+                    {
+                        std::uint32_t v = 0;
+                        if (f.depth == 16) v = static_cast<std::uint32_t>((raw[c * 2] << 8) | raw[c * 2 + 1]);
+                        else if (f.depth == 8) v = raw[c];
+                        else v = (raw[0] >> (8 - f.depth)) & maxSample;
+                        trns.push_back(static_cast<std::uint8_t>(v >> 8));
+                        trns.push_back(static_cast<std::uint8_t>(v));
+                    }
+                }
+
+                const Bytes png = makePng(w, h, f.depth, f.colorType, filterRows(raw, rowBytes, bpp, h, rng), plte, trns);
+                Image reference;
+                const bool refOk = PngCodec::decode(png, reference, 4);
+                const bool ok = decodeInSlices(png, 13, img, dec);
+                allMatch = allMatch && refOk && ok && img.pixels == reference.pixels;
+            }
+        }
+        CHECK(allMatch);
+    }
+
+    // Interlaced images are left to the full-buffer decoder
+    {
+        const Bytes png = makePng(1, 1, 8, 0, Bytes{ 0, 7 }, {}, {}, 1);
+        dec.reset();
+        CHECK(!dec.feed(png.data(), png.size()));
+        CHECK(dec.unsupported());
+        CHECK(!dec.finish(img));
+    }
+
+    // Garbage is rejected
+    {
+        const Bytes junk(64, 0x42);
+        dec.reset();
+        CHECK(!dec.feed(junk.data(), junk.size()));
+        CHECK(dec.state() == PngStreamDecoder::State::kFailed);
+    }
+}
@@ -0,0 +1,109 @@
+#include "check.hpp"
+#include "core/Profiler.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace slippygl::core;
+
+void test_profiler()
+{
+    std::printf("[profiler]\n");
+
+    Profiler::reset();
+
+    // Disabled: zones cost one flag check and record nothing
+    Profiler::setEnabled(false);
+    { ProfileZone z("test.off"); }
+    Profiler::endFrame();
+    CHECK(Profiler::summary().empty());
+
+    Profiler::setEnabled(true);
+    Profiler::setThreadName("main");
+    Profiler::endFrame();   // frame boundary baseline
+
+    // Explicit spans make the aggregation deterministic
+    const std::uint64_t t0 = Profiler::nowNs();
+    Profiler::record("test.a", t0, t0 + 3'000'000);   // 3 ms
+    Profiler::record("test.a", t0, t0 + 1'000'000);   // 1 ms
+    Profiler::record("test.b", t0, t0 + 500'000);     // 0.5 ms
+    std::thread worker([] {
+        Profiler::setThreadName("worker");
+        ProfileZone z("test.worker");
+    });
+    worker.join();
+    Profiler::endFrame();
+
+    auto zones = Profiler::summary();
+    CHECK_EQ(zones.size(), 3u);
+    CHECK(std::string(zones[0].name) == "test.a");          // sorted by avg ms/frame
+    CHECK_NEAR(zones[0].avgMsPerFrame, 4.0, 1e-9);          // first frame seeds the average
+    CHECK_NEAR(zones[0].maxMs, 3.0, 1e-9);
+    CHECK_NEAR(zones[0].callsPerFrame, 2.0, 1e-9);
+
+    // Zones absent from a frame decay toward zero
+    Profiler::endFrame();
+    zones = Profiler::summary();
+    CHECK_NEAR(zones[0].avgMsPerFrame, 3.6, 1e-9);
+    CHECK_NEAR(zones[0].maxMs, 0.0, 1e-9);
+    CHECK(Profiler::avgFrameMs() >= 0.0);
+
+    // Chrome trace: complete events for every thread plus thread names
+    const auto path = (std::filesystem::temp_directory_path() / "slippygl_test_trace.json").string();
+    std::string err;
+    CHECK(Profiler::writeChromeTrace(path, &err));
+    std::ifstream in(path);
+    std::stringstream ss;
+    ss << in.rdbuf();
+    const std::string json = ss.str();
+    in.close();
+    CHECK(json.rfind("{\"traceEvents\":[", 0) == 0);
+    CHECK(json.find("\"name\":\"test.b\",\"ph\":\"X\"") != std::string::npos);
+    CHECK(json.find("\"dur\":500.000") != std::string::npos);
+    CHECK(json.find("\"test.worker\"") != std::string::npos);
+    CHECK(json.find("\"args\":{\"name\":\"worker\"}") != std::string::npos);
+    std::filesystem::remove(path);
+
+    // Same label from two translation units arrives as distinct pointers; stats merge by content
+    static const char labelA[] = "test.dup";
+    static const char labelB[] = "test.dup";
+    Profiler::record(labelA, t0, t0 + 1'000'000);
+    Profiler::record(labelB, t0, t0 + 1'000'000);
+    Profiler::endFrame();
+    int dups = 0;
+    for (const auto& z : Profiler::summary())
+    {
+        if (std::string(z.name) != "test.dup") continue;
+        ++dups;
+        CHECK_NEAR(z.callsPerFrame, 2.0, 1e-9);
+    }
+    CHECK_EQ(dups, 1);
+
+    // An exited thread's buffer is handed to the next thread; its old events leave the trace
+    std::thread worker2([] {
+        Profiler::setThreadName("worker2");
+        ProfileZone z("test.worker2");
+    });
+    worker2.join();
+    CHECK(Profiler::writeChromeTrace(path, &err));
+    in.open(path);
+    ss.str("");
+    ss << in.rdbuf();
+    const std::string json2 = ss.str();
+    in.close();
+    CHECK(json2.find("\"test.worker2\"") != std::string::npos);
+    CHECK(json2.find("\"args\":{\"name\":\"worker2\"}") != std::string::npos);
+    CHECK(json2.find("\"test.worker\"") == std::string::npos);
+    CHECK(json2.find("\"args\":{\"name\":\"worker\"}") == std::string::npos);
+    std::filesystem::remove(path);
+
+    CHECK(!Profiler::writeChromeTrace("/nonexistent-dir/trace.json", &err));
+    CHECK(!err.empty());
+
+    Profiler::setEnabled(false);
+    Profiler::reset();
+    CHECK(Profiler::summary().empty());
+}
@@ -0,0 +1,100 @@
+#include "check.hpp"
+#include "decode/TexelPack.hpp"
+
+#include <cstdint>
+#include <vector>
+
+using namespace slippygl::decode;
+
+namespace
+{
+    Image makeImage(int w, int h)
+    {
+        Image img;
+        img.width = w;
+        img.height = h;
+        img.channels = 4;
+        img.pixels.resize(static_cast<std::size_t>(w) * h * 4);
+        return img;
+    }
+
+    void setPixel(Image& img, int i, int r, int g, int b, int a = 255)
+    {
+        std::uint8_t* p = &img.pixels[static_cast<std::size_t>(i) * 4];
+        p[0] = static_cast<std::uint8_t>(r);
+        p[1] = static_cast<std::uint8_t>(g);
+        p[2] = static_cast<std::uint8_t>(b);
+        p[3] = static_cast<std::uint8_t>(a);
+    }
+}
+
+void test_texelpack()
+{
+    std::printf("[texelpack]\n");
+
+    std::vector<std::uint8_t> indices, palette, rgb;
+    std::vector<std::uint16_t> rgb565;
+
+    // Few colors (alpha included): palette in first-seen order, lossless round trip
+    {
+        Image img = makeImage(4, 2);
+        const int colors[8] = { 0, 0, 1, 2, 2, 1, 0, 3 };
+        for (int i = 0; i < 8; ++i)
+        {
+            const int c = colors[i];
+            setPixel(img, i, c * 60, 255 - c * 60, 7, c == 3 ? 0 : 255);
+        }
+        CHECK(TexelPack::toIndexed(img, indices, palette));
+        CHECK_EQ(palette.size(), 16u);
+        CHECK_EQ(indices.size(), 8u);
+        bool same = true;
+        for (int i = 0; i < 8; ++i)
+        {
+            CHECK_EQ(indices[i], colors[i]);
+            for (int k = 0; k < 4; ++k) same = same && palette[indices[i] * 4 + k] == img.pixels[i * 4 + k];
+        }
+        CHECK(same);
+        CHECK_EQ(palette[3 * 4 + 3], 0);   // transparent entry keeps its alpha
+    }
+
+    // Exactly 256 colors fit, the 257th doesn't
+    {
+        Image img = makeImage(257, 1);
+        for (int i = 0; i < 257; ++i) setPixel(img, i, i & 0xFF, i >> 8, 0);
+        CHECK(!TexelPack::toIndexed(img, indices, palette));
+        CHECK(indices.empty());
+        CHECK(palette.empty());
+        img.width = 256;
+        img.pixels.resize(256 * 4);
+        CHECK(TexelPack::toIndexed(img, indices, palette));
+        CHECK_EQ(palette.size(), 256u * 4u);
+        CHECK_EQ(indices[255], 255);
+    }
+
+    // RGB8 drops alpha; RGB565 rounds to the nearest 5/6/5 level
+    {
+        Image img = makeImage(2, 1);
+        setPixel(img, 0, 255, 128, 0);
+        setPixel(img, 1, 8, 4, 250);
+        CHECK(TexelPack::toRGB8(img, rgb));
+        CHECK_EQ(rgb.size(), 6u);
+        CHECK_EQ(rgb[1], 128);
+        CHECK_EQ(rgb[5], 250);
+        CHECK(TexelPack::toRGB565(img, rgb565));
+        CHECK_EQ(rgb565.size(), 2u);
+        CHECK_EQ(rgb565[0], (31 << 11) | (32 << 5) | 0);
+        CHECK_EQ(rgb565[1], (1 << 11) | (1 << 5) | 30);
+    }
+
+    // Only RGBA8 input
+    {
+        Image img;
+        img.width = 1;
+        img.height = 1;
+        img.channels = 3;
+        img.pixels = { 1, 2, 3 };
+        CHECK(!TexelPack::toIndexed(img, indices, palette));
+        CHECK(!TexelPack::toRGB8(img, rgb));
+        CHECK(!TexelPack::toRGB565(img, rgb565));
+    }
+}
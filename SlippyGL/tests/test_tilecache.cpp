@@ -0,0 +1,116 @@
+#include "check.hpp"
+#include "tile/TileCache.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace slippygl::tile;
+using slippygl::render::TexHandle;
+
+namespace
+{
+    // Shared-texture refcounting, with a deleter that records instead of calling GL
+    void testSharing()
+    {
+        std::vector<TexHandle> deleted;
+        auto wasDeleted = [&](TexHandle t) { return std::count(deleted.begin(), deleted.end(), t); };
+        TileCache cache(1000, [&](TexHandle t) { deleted.push_back(t); });
+        const std::uint64_t ocean = 0x0CEA, land = 0x1A4D;
+        const TileKey a(5, 1, 1), b(5, 2, 1), c(5, 3, 1), d(5, 4, 1), e(5, 5, 1), f(5, 6, 1);
+        TexHandle out = 0;
+
+        // put, then putShared with the same hash: one texture, bytes counted once
+        cache.put(a, 10, 100, ocean);
+        CHECK(cache.putShared(b, ocean, out));
+        CHECK_EQ(out, 10u);
+        CHECK_EQ(cache.size(), 2u);
+        CHECK_EQ(cache.textureCount(), 1u);
+        CHECK_EQ(cache.usedBytes(), 100u);
+        CHECK(!cache.putShared(c, 0, out));         // 0 never matches
+        CHECK(!cache.putShared(c, land, out));      // nothing resident with this content
+
+        // Evicting a non-last reference keeps the texture and its bytes
+        cache.put(c, 30, 100);
+        CHECK(cache.get(b, out));                   // LRU order now a, c, b
+        cache.evictIfNeeded(150);                   // drops a (shared) then c (private)
+        CHECK(!cache.contains(a));
+        CHECK(!cache.contains(c));
+        CHECK(cache.contains(b));
+        CHECK_EQ(wasDeleted(10), 0);
+        CHECK_EQ(wasDeleted(30), 1);
+        CHECK_EQ(cache.usedBytes(), 100u);
+        CHECK_EQ(cache.textureCount(), 1u);
+
+        // Evicting the last reference frees the texture and its bytes
+        cache.evictIfNeeded(50);
+        CHECK_EQ(cache.size(), 0u);
+        CHECK_EQ(wasDeleted(10), 1);
+        CHECK_EQ(cache.usedBytes(), 0u);
+        CHECK_EQ(cache.textureCount(), 0u);
+        CHECK(!cache.putShared(a, ocean, out));     // hash gone with its texture
+
+        // Re-put of a key holding a shared reference drops only that reference
+        cache.put(d, 40, 100, land);
+        CHECK(cache.putShared(e, land, out));
+        cache.put(d, 41, 100);
+        CHECK_EQ(wasDeleted(40), 0);
+        CHECK(cache.get(e, out) && out == 40u);
+        CHECK_EQ(cache.usedBytes(), 200u);
+        CHECK_EQ(cache.textureCount(), 2u);
+
+        // ...and sharing it again frees the private texture it replaces
+        CHECK(cache.putShared(d, land, out));
+        CHECK_EQ(wasDeleted(41), 1);
+        CHECK(cache.putShared(e, land, out));       // already shared: reference swapped, not lost
+        CHECK_EQ(wasDeleted(40), 0);
+        CHECK_EQ(cache.usedBytes(), 100u);
+        CHECK_EQ(cache.textureCount(), 1u);
+
+        // Content already resident under another texture stays private
+        cache.put(f, 50, 100, land);
+        CHECK_EQ(cache.textureCount(), 2u);
+        CHECK_EQ(cache.usedBytes(), 200u);
+
+        // clear() frees each shared texture once, plus the private ones
+        const std::uint64_t before = cache.generation();
+        cache.clear();
+        CHECK_EQ(wasDeleted(40), 1);
+        CHECK_EQ(wasDeleted(50), 1);
+        CHECK_EQ(deleted.size(), 5u);               // 30, 10, 41, 40, 50
+        CHECK_EQ(cache.size(), 0u);
+        CHECK_EQ(cache.textureCount(), 0u);
+        CHECK_EQ(cache.usedBytes(), 0u);
+        CHECK(cache.generation() != before);
+    }
+}
+
+void test_tilecache()
+{
+    std::printf("[tilecache]\n");
+
+    // Budget accounting: level 0 only vs. full mip chain
+    CHECK_EQ(TileCache::textureBytes(256, 256, 4, false), 262144u);
+    CHECK_EQ(TileCache::textureBytes(256, 256, 4, true), 349524u);   // 256 .. 1, ~4/3
+    CHECK_EQ(TileCache::textureBytes(1, 1, 4, true), 4u);
+    CHECK_EQ(TileCache::textureBytes(4, 1, 4, true), 16u + 8u + 4u); // non-square clamps at 1
+    CHECK_EQ(TileCache::textureBytes(512, 512, 1, false), 262144u);
+    CHECK_EQ(TileCache::textureBytes(0, 256, 4, true), 0u);
+
+    // 128 MB fits ~25% fewer mipmapped tiles
+    constexpr std::size_t budget = TileCache::kDefaultBudgetBytes;
+    CHECK_EQ(budget / TileCache::textureBytes(256, 256, 4, false), 512u);
+    CHECK_EQ(budget / TileCache::textureBytes(256, 256, 4, true), 384u);
+
+    // Per-format accounting
+    using slippygl::render::TexFormat;
+    CHECK_EQ(TileCache::textureBytes(256, 256, TexFormat::kRGBA8, true), 349524u);
+    CHECK_EQ(TileCache::textureBytes(256, 256, TexFormat::kRGB8, false), 262144u);    // padded to 4 bytes
+    CHECK_EQ(TileCache::textureBytes(256, 256, TexFormat::kRGB565, false), 131072u);
+    CHECK_EQ(TileCache::textureBytes(256, 256, TexFormat::kRGB565, true), 174762u);
+    CHECK_EQ(TileCache::textureBytes(256, 256, TexFormat::kIndexed8, true), 256u * 260u);  // no mips, palette rows
+    CHECK_EQ(TileCache::textureBytes(256, 256, TexFormat::kBC1, false), 32768u);
+    CHECK_EQ(TileCache::textureBytes(256, 256, TexFormat::kBC1, true), 43704u);      // 2x2 and 1x1 still a block
+    CHECK_EQ(budget / TileCache::textureBytes(256, 256, TexFormat::kIndexed8, false), 2016u);
+
+    testSharing();
+}
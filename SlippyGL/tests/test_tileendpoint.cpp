@@ -0,0 +1,82 @@
+#include "check.hpp"
+#include "net/TileEndpoint.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace slippygl::core;
+using namespace slippygl::net;
+
+void test_tileendpoint()
+{
+    std::printf("[tileendpoint]\n");
+
+    // Plain base URL keeps the old z/x/y.png layout
+    {
+        TileEndpoint ep("https://tile.openstreetmap.org");
+        CHECK(ep.rasterUrl(TileID(3, 4, 5)) == "https://tile.openstreetmap.org/3/4/5.png");
+        CHECK(ep.mvtUrl(TileID(3, 4, 5)) == "https://tile.openstreetmap.org/3/4/5.pbf");
+        CHECK_EQ(ep.hostCount(), 1u);
+    }
+
+    CHECK(TileEndpoint::expand("https://{s}.t.org/{z}/{x}/{y}@2x.png?k={q}", "b", TileID(1, 0, 1))
+          == "https://b.t.org/1/0/1@2x.png?k={q}");
+
+    // Subdomains: deterministic per tile, and all hosts get used
+    TileEndpoint ep("https://{s}.tile.example.org/{z}/{x}/{y}.png");
+    ep.setHosts({ "a", "b", "c" });
+    int counts[3] = { 0, 0, 0 };
+    bool stable = true, urlsOk = true;
+    for (int i = 0; i < 300; ++i)
+    {
+        const TileID id(10, i, i * 7 % 1024);
+        const auto t = ep.resolveRaster(id);
+        stable = stable && ep.resolveRaster(id).url == t.url;
+        urlsOk = urlsOk && t.url.find(std::string("https://") + "abc"[t.host] + ".tile.example.org/10/") == 0;
+        ++counts[t.host];
+    }
+    CHECK(stable);
+    CHECK(urlsOk);
+    CHECK(counts[0] > 50 && counts[1] > 50 && counts[2] > 50);
+
+    // Healthy hosts with jittery, slightly different latencies keep every tile
+    // where it was (cache friendliness), even after the first samples arrive
+    {
+        TileEndpoint jitter("https://{s}.tile.example.org/{z}/{x}/{y}.png");
+        jitter.setHosts({ "a", "b", "c" });
+        std::vector<int> before;
+        for (int i = 0; i < 300; ++i) before.push_back(jitter.resolveRaster(TileID(10, i, i * 7 % 1024)).host);
+        bool unmoved = true;
+        for (int round = 0; round < 50; ++round)
+        {
+            jitter.report(0, 20.0 + (round % 5), true);
+            jitter.report(1, 28.0 - (round % 7), true);
+            jitter.report(2, 35.0 + (round % 3) * 2.0, round % 17 != 0);   // an occasional failure
+            for (int i = 0; i < 300; ++i)
+                unmoved = unmoved && jitter.resolveRaster(TileID(10, i, i * 7 % 1024)).host == before[static_cast<std::size_t>(i)];
+        }
+        CHECK(unmoved);
+        for (const auto& h : jitter.health()) CHECK_EQ(h.weight, 1.0);
+    }
+
+    // A slow, failing host loses most of its tiles; the healthy ones keep theirs
+    for (int i = 0; i < 20; ++i)
+    {
+        ep.report(0, 900.0, false);
+        ep.report(1, 20.0, true);
+        ep.report(2, 20.0, true);
+    }
+    int onBad = 0;
+    for (int i = 0; i < 300; ++i)
+    {
+        const TileID id(10, i, i * 7 % 1024);
+        const int h = ep.resolveRaster(id).host;
+        if (h == 0) ++onBad;
+    }
+    CHECK(onBad < 10);
+    const auto health = ep.health();
+    CHECK_EQ(health.size(), 3u);
+    CHECK(health[0].failureRate > 0.9);
+    CHECK(health[0].weight < health[1].weight);
+    CHECK_NEAR(health[1].latencyMs, 20.0, 1e-9);
+}
@@ -2,6 +2,7 @@
 #include "render/Camera2D.hpp"
 #include "tile/TileGrid.hpp"
 #include "tile/TileKey.hpp"
+#include "core/TileMath.hpp"
 
 using namespace slippygl;
 using namespace slippygl::render;
@@ -10,8 +11,8 @@ using namespace slippygl::tile;
 // Mirrors the app loop's zoom-level stepping + camera remap.
 static int step(Camera2D& cam, int z)
 {
-    while (cam.scale() > 2.0f && z < 19) { ++z; cam.applyZoomStep(2.0f); }
-    while (cam.scale() < 0.5f && z > 0)  { --z; cam.applyZoomStep(0.5f); }
+    while (cam.scale() > 2.0f && z < 22) { ++z; cam.applyZoomStep(2.0); }
+    while (cam.scale() < 0.5f && z > 0)  { --z; cam.applyZoomStep(0.5); }
     return z;
 }
 
@@ -22,10 +23,17 @@ static void expectValidRange(const Camera2D& cam, int z, int fbW, int fbH)
     CHECK(r.tileCount() > 0);     // never silently empty
     CHECK(r.minX <= r.maxX);      // never inverted
     CHECK(r.minY <= r.maxY);
-    CHECK(r.minX >= 0);
-    CHECK(r.maxX <= maxIdx);
     CHECK(r.minY >= 0);
     CHECK(r.maxY <= maxIdx);
+
+    // X wraps: spans stay inside the world and cover every column once
+    int columns = 0;
+    for (const auto& s : TileGrid::spans(r))
+    {
+        CHECK(s.minX >= 0 && s.minX <= s.maxX && s.maxX <= maxIdx);
+        columns += s.maxX - s.minX + 1;
+    }
+    CHECK_EQ(columns, r.maxX - r.minX + 1);
 }
 
 void test_tilegrid()
@@ -35,8 +43,8 @@ void test_tilegrid()
     const int fbW = 800, fbH = 600;
     int z = 12;
     Camera2D cam;
-    const glm::vec2 wp = tileToWorldPixel(TileKey{ 12, 3492, 1586 }); // Seoul
-    cam.setWorldOrigin(glm::vec2(wp.x + 128.0f - fbW / 2.0f, wp.y + 128.0f - fbH / 2.0f));
+    const glm::dvec2 wp = tileToWorldPixel(TileKey{ 12, 3492, 1586 }); // Seoul
+    cam.setWorldOrigin(glm::dvec2(wp.x + 128.0 - fbW / 2.0, wp.y + 128.0 - fbH / 2.0));
 
     // initial
     expectValidRange(cam, z, fbW, fbH);
@@ -52,10 +60,63 @@ void test_tilegrid()
     CHECK(z > 12);
 
     // Explicit inverted-range guard: an origin far past the world bounds at a
-    // low zoom must clamp (minX<=maxX), not invert.
+    // low zoom must clamp Y (minY<=maxY) and wrap X, not invert.
     Camera2D off;
-    off.setWorldOrigin(glm::vec2(1.0e6f, 1.0e6f));
+    off.setWorldOrigin(glm::dvec2(1.0e6, 1.0e6));
     const auto r = TileGrid::computeVisibleRange(off, fbW, fbH, 4);
     CHECK(r.minX <= r.maxX);
     CHECK(r.minY <= r.maxY);
+    expectValidRange(off, 4, fbW, fbH);
+
+    // Across the antimeridian: two spans, the right edge of the world drawn one
+    // copy to the left of the left edge
+    {
+        Camera2D am;
+        am.setWorldOrigin(glm::dvec2(-300.0, 0.0));   // z2 world is 1024 px wide
+        const auto ar = TileGrid::computeVisibleRange(am, fbW, fbH, 2);
+        CHECK_EQ(ar.minX, -2);
+        CHECK_EQ(ar.maxX, 1);
+        const auto spans = TileGrid::spans(ar);
+        CHECK_EQ(spans.size(), 2u);
+        CHECK_EQ(spans[0].minX, 2);
+        CHECK_EQ(spans[0].maxX, 3);
+        CHECK_EQ(spans[0].worldCopy, -1);
+        CHECK_EQ(spans[1].minX, 0);
+        CHECK_EQ(spans[1].maxX, 1);
+        CHECK_EQ(spans[1].worldCopy, 0);
+    }
+
+    // Viewport wider than the world (z0): one span per copy, all tile 0, and
+    // rangeToKeys names each tile once
+    {
+        Camera2D wide;
+        wide.setWorldOrigin(glm::dvec2(-100.0, 0.0));
+        const auto wr = TileGrid::computeVisibleRange(wide, fbW, fbH, 0);
+        const auto spans = TileGrid::spans(wr);
+        CHECK_EQ(spans.size(), 4u);   // x -100 .. 700 touches copies -1, 0, 1, 2
+        for (std::size_t i = 0; i < spans.size(); ++i)
+        {
+            CHECK_EQ(spans[i].minX, 0);
+            CHECK_EQ(spans[i].maxX, 0);
+            CHECK_EQ(spans[i].worldCopy, static_cast<int>(i) - 1);
+        }
+        CHECK_EQ(wr.tileCount(), 4);
+        const auto keys = TileGrid::rangeToKeys(wr);
+        CHECK_EQ(keys.size(), 1u);
+        CHECK(keys[0] == TileKey(0, 0, 0));
+        CHECK_NEAR(TileGrid::worldWidthPx(0), 256.0, 0.0);
+    }
+
+    // Deepest zoom: the visible range is exact, so the tile under the screen
+    // centre matches TileMath (float world pixels were off by several tiles here)
+    Camera2D deep;
+    const double cx = core::TileMath::lonToXpx(126.9780, 22), cy = core::TileMath::latToYpx(37.5665, 22);
+    deep.setWorldOrigin(glm::dvec2(cx - fbW / 2.0, cy - fbH / 2.0));
+    const auto d = TileGrid::computeVisibleRange(deep, fbW, fbH, 22);
+    const auto centre = core::TileMath::lonlatToTileID(126.9780, 37.5665, 22);
+    CHECK(d.minX <= centre.x() && centre.x() <= d.maxX);
+    CHECK(d.minY <= centre.y() && centre.y() <= d.maxY);
+    CHECK(d.maxX - d.minX <= fbW / kTileSizePx + 1);
+    CHECK(d.maxY - d.minY <= fbH / kTileSizePx + 1);
+    expectValidRange(deep, 22, fbW, fbH);
 }
@@ -22,9 +22,20 @@ void test_tilekey()
     CHECK_EQ(TileCoord::clampTileIndex(10, 5), 10);
     CHECK_EQ(TileCoord::clampTileIndex(100, 5), 31);   // 2^5 - 1
     CHECK_EQ(TileCoord::clampTileIndex(0, 0), 0);      // 2^0 - 1 = 0
+    CHECK_EQ(TileCoord::wrapTileIndex(-1, 5), 31);     // left of the antimeridian
+    CHECK_EQ(TileCoord::wrapTileIndex(32, 5), 0);
+    CHECK_EQ(TileCoord::wrapTileIndex(-65, 5), 31);
+    CHECK_EQ(TileCoord::wrapTileIndex(7, 0), 0);
 
     // tile -> world pixel (top-left corner)
-    const glm::vec2 wp = tileToWorldPixel(TileKey{ 12, 3492, 1586 });
-    CHECK_EQ(wp.x, 3492.0f * 256.0f);
-    CHECK_EQ(wp.y, 1586.0f * 256.0f);
+    const glm::dvec2 wp = tileToWorldPixel(TileKey{ 12, 3492, 1586 });
+    CHECK_EQ(wp.x, 3492.0 * 256.0);
+    CHECK_EQ(wp.y, 1586.0 * 256.0);
+
+    // z22 world pixels (up to 2^30) stay exact and round-trip to the tile
+    const TileKey deep{ 22, 3576431, 1624199 };
+    const glm::dvec2 dp = tileToWorldPixel(deep);
+    CHECK_EQ(dp.x, 3576431.0 * 256.0);
+    CHECK(worldPixelToTile(glm::dvec2(dp.x + 255.5, dp.y + 0.25), 22) == deep);
+    CHECK(worldPixelToTile(glm::dvec2(dp.x - 0.25, dp.y), 22).x == deep.x - 1);
 }
@@ -0,0 +1,63 @@
+#include "check.hpp"
+#include "tile/TilePack.hpp"
+
+#include <filesystem>
+#include <string>
+
+using namespace slippygl;
+using namespace slippygl::tile;
+
+void test_tilepack()
+{
+    std::printf("[tilepack]\n");
+
+    // Packed key order matches TileKey order
+    CHECK(TilePack::packKey(TileKey(3, 1, 7)) < TilePack::packKey(TileKey(3, 2, 0)));
+    CHECK(TilePack::packKey(TileKey(2, 3, 3)) < TilePack::packKey(TileKey(3, 0, 0)));
+    CHECK(TilePack::unpackKey(TilePack::packKey(TileKey(22, 4000000, 123))) == TileKey(22, 4000000, 123));
+
+    const auto path = (std::filesystem::temp_directory_path() / "slippygl_test.pack").string();
+    {
+        TilePackWriter w;
+        std::string err;
+        CHECK(w.open(path, &err));
+        // Added out of order on purpose; finish() sorts the index
+        const std::string a = "tile-a", b = "bb", c = "ccc";
+        CHECK(w.add(TileKey(5, 9, 9), reinterpret_cast<const std::uint8_t*>(c.data()), c.size(), &err));
+        CHECK(w.add(TileKey(0, 0, 0), reinterpret_cast<const std::uint8_t*>(a.data()), a.size(), &err));
+        CHECK(w.add(TileKey(5, 1, 2), reinterpret_cast<const std::uint8_t*>(b.data()), b.size(), &err));
+        CHECK(!w.add(TileKey(1, 5, 0), reinterpret_cast<const std::uint8_t*>(b.data()), b.size(), &err));
+        CHECK(w.finish(&err));
+    }
+
+    TilePackSource src;
+    std::string err;
+    CHECK(src.open(path, &err));
+    CHECK_EQ(src.count(), 3u);
+    CHECK_EQ(src.minZoom(), 0);
+    CHECK_EQ(src.maxZoom(), 5);
+
+    core::ByteSpan s;
+    CHECK(src.find(TileKey(0, 0, 0), s));
+    CHECK(std::string(reinterpret_cast<const char*>(s.data()), s.size()) == "tile-a");
+    CHECK(src.find(TileKey(5, 1, 2), s));
+    CHECK(std::string(reinterpret_cast<const char*>(s.data()), s.size()) == "bb");
+    CHECK(src.find(TileKey(5, 9, 9), s));
+    CHECK(std::string(reinterpret_cast<const char*>(s.data()), s.size()) == "ccc");
+    CHECK(!src.find(TileKey(5, 9, 8), s));
+    CHECK(!src.find(TileKey(4, 0, 0), s));
+
+    src.close();
+    std::filesystem::remove(path);
+
+    // Duplicate keys are rejected at finish()
+    {
+        TilePackWriter w;
+        const std::uint8_t byte = 1;
+        CHECK(w.open(path));
+        CHECK(w.add(TileKey(1, 0, 0), &byte, 1));
+        CHECK(w.add(TileKey(1, 0, 0), &byte, 1));
+        CHECK(!w.finish(&err));
+        std::filesystem::remove(path);
+    }
+}
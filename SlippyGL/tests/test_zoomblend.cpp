@@ -0,0 +1,89 @@
+#include "check.hpp"
+#include "render/Camera2D.hpp"
+#include "render/ZoomBlend.hpp"
+
+using namespace slippygl::render;
+
+void test_zoomblend()
+{
+    std::printf("[zoomblend]\n");
+
+    Camera2D cam;
+    ZoomBlend zb;
+    int z = 10;
+    zb.reset(z);
+
+    // Inside the hysteresis band nothing switches (old thresholds were 2.0 / 0.5)
+    cam.setScale(1.45f);
+    CHECK(!zb.update(cam, z, 0, 22));
+    CHECK_EQ(z, 10);
+    CHECK(!zb.fading());
+
+    // Past 2^0.6: one level in, view preserved, fade starts from the old level
+    cam.setWorldOrigin(glm::dvec2(1000.0, 500.0));
+    cam.setScale(1.6f);
+    CHECK(zb.update(cam, z, 0, 22));
+    CHECK_EQ(z, 11);
+    CHECK_NEAR(cam.scale(), 0.8f, 1e-6);
+    CHECK_NEAR(cam.worldOrigin().x, 2000.0, 1e-9);
+    CHECK(zb.fading());
+    CHECK_EQ(zb.fromZoom(), 10);
+    CHECK_NEAR(zb.blend(), 0.0f, 1e-6);
+
+    // Wobbling back just below the old threshold does not switch back
+    cam.setScale(0.7f);
+    CHECK(!zb.update(cam, z, 0, 22));
+    CHECK_EQ(z, 11);
+
+    // Fade follows tile arrival: capped by coverage, never goes backwards
+    zb.advance(0.05, 0.1);
+    CHECK_NEAR(zb.blend(), 0.1f, 1e-6);
+    zb.advance(0.05, 0.0);
+    CHECK_NEAR(zb.blend(), 0.1f, 1e-6);
+    zb.advance(0.05, 1.0);
+    CHECK_NEAR(zb.blend(), 0.1f + 0.05f / 0.3f, 1e-5);
+    zb.advance(5.0, 1.0);                       // dt is capped per step
+    CHECK_NEAR(zb.blend(), 0.1f + 0.15f / 0.3f, 1e-5);
+    for (int i = 0; i < 10; ++i) zb.advance(0.1, 1.0);
+    CHECK(!zb.fading());
+    CHECK_NEAR(zb.blend(), 1.0f, 1e-6);
+    CHECK_EQ(zb.fromZoom(), -1);
+
+    // Missing tiles can't hold the backdrop forever
+    cam.setScale(0.5f);
+    CHECK(zb.update(cam, z, 0, 22));
+    CHECK_EQ(z, 10);
+    CHECK_EQ(zb.fromZoom(), 11);
+    for (int i = 0; i < 19; ++i) zb.advance(0.1, 0.0);
+    CHECK(zb.fading());
+    for (int i = 0; i < 5; ++i) zb.advance(0.1, 0.0);
+    CHECK(!zb.fading());
+
+    // Switching back mid-fade swaps the roles and keeps the on-screen mix
+    cam.setScale(1.6f);
+    CHECK(zb.update(cam, z, 0, 22));           // 10 -> 11, from 10
+    zb.advance(0.06, 1.0);                     // blend 0.2
+    cam.setScale(0.6f);
+    CHECK(zb.update(cam, z, 0, 22));           // 11 -> 10
+    CHECK_EQ(z, 10);
+    CHECK_EQ(zb.fromZoom(), 11);
+    CHECK_NEAR(zb.blend(), 0.8f, 1e-5);
+
+    // Multi-level jumps switch without a backdrop; levels set elsewhere are picked up
+    zb.reset(z);
+    cam.setScale(7.0f);
+    CHECK(zb.update(cam, z, 0, 22));
+    CHECK_EQ(z, 13);
+    CHECK(!zb.fading());
+    z = 14;                                    // e.g. CameraPath::apply
+    cam.setScale(1.0f);
+    CHECK(zb.update(cam, z, 0, 22));
+    CHECK_EQ(zb.fromZoom(), 13);
+
+    // Clamped at the zoom limits
+    zb.reset(22);
+    z = 22;
+    cam.setScale(4.0f);
+    CHECK(!zb.update(cam, z, 0, 22));
+    CHECK_EQ(z, 22);
+}
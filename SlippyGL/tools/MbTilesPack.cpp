@@ -0,0 +1,98 @@
+// MBTiles -> SlippyGL tile pack importer.
+//
+// SQLite is only used here, offline. The resulting pack is a flat, sorted,
+// mmap-able file that TilePackSource opens with no parsing beyond the header.
+//
+// usage: slippygl_mbtiles_pack <input.mbtiles> <output.pack>
+#include <sqlite3.h>
+#include <spdlog/spdlog.h>
+
+#include <string>
+
+#include "tile/TilePack.hpp"
+
+using namespace slippygl;
+
+int main(int argc, char** argv)
+{
+    if (argc != 3) {
+        spdlog::error("usage: {} <input.mbtiles> <output.pack>", argc > 0 ? argv[0] : "slippygl_mbtiles_pack");
+        return 2;
+    }
+    const std::string inPath = argv[1];
+    const std::string outPath = argv[2];
+
+    sqlite3* db = nullptr;
+    if (sqlite3_open_v2(inPath.c_str(), &db, SQLITE_OPEN_READONLY, nullptr) != SQLITE_OK) {
+        spdlog::error("Cannot open MBTiles {}: {}", inPath, db ? sqlite3_errmsg(db) : "out of memory");
+        sqlite3_close(db);
+        return 1;
+    }
+
+    // 메타데이터의 format 확인 (PNG 래스터만 렌더 가능)
+    sqlite3_stmt* meta = nullptr;
+    if (sqlite3_prepare_v2(db, "SELECT value FROM metadata WHERE name='format'", -1, &meta, nullptr) == SQLITE_OK) {
+        if (sqlite3_step(meta) == SQLITE_ROW) {
+            const auto* fmt = reinterpret_cast<const char*>(sqlite3_column_text(meta, 0));
+            if (fmt && std::string(fmt) != "png") {
+                spdlog::warn("MBTiles format is '{}'; SlippyGL renders PNG tiles only", fmt);
+            }
+        }
+    }
+    sqlite3_finalize(meta);
+
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, "SELECT zoom_level, tile_column, tile_row, tile_data FROM tiles",
+                           -1, &stmt, nullptr) != SQLITE_OK) {
+        spdlog::error("Not an MBTiles file ({}): {}", inPath, sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return 1;
+    }
+
+    tile::TilePackWriter writer;
+    std::string err;
+    if (!writer.open(outPath, &err)) {
+        spdlog::error("{}", err);
+        sqlite3_finalize(stmt);
+        sqlite3_close(db);
+        return 1;
+    }
+
+    std::size_t skipped = 0;
+    std::size_t bytes = 0;
+    int rc = SQLITE_ROW;
+    while ((rc = sqlite3_step(stmt)) == SQLITE_ROW) {
+        const int z = sqlite3_column_int(stmt, 0);
+        const int x = sqlite3_column_int(stmt, 1);
+        const int tmsY = sqlite3_column_int(stmt, 2);
+        const auto* data = static_cast<const std::uint8_t*>(sqlite3_column_blob(stmt, 3));
+        const int size = sqlite3_column_bytes(stmt, 3);
+
+        // MBTiles는 TMS(y-up) 행 번호를 쓴다 → XYZ(y-down)로 뒤집는다
+        const tile::TileKey key(z, x, (z >= 0 && z <= 22) ? ((1 << z) - 1 - tmsY) : -1);
+        if (!data || size <= 0 || !writer.add(key, data, static_cast<std::size_t>(size), &err)) {
+            spdlog::warn("Skipping tile z={} x={} row={}: {}", z, x, tmsY, err.empty() ? "empty blob" : err);
+            err.clear();
+            ++skipped;
+            continue;
+        }
+        bytes += static_cast<std::size_t>(size);
+    }
+    sqlite3_finalize(stmt);
+
+    if (rc != SQLITE_DONE) {
+        spdlog::error("Reading tiles failed: {}", sqlite3_errmsg(db));
+        sqlite3_close(db);
+        return 1;
+    }
+    sqlite3_close(db);
+
+    if (!writer.finish(&err)) {
+        spdlog::error("{}", err);
+        return 1;
+    }
+
+    spdlog::info("Packed {} tiles ({} MB) into {} ({} skipped)",
+        writer.count(), bytes / (1024 * 1024), outPath, skipped);
+    return 0;
+}